@@ -158,8 +158,10 @@ nusmv/src/rbc/rbcFormula.o \
 nusmv/src/rbc/rbcInline.o \
 nusmv/src/rbc/rbcManager.o \
 nusmv/src/rbc/rbcOutput.o \
+nusmv/src/rbc/rbcRewrite.o \
 nusmv/src/rbc/rbcStat.o \
 nusmv/src/rbc/rbcSubst.o \
+nusmv/src/rbc/rbcTemplate.o \
 nusmv/src/rbc/rbcUtils.o \
 nusmv/src/sat/SatIncSolver.o \
 nusmv/src/sat/SatSolver.o \
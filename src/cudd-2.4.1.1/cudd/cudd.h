@@ -233,7 +233,11 @@ typedef enum {
     CUDD_PRE_GC_HOOK,
     CUDD_POST_GC_HOOK,
     CUDD_PRE_REORDERING_HOOK,
-    CUDD_POST_REORDERING_HOOK
+    CUDD_POST_REORDERING_HOOK,
+    /* NuSMV: add begin */
+    CUDD_MEM_BUDGET_HOOK
+    /* NuSMV: add end */
+    /* WAS: CUDD_POST_REORDERING_HOOK */
 } Cudd_HookType;
 
 
@@ -320,6 +324,10 @@ typedef struct DdManager DdManager;
 
 typedef struct DdGen DdGen;
 
+/* NuSMV: add begin */
+typedef struct DdSnapshot DdSnapshot;
+/* NuSMV: add end */
+
 /* These typedefs for arbitrary precision arithmetic should agree with
 ** the corresponding constant definitions above. */
 typedef unsigned short int DdApaDigit;
@@ -731,6 +739,11 @@ extern unsigned int Cudd_ReadCacheSlots (DdManager *dd);
 extern double Cudd_ReadCacheUsedSlots (DdManager * dd);
 extern double Cudd_ReadCacheLookUps (DdManager *dd);
 extern double Cudd_ReadCacheHits (DdManager *dd);
+/* NuSMV: add begin */
+extern int Cudd_ReadCacheOpCount (DdManager *dd);
+extern int Cudd_ReadCacheOpStats (DdManager *dd, int i, const char **name, ptruint *op, double *lookups, double *hits, double *inserts, double *evictions);
+extern int Cudd_PrintCacheOpStats (DdManager *dd, FILE *fp);
+/* NuSMV: add end */
 extern double Cudd_ReadRecursiveCalls (DdManager * dd);
 extern unsigned int Cudd_ReadMinHit (DdManager *dd);
 extern void Cudd_SetMinHit (DdManager *dd, unsigned int hr);
@@ -759,6 +772,12 @@ extern int Cudd_ReadSiftMaxVar (DdManager *dd);
 extern void Cudd_SetSiftMaxVar (DdManager *dd, int smv);
 extern int Cudd_ReadSiftMaxSwap (DdManager *dd);
 extern void Cudd_SetSiftMaxSwap (DdManager *dd, int sms);
+/* NuSMV: add begin */
+extern long Cudd_ReadReorderingTimeLimit (DdManager *dd);
+extern void Cudd_SetReorderingTimeLimit (DdManager *dd, long tl);
+extern long Cudd_ReadReorderingTotalLimit (DdManager *dd);
+extern void Cudd_SetReorderingTotalLimit (DdManager *dd, long tl);
+/* NuSMV: add end */
 extern double Cudd_ReadMaxGrowth (DdManager *dd);
 extern void Cudd_SetMaxGrowth (DdManager *dd, double mg);
 extern double Cudd_ReadMaxGrowthAlternate (DdManager * dd);
@@ -834,6 +853,12 @@ extern void Cudd_SetMaxMemory (DdManager *dd, ptruint maxMemory);
   /* WAS: extern unsigned long Cudd_ReadMaxMemory (DdManager *dd);
           extern void Cudd_SetMaxMemory (DdManager *dd, unsigned long maxMemory); */
 /* NUSMV: add end */
+/* NuSMV: add begin */
+extern ptruint Cudd_ReadMemoryBudget (DdManager *dd);
+extern void Cudd_SetMemoryBudget (DdManager *dd, ptruint budget);
+extern int Cudd_ReadMemoryBudgetEvents (DdManager *dd);
+extern ptruint Cudd_ReleaseMemory (DdManager *dd);
+/* NuSMV: add end */
 
 extern int Cudd_bddBindVar (DdManager *dd, int index);
 extern int Cudd_bddUnbindVar (DdManager *dd, int index);
@@ -1002,6 +1027,18 @@ extern int Cudd_DumpDot (DdManager *dd, int n, DdNode **f, char **inames, char *
 extern int Cudd_DumpDaVinci (DdManager *dd, int n, DdNode **f, char **inames, char **onames, FILE *fp);
 extern int Cudd_DumpDDcal (DdManager *dd, int n, DdNode **f, char **inames, char **onames, FILE *fp);
 extern int Cudd_DumpFactoredForm (DdManager *dd, int n, DdNode **f, char **inames, char **onames, FILE *fp);
+/* NuSMV: add begin */
+extern int Cudd_SnapshotSave (DdManager *dd, const char *filename, int n, DdNode **f, char **varnames, char **rootnames);
+extern DdSnapshot * Cudd_SnapshotOpen (const char *filename);
+extern void Cudd_SnapshotClose (DdSnapshot *snap);
+extern int Cudd_SnapshotReadVarCount (DdSnapshot *snap);
+extern const char * Cudd_SnapshotReadVarName (DdSnapshot *snap, int i);
+extern int Cudd_SnapshotReadVarLevel (DdSnapshot *snap, int i);
+extern int Cudd_SnapshotReadRootCount (DdSnapshot *snap);
+extern const char * Cudd_SnapshotReadRootName (DdSnapshot *snap, int i);
+extern unsigned int Cudd_SnapshotReadNodeCount (DdSnapshot *snap);
+extern DdNode ** Cudd_SnapshotLoad (DdManager *dd, DdSnapshot *snap, int *varmap, int restore);
+/* NuSMV: add end */
 extern DdNode * Cudd_bddConstrain (DdManager *dd, DdNode *f, DdNode *c);
 extern DdNode * Cudd_bddRestrict (DdManager *dd, DdNode *f, DdNode *c);
 extern DdNode * Cudd_bddNPAnd (DdManager *dd, DdNode *f, DdNode *c);
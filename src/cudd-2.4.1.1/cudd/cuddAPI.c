@@ -129,6 +129,10 @@
 		<li> Cudd_SetMaxLive()
 		<li> Cudd_ReadMaxMemory()
 		<li> Cudd_SetMaxMemory()
+		<li> Cudd_ReadMemoryBudget()
+		<li> Cudd_SetMemoryBudget()
+		<li> Cudd_ReadMemoryBudgetEvents()
+		<li> Cudd_ReleaseMemory()
 		<li> Cudd_bddBindVar()
 		<li> Cudd_bddUnbindVar()
 		<li> Cudd_bddVarIsBound()
@@ -2067,6 +2071,104 @@ Cudd_SetSiftMaxSwap(
 } /* end of Cudd_SetSiftMaxSwap */
 
 
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Reads the time limit of a single reordering.]
+
+  Description [Reads the number of milliseconds a single invocation of
+  reordering is allowed to run. 0 means no limit.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SetReorderingTimeLimit]
+
+******************************************************************************/
+long
+Cudd_ReadReorderingTimeLimit(
+  DdManager * dd)
+{
+    return(dd->reordTimeLimit);
+
+} /* end of Cudd_ReadReorderingTimeLimit */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Sets the time limit of a single reordering.]
+
+  Description [Sets the number of milliseconds a single invocation of
+  reordering is allowed to run; 0 means no limit. Sifting, symmetric
+  sifting, group sifting and random swapping check the limit after each
+  swap. When it expires, the variable being sifted is moved back to the
+  best position seen and reordering stops, keeping the best order found
+  so far. Other methods ignore the limit. The real time may exceed the
+  limit by the time needed to move the last variable back.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_ReadReorderingTimeLimit Cudd_SetReorderingTotalLimit
+  Cudd_SetSiftMaxSwap]
+
+******************************************************************************/
+void
+Cudd_SetReorderingTimeLimit(
+  DdManager * dd,
+  long  tl)
+{
+    dd->reordTimeLimit = tl;
+
+} /* end of Cudd_SetReorderingTimeLimit */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads the total time limit of automatic reordering.]
+
+  Description [Reads the number of milliseconds of reordering after which
+  automatic dynamic reordering is no longer triggered. 0 means no
+  limit.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SetReorderingTotalLimit]
+
+******************************************************************************/
+long
+Cudd_ReadReorderingTotalLimit(
+  DdManager * dd)
+{
+    return(dd->reordTotalLimit);
+
+} /* end of Cudd_ReadReorderingTotalLimit */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Sets the total time limit of automatic reordering.]
+
+  Description [Sets the number of milliseconds of reordering, as
+  returned by Cudd_ReadReorderingTime, after which automatic dynamic
+  reordering is no longer triggered; 0 means no limit. Explicit calls
+  to Cudd_ReduceHeap are not affected.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_ReadReorderingTotalLimit Cudd_SetReorderingTimeLimit
+  Cudd_ReadReorderingTime]
+
+******************************************************************************/
+void
+Cudd_SetReorderingTotalLimit(
+  DdManager * dd,
+  long  tl)
+{
+    dd->reordTotalLimit = tl;
+
+} /* end of Cudd_SetReorderingTotalLimit */
+/* NuSMV: add end */
+
+
 /**Function********************************************************************
 
   Synopsis    [Reads the maxGrowth parameter of the manager.]
@@ -3367,6 +3469,11 @@ Cudd_AddHook(
     case CUDD_POST_REORDERING_HOOK:
 	hook = &(dd->postReorderingHook);
 	break;
+    /* NuSMV: add begin */
+    case CUDD_MEM_BUDGET_HOOK:
+	hook = &(dd->memBudgetHook);
+	break;
+    /* NuSMV: add end */
     default:
 	return(0);
     }
@@ -3429,6 +3536,11 @@ Cudd_RemoveHook(
     case CUDD_POST_REORDERING_HOOK:
 	hook = &(dd->postReorderingHook);
 	break;
+    /* NuSMV: add begin */
+    case CUDD_MEM_BUDGET_HOOK:
+	hook = &(dd->memBudgetHook);
+	break;
+    /* NuSMV: add end */
     default:
 	return(0);
     }
@@ -3482,6 +3594,11 @@ Cudd_IsInHook(
     case CUDD_POST_REORDERING_HOOK:
 	hook = dd->postReorderingHook;
 	break;
+    /* NuSMV: add begin */
+    case CUDD_MEM_BUDGET_HOOK:
+	hook = dd->memBudgetHook;
+	break;
+    /* NuSMV: add end */
     default:
 	return(0);
     }
@@ -3992,6 +4109,113 @@ Cudd_SetMaxMemory(
 } /* end of Cudd_SetMaxMemory */
 
 
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Reads the memory budget of the manager.]
+
+  Description [Reads the memory budget of the manager, in bytes. 0
+  means that no budget is set.]
+
+  SideEffects [none]
+
+  SeeAlso     [Cudd_SetMemoryBudget]
+
+******************************************************************************/
+ptruint
+Cudd_ReadMemoryBudget(
+  DdManager *dd)
+{
+    return(dd->memBudget);
+
+} /* end of Cudd_ReadMemoryBudget */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Sets the memory budget of the manager.]
+
+  Description [Sets a soft limit, in bytes, on the memory used by the
+  manager as reported by Cudd_ReadMemoryInUse; 0 removes the budget.
+  Unlike the limit set by Cudd_SetMaxMemory, the budget never makes an
+  operation fail. When allocating a new page of nodes would bring the
+  manager within DD_MEM_BUDGET_FRAC of the budget, the package first
+  collects garbage, shrinks the computed table and gives the pages
+  holding no live node back to the system. If this is not enough, the
+  hooks registered with CUDD_MEM_BUDGET_HOOK are called; they may
+  dereference diagrams they cache, but must not build new ones. When
+  memory still cannot be reclaimed, the package goes on allocating and
+  only tries again after a further DD_MEM_BUDGET_STEP of the budget has
+  been used, so that a budget too small for the live diagrams does not
+  turn every allocation into a garbage collection. The computed table
+  is not grown past the budget either.]
+
+  SideEffects [none]
+
+  SeeAlso     [Cudd_ReadMemoryBudget Cudd_ReleaseMemory Cudd_AddHook
+  Cudd_SetMaxMemory]
+
+******************************************************************************/
+void
+Cudd_SetMemoryBudget(
+  DdManager *dd,
+  ptruint budget)
+{
+    dd->memBudget = budget;
+    dd->memBudgetTrigger = (ptruint) (budget * DD_MEM_BUDGET_FRAC);
+
+} /* end of Cudd_SetMemoryBudget */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads the number of memory reclamations.]
+
+  Description [Returns the number of times the manager reclaimed memory
+  because it was close to its memory budget.]
+
+  SideEffects [none]
+
+  SeeAlso     [Cudd_SetMemoryBudget]
+
+******************************************************************************/
+int
+Cudd_ReadMemoryBudgetEvents(
+  DdManager *dd)
+{
+    return(dd->memBudgetEvents);
+
+} /* end of Cudd_ReadMemoryBudgetEvents */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Gives unused memory back to the system.]
+
+  Description [Collects garbage, shrinks the computed table to its
+  initial size and frees the pages of the node pool that hold no live
+  node. Returns the number of bytes by which the memory in use
+  decreased. The memory budget hooks are not called. This can be
+  called at any time outside of a DD operation, e.g. after the
+  application released large diagrams. Since freed pages no longer
+  count, Cudd_ReadPeakNodeCount reports the size of the remaining
+  node pool afterwards.]
+
+  SideEffects [Clears the computed table.]
+
+  SeeAlso     [Cudd_SetMemoryBudget Cudd_ReadMemoryInUse]
+
+******************************************************************************/
+ptruint
+Cudd_ReleaseMemory(
+  DdManager *dd)
+{
+    return(cuddReclaimMemory(dd, 1));
+
+} /* end of Cudd_ReleaseMemory */
+/* NuSMV: add end */
+
+
 /**Function********************************************************************
 
   Synopsis    [Prevents sifting of a variable.]
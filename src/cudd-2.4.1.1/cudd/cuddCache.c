@@ -6,7 +6,13 @@
 
   Synopsis    [Functions for cache insertion and lookup.]
 
-  Description [Internal procedures included in this module:
+  Description [External procedures included in this module:
+		<ul>
+		<li> Cudd_ReadCacheOpCount()
+		<li> Cudd_ReadCacheOpStats()
+		<li> Cudd_PrintCacheOpStats()
+		</ul>
+	    Internal procedures included in this module:
 		<ul>
 		<li> cuddInitCache()
 		<li> cuddCacheInsert()
@@ -23,7 +29,16 @@
 		</ul>
 	    Static procedures included in this module:
 		<ul>
-		</ul> ]
+		<li> ddCacheOpStatsFind()
+		<li> ddCacheEntryOp()
+		<li> ddCacheFind()
+		<li> ddCacheStore()
+		</ul>
+	    The computed table is two-way set associative: the hash
+	    value selects a pair of adjacent entries, the first holding
+	    the most recently used result. Results of the expensive
+	    relational product operators are preferred over cheaper ones
+	    when one of the two entries has to be evicted.]
 
   SeeAlso     []
 
@@ -74,6 +89,11 @@
 #define DD_HYSTO_BINS 8
 #endif
 
+/* NuSMV: add begin */
+/* Shift mapping an operator key to its statistics slot. */
+#define DD_CACHE_OP_SHIFT (sizeof(int) * 8 - DD_CACHE_OP_LOG)
+/* NuSMV: add end */
+
 /*---------------------------------------------------------------------------*/
 /* Stucture declarations                                                     */
 /*---------------------------------------------------------------------------*/
@@ -96,6 +116,11 @@ static char rcsid[] DD_UNUSED = "$Id: cuddCache.c,v 1.1.2.1 2010-02-04 10:41:15
 /* Macro declarations                                                        */
 /*---------------------------------------------------------------------------*/
 
+/* NuSMV: add begin */
+/* Operators whose results are retained in preference to others. */
+#define ddCacheIsPriority(op) ((op) == DD_BDD_AND_ABSTRACT_TAG || \
+			       (op) == DD_BDD_XOR_EXIST_ABSTRACT_TAG)
+/* NuSMV: add end */
 
 /**AutomaticStart*************************************************************/
 
@@ -103,6 +128,10 @@ static char rcsid[] DD_UNUSED = "$Id: cuddCache.c,v 1.1.2.1 2010-02-04 10:41:15
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
+static DdCacheOpStats * ddCacheOpStatsFind (DdManager *table, ptruint op);
+static ptruint ddCacheEntryOp (DdCache *entry);
+static DdCache * ddCacheFind (DdManager *table, int posn, DdNode *f, DdNode *g, ptruint h);
+static void ddCacheStore (DdManager *table, ptruint op, int posn, DdNode *f, DdNode *g, ptruint h, DdNode *data);
 
 /**AutomaticEnd***************************************************************/
 
@@ -111,6 +140,187 @@ static char rcsid[] DD_UNUSED = "$Id: cuddCache.c,v 1.1.2.1 2010-02-04 10:41:15
 /* Definition of exported functions                                          */
 /*---------------------------------------------------------------------------*/
 
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of operators with computed table
+  statistics.]
+
+  Description [Returns the number of distinct operators that have
+  accessed the computed table since the manager was created. Operators
+  beyond the capacity of the statistics table are accounted together
+  as a single extra entry.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_ReadCacheOpStats Cudd_PrintCacheOpStats]
+
+******************************************************************************/
+int
+Cudd_ReadCacheOpCount(
+  DdManager * dd)
+{
+    int i, count = 0;
+
+    for (i = 0; i <= DD_CACHE_OP_SLOTS; i++) {
+	count += dd->cacheOpStats[i].lookups + dd->cacheOpStats[i].inserts > 0;
+    }
+    return(count);
+
+} /* end of Cudd_ReadCacheOpCount */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads the computed table statistics of one operator.]
+
+  Description [Reads the statistics of the i-th operator, with i
+  between 0 and Cudd_ReadCacheOpCount(dd) - 1. name is set to a
+  readable name for the operator, or to NULL if the operator is not one
+  of the standard CUDD operators; op is set to the key the operator
+  uses in the computed table. Any of the result pointers may be NULL.
+  Returns 1 if successful; 0 if i is out of range.]
+
+  SideEffects [Sets the values pointed to by the non-NULL arguments.]
+
+  SeeAlso     [Cudd_ReadCacheOpCount Cudd_PrintCacheOpStats]
+
+******************************************************************************/
+int
+Cudd_ReadCacheOpStats(
+  DdManager * dd,
+  int i,
+  const char ** name,
+  ptruint * op,
+  double * lookups,
+  double * hits,
+  double * inserts,
+  double * evictions)
+{
+    static const struct {
+	ptruint op;
+	const char *name;
+    } names[] = {
+	{DD_ADD_ITE_TAG, "addIte"},
+	{DD_BDD_AND_ABSTRACT_TAG, "bddAndAbstract"},
+	{DD_BDD_XOR_EXIST_ABSTRACT_TAG, "bddXorExistAbstract"},
+	{DD_BDD_ITE_TAG, "bddIte"},
+	{DD_ADD_BDD_DO_INTERVAL_TAG, "addBddInterval"},
+	{DD_BDD_CLIPPING_AND_ABSTRACT_UP_TAG, "bddClippingAndAbstractUp"},
+	{DD_BDD_CLIPPING_AND_ABSTRACT_DOWN_TAG, "bddClippingAndAbstractDown"},
+	{DD_BDD_COMPOSE_RECUR_TAG, "bddCompose"},
+	{DD_ADD_COMPOSE_RECUR_TAG, "addCompose"},
+	{DD_ADD_NON_SIM_COMPOSE_TAG, "addNonSimCompose"},
+	{DD_EQUIV_DC_TAG, "equivDC"},
+	{DD_ZDD_ITE_TAG, "zddIte"},
+	{DD_ADD_ITE_CONSTANT_TAG, "addIteConstant"},
+	{DD_ADD_EVAL_CONST_TAG, "addEvalConst"},
+	{DD_BDD_ITE_CONSTANT_TAG, "bddIteConstant"},
+	{DD_ADD_OUT_SUM_TAG, "addOuterSum"},
+	{DD_BDD_LEQ_UNLESS_TAG, "bddLeqUnless"},
+	{DD_ADD_TRIANGLE_TAG, "addTriangle"},
+	{(ptruint) Cudd_bddAnd, "bddAnd"},
+	{(ptruint) Cudd_bddXor, "bddXor"},
+	{(ptruint) Cudd_bddExistAbstract, "bddExistAbstract"},
+	{(ptruint) Cudd_bddRestrict, "bddRestrict"},
+	{(ptruint) Cudd_bddConstrain, "bddConstrain"},
+	{(ptruint) Cudd_bddVarMap, "bddVarMap"},
+	{(ptruint) Cudd_bddLeq, "bddLeq"},
+	{(ptruint) Cudd_bddIntersect, "bddIntersect"},
+	{(ptruint) Cudd_bddNPAnd, "bddNPAnd"},
+	{(ptruint) Cudd_bddSqueeze, "bddSqueeze"},
+	{(ptruint) Cudd_Cofactor, "cofactor"},
+	{(ptruint) Cudd_addRestrict, "addRestrict"},
+	{(ptruint) Cudd_addConstrain, "addConstrain"},
+	{(ptruint) Cudd_addCmpl, "addCmpl"},
+	{0, NULL}
+    };
+    DdCacheOpStats *stats;
+    int j, k;
+
+    if (i < 0) return(0);
+    stats = NULL;
+    for (j = 0, k = 0; j <= DD_CACHE_OP_SLOTS; j++) {
+	if (dd->cacheOpStats[j].lookups + dd->cacheOpStats[j].inserts > 0) {
+	    if (k == i) {
+		stats = &dd->cacheOpStats[j];
+		break;
+	    }
+	    k++;
+	}
+    }
+    if (stats == NULL) return(0);
+
+    if (name != NULL) {
+	*name = NULL;
+	if (j == DD_CACHE_OP_SLOTS) {
+	    *name = "other";
+	} else {
+	    for (k = 0; names[k].name != NULL; k++) {
+		if (names[k].op == stats->op) {
+		    *name = names[k].name;
+		    break;
+		}
+	    }
+	}
+    }
+    if (op != NULL) *op = stats->op;
+    if (lookups != NULL) *lookups = stats->lookups;
+    if (hits != NULL) *hits = stats->hits;
+    if (inserts != NULL) *inserts = stats->inserts;
+    if (evictions != NULL) *evictions = stats->evictions;
+    return(1);
+
+} /* end of Cudd_ReadCacheOpStats */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Prints the computed table statistics of each operator.]
+
+  Description [Prints one line per operator with the number of
+  lookups, the hit rate, and the number of insertions and of results
+  evicted by later insertions. Returns 1 if successful; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_ReadCacheOpStats Cudd_PrintInfo]
+
+******************************************************************************/
+int
+Cudd_PrintCacheOpStats(
+  DdManager * dd,
+  FILE * fp)
+{
+    int i, n, retval;
+    const char *name;
+    ptruint op;
+    double lookups, hits, inserts, evictions;
+
+    retval = fprintf(fp,"**** Computed table statistics by operator ****\n");
+    if (retval == EOF) return(0);
+    retval = fprintf(fp,"%-28s %14s %8s %14s %14s\n", "Operator",
+		     "Lookups", "Hit %", "Inserts", "Evictions");
+    if (retval == EOF) return(0);
+    n = Cudd_ReadCacheOpCount(dd);
+    for (i = 0; i < n; i++) {
+	(void) Cudd_ReadCacheOpStats(dd, i, &name, &op, &lookups, &hits,
+				     &inserts, &evictions);
+	if (name != NULL) {
+	    retval = fprintf(fp,"%-28s", name);
+	} else {
+	    retval = fprintf(fp,"op@0x%-23lx", (unsigned long) op);
+	}
+	if (retval == EOF) return(0);
+	retval = fprintf(fp," %14.0f %8.2f %14.0f %14.0f\n", lookups,
+			 lookups > 0 ? 100.0 * hits / lookups : 0.0,
+			 inserts, evictions);
+	if (retval == EOF) return(0);
+    }
+    return(1);
+
+} /* end of Cudd_PrintCacheOpStats */
+
+
 /*---------------------------------------------------------------------------*/
 /* Definition of internal functions                                          */
 /*---------------------------------------------------------------------------*/
@@ -166,6 +376,9 @@ cuddInitCache(
 #endif
     unique->cacheSlots = cacheSize;
     unique->cacheShift = sizeof(int) * 8 - logSize;
+    /* NuSMV: add begin */
+    unique->minCacheSlots = cacheSize;
+    /* NuSMV: add end */
     unique->maxCacheHard = maxCacheSize;
     /* If cacheSlack is non-negative, we can resize. */
     unique->cacheSlack = (int) ddMin(maxCacheSize,
@@ -184,6 +397,9 @@ cuddInitCache(
     unique->cacheinserts = 0;
     unique->cacheLastInserts = 0;
     unique->cachedeletions = 0;
+    /* NuSMV: add begin */
+    memset(unique->cacheOpStats, 0, sizeof(unique->cacheOpStats));
+    /* NuSMV: add end */
 
     /* Initialize the cache */
     for (i = 0; (unsigned) i < cacheSize; i++) {
@@ -220,7 +436,6 @@ cuddCacheInsert(
   DdNode * data)
 {
     int posn;
-    register DdCache *entry;
     ptruint uf, ug, uh;
 
     uf = (ptruint) f | (op & 0xe);
@@ -228,18 +443,7 @@ cuddCacheInsert(
     uh = (ptruint) h;
 
     posn = ddCHash2(uh,uf,ug,table->cacheShift);
-    entry = &table->cache[posn];
-
-    table->cachecollisions += entry->data != NULL;
-    table->cacheinserts++;
-
-    entry->f    = (DdNode *) uf;
-    entry->g    = (DdNode *) ug;
-    entry->h    = uh;
-    entry->data = data;
-#ifdef DD_CACHE_PROFILE
-    entry->count++;
-#endif
+    ddCacheStore(table,op,posn,(DdNode *) uf,(DdNode *) ug,uh,data);
 
 } /* end of cuddCacheInsert */
 
@@ -265,23 +469,9 @@ cuddCacheInsert2(
   DdNode * data)
 {
     int posn;
-    register DdCache *entry;
 
     posn = ddCHash2(op,f,g,table->cacheShift);
-    entry = &table->cache[posn];
-
-    if (entry->data != NULL) {
-        table->cachecollisions++;
-    }
-    table->cacheinserts++;
-
-    entry->f = f;
-    entry->g = g;
-    entry->h = (ptruint) op;
-    entry->data = data;
-#ifdef DD_CACHE_PROFILE
-    entry->count++;
-#endif
+    ddCacheStore(table,(ptruint) op,posn,f,g,(ptruint) op,data);
 
 } /* end of cuddCacheInsert2 */
 
@@ -306,23 +496,9 @@ cuddCacheInsert1(
   DdNode * data)
 {
     int posn;
-    register DdCache *entry;
 
     posn = ddCHash2(op,f,f,table->cacheShift);
-    entry = &table->cache[posn];
-
-    if (entry->data != NULL) {
-        table->cachecollisions++;
-    }
-    table->cacheinserts++;
-
-    entry->f = f;
-    entry->g = f;
-    entry->h = (ptruint) op;
-    entry->data = data;
-#ifdef DD_CACHE_PROFILE
-    entry->count++;
-#endif
+    ddCacheStore(table,(ptruint) op,posn,f,f,(ptruint) op,data);
 
 } /* end of cuddCacheInsert1 */
 
@@ -349,27 +525,29 @@ cuddCacheLookup(
   DdNode * h)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
     ptruint uf, ug, uh;
 
     uf = (ptruint) f | (op & 0xe);
     ug = (ptruint) g | (op >> 4);
     uh = (ptruint) h;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,op);
+    stats->lookups++;
     posn = ddCHash2(uh,uf,ug,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==(DdNodePtr)uf && en->g==(DdNodePtr)ug &&
-	en->h==uh) {
+    en = ddCacheFind(table,posn,(DdNodePtr)uf,(DdNodePtr)ug,uh);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaim(table,data);
 	}
@@ -411,27 +589,29 @@ cuddCacheLookupZdd(
   DdNode * h)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
     ptruint uf, ug, uh;
 
     uf = (ptruint) f | (op & 0xe);
     ug = (ptruint) g | (op >> 4);
     uh = (ptruint) h;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,op);
+    stats->lookups++;
     posn = ddCHash2(uh,uf,ug,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==(DdNodePtr)uf && en->g==(DdNodePtr)ug &&
-	en->h==uh) {
+    en = ddCacheFind(table,posn,(DdNodePtr)uf,(DdNodePtr)ug,uh);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaimZdd(table,data);
 	}
@@ -472,21 +652,24 @@ cuddCacheLookup2(
   DdNode * g)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,(ptruint) op);
+    stats->lookups++;
     posn = ddCHash2(op,f,g,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==f && en->g==g && en->h==(ptruint)op) {
+    en = ddCacheFind(table,posn,f,g,(ptruint) op);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaim(table,data);
 	}
@@ -525,21 +708,24 @@ cuddCacheLookup1(
   DdNode * f)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,(ptruint) op);
+    stats->lookups++;
     posn = ddCHash2(op,f,f,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==f && en->h==(ptruint)op) {
+    en = ddCacheFind(table,posn,f,f,(ptruint) op);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaim(table,data);
 	}
@@ -580,21 +766,24 @@ cuddCacheLookup2Zdd(
   DdNode * g)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,(ptruint) op);
+    stats->lookups++;
     posn = ddCHash2(op,f,g,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==f && en->g==g && en->h==(ptruint)op) {
+    en = ddCacheFind(table,posn,f,g,(ptruint) op);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaimZdd(table,data);
 	}
@@ -633,21 +822,24 @@ cuddCacheLookup1Zdd(
   DdNode * f)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
     DdNode *data;
+    DdCacheOpStats *stats;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
 
+    stats = ddCacheOpStatsFind(table,(ptruint) op);
+    stats->lookups++;
     posn = ddCHash2(op,f,f,table->cacheShift);
-    en = &cache[posn];
-    if (en->data != NULL && en->f==f && en->h==(ptruint)op) {
+    en = ddCacheFind(table,posn,f,f,(ptruint) op);
+    if (en != NULL) {
 	data = Cudd_Regular(en->data);
 	table->cacheHits++;
+	stats->hits++;
 	if (data->ref == 0) {
 	    cuddReclaimZdd(table,data);
 	}
@@ -692,28 +884,30 @@ cuddConstantLookup(
   DdNode * h)
 {
     int posn;
-    DdCache *en,*cache;
+    DdCache *en;
+    DdCacheOpStats *stats;
     ptruint uf, ug, uh;
 
     uf = (ptruint) f | (op & 0xe);
     ug = (ptruint) g | (op >> 4);
     uh = (ptruint) h;
 
-    cache = table->cache;
 #ifdef DD_DEBUG
-    if (cache == NULL) {
+    if (table->cache == NULL) {
         return(NULL);
     }
 #endif
+    stats = ddCacheOpStatsFind(table,op);
+    stats->lookups++;
     posn = ddCHash2(uh,uf,ug,table->cacheShift);
-    en = &cache[posn];
+    en = ddCacheFind(table,posn,(DdNodePtr)uf,(DdNodePtr)ug,uh);
 
     /* We do not reclaim here because the result should not be
      * referenced, but only tested for being a constant.
      */
-    if (en->data != NULL &&
-	en->f == (DdNodePtr)uf && en->g == (DdNodePtr)ug && en->h == uh) {
+    if (en != NULL) {
 	table->cacheHits++;
+	stats->hits++;
         return(en->data);
     }
 
@@ -919,6 +1113,21 @@ cuddCacheResize(
     oldcache = table->cache;
     oldacache = table->acache;
     oldslots = table->cacheSlots;
+
+    /* NuSMV: add begin */
+    /* Do not let the computed table push the manager past its memory
+    ** budget. The slack is recomputed when the unique table grows, so
+    ** resizing is attempted again once the budget allows it. */
+    if (table->memused + (oldslots + 1) * sizeof(DdCache) >
+	table->maxmemhard ||
+	(table->memBudget != 0 &&
+	 table->memused + (oldslots + 1) * sizeof(DdCache) >
+	 table->memBudget)) {
+	table->cacheSlack = - (int) (oldslots + 1);
+	return;
+    }
+    /* NuSMV: add end */
+
     slots = table->cacheSlots = oldslots << 1;
 
 #ifdef DD_VERBOSE
@@ -976,7 +1185,9 @@ cuddCacheResize(
 	old = &oldcache[i];
 	if (old->data != NULL) {
 	    posn = ddCHash2(old->h,old->f,old->g,shift);
-	    entry = &cache[posn];
+	    entry = &cache[posn & ~1];
+	    if (entry->data != NULL) entry++;
+	    if (entry->data != NULL) continue;
 	    entry->f = old->f;
 	    entry->g = old->g;
 	    entry->h = old->h;
@@ -1003,6 +1214,83 @@ cuddCacheResize(
 } /* end of cuddCacheResize */
 
 
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Shrinks the cache.]
+
+  Description [Reallocates the cache with the given number of slots,
+  rounded down to a power of 2, but not less than its initial size.
+  The entries are not preserved. Returns the number of bytes freed; 0
+  if the cache was not shrunk, either because it is already small
+  enough or because allocation failed.]
+
+  SideEffects [Clears the cache.]
+
+  SeeAlso     [cuddCacheResize cuddReclaimMemory]
+
+******************************************************************************/
+ptruint
+cuddCacheShrink(
+  DdManager * table,
+  unsigned int slots)
+{
+    DdCache *cache;
+    unsigned int i, oldslots;
+    int logSize;
+    double offset;
+#ifndef DD_CACHE_PROFILE
+    ptruint misalignment;
+    DdNodePtr *mem;
+#endif
+
+    oldslots = table->cacheSlots;
+    if (slots < table->minCacheSlots) slots = table->minCacheSlots;
+    logSize = cuddComputeFloorLog2(slots);
+    slots = 1 << logSize;
+    if (slots >= oldslots) return(0);
+
+    cache = ALLOC(DdCache,slots+1);
+    if (cache == NULL) return(0);
+    FREE(table->acache);
+    table->acache = cache;
+#ifdef DD_CACHE_PROFILE
+    table->cache = cache;
+#else
+    mem = (DdNodePtr *) cache;
+    misalignment = (ptruint) mem & (sizeof(DdCache) - 1);
+    mem += (sizeof(DdCache) - misalignment) / sizeof(DdNodePtr);
+    table->cache = cache = (DdCache *) mem;
+    assert(((ptruint) table->cache & (sizeof(DdCache) - 1)) == 0);
+#endif
+    table->cacheSlots = slots;
+    table->cacheShift = sizeof(int) * 8 - logSize;
+    table->memused -= (oldslots - slots) * sizeof(DdCache);
+    /* The slack is the cache size limit minus twice the size. */
+    table->cacheSlack += 2 * (int) (oldslots - slots);
+
+    for (i = 0; i < slots; i++) {
+	cache[i].data = NULL;
+	cache[i].h = 0;
+#ifdef DD_CACHE_PROFILE
+	cache[i].count = 0;
+#endif
+    }
+
+    /* As in cuddCacheResize, avoid immediate resizing. */
+    offset = (double) (int) (slots * table->minHit + 1);
+    table->totCacheMisses += table->cacheMisses - offset;
+    table->cacheMisses = offset;
+    table->totCachehits += table->cacheHits;
+    table->cacheHits = 0;
+    table->cacheLastInserts = table->cacheinserts;
+
+    return((oldslots - slots) * sizeof(DdCache));
+
+} /* end of cuddCacheShrink */
+/* NuSMV: add end */
+
+
 /**Function********************************************************************
 
   Synopsis    [Flushes the cache.]
@@ -1065,3 +1353,167 @@ cuddComputeFloorLog2(
 /*---------------------------------------------------------------------------*/
 /* Definition of static functions                                            */
 /*---------------------------------------------------------------------------*/
+
+
+/**Function********************************************************************
+
+  Synopsis    [Finds the statistics record of an operator.]
+
+  Description [Finds the statistics record of the operator with the
+  given key, which is either the tag of a three-operand operator or the
+  address of the function of a one- or two-operand operator. A record
+  is claimed the first time an operator is seen; once all records are
+  taken, further operators share the overflow record.]
+
+  SideEffects [None]
+
+  SeeAlso     [ddCacheEntryOp]
+
+******************************************************************************/
+static DdCacheOpStats *
+ddCacheOpStatsFind(
+  DdManager * table,
+  ptruint op)
+{
+    DdCacheOpStats *stats = table->cacheOpStats;
+    unsigned int i, j;
+
+    i = ((unsigned) op * DD_P1) >> DD_CACHE_OP_SHIFT;
+    for (j = 0; j < DD_CACHE_OP_SLOTS; j++) {
+	if (stats[i].op == op) return(&stats[i]);
+	if (stats[i].op == 0) {
+	    stats[i].op = op;
+	    return(&stats[i]);
+	}
+	i = (i + 1) & (DD_CACHE_OP_SLOTS - 1);
+    }
+    return(&stats[DD_CACHE_OP_SLOTS]);
+
+} /* end of ddCacheOpStatsFind */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the operator key of a valid cache entry.]
+
+  Description [Three-operand operators keep their tag in Bits 3:1 of
+  the f and g fields, with Bit 1 of f always set; the other operators
+  keep their function address in the h field.]
+
+  SideEffects [None]
+
+  SeeAlso     [ddCacheOpStatsFind]
+
+******************************************************************************/
+static ptruint
+ddCacheEntryOp(
+  DdCache * entry)
+{
+    if ((ptruint) entry->f & 0x2) {
+	return(((ptruint) entry->f & 0xe) | (((ptruint) entry->g & 0xe) << 4));
+    }
+    return(entry->h);
+
+} /* end of ddCacheEntryOp */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Looks up a key in the set selected by posn.]
+
+  Description [Returns the entry holding the key, or NULL if neither
+  entry of the set holds it. A hit in the second entry is swapped into
+  the first one, so that the first entry of a set is always the most
+  recently used.]
+
+  SideEffects [May swap the two entries of the set.]
+
+  SeeAlso     [ddCacheStore]
+
+******************************************************************************/
+static DdCache *
+ddCacheFind(
+  DdManager * table,
+  int posn,
+  DdNode * f,
+  DdNode * g,
+  ptruint h)
+{
+    DdCache *set = &table->cache[posn & ~1];
+    DdCache tmp;
+
+    if (set[0].data != NULL && set[0].f == f && set[0].g == g &&
+	set[0].h == h) {
+	return(&set[0]);
+    }
+    if (set[1].data != NULL && set[1].f == f && set[1].g == g &&
+	set[1].h == h) {
+	tmp = set[0];
+	set[0] = set[1];
+	set[1] = tmp;
+	return(&set[0]);
+    }
+    return(NULL);
+
+} /* end of ddCacheFind */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Stores a result in the set selected by posn.]
+
+  Description [The new result goes to the first entry of the set and
+  the previous first entry moves to the second one, evicting its
+  content. When the second entry holds the result of a priority
+  operator and the first does not, the first entry is replaced instead,
+  so that expensive results survive bursts of cheap ones.]
+
+  SideEffects [None]
+
+  SeeAlso     [ddCacheFind]
+
+******************************************************************************/
+static void
+ddCacheStore(
+  DdManager * table,
+  ptruint op,
+  int posn,
+  DdNode * f,
+  DdNode * g,
+  ptruint h,
+  DdNode * data)
+{
+    DdCache *set = &table->cache[posn & ~1];
+    DdCache *entry = &set[0];
+
+    table->cacheinserts++;
+    ddCacheOpStatsFind(table,op)->inserts++;
+
+    if (set[0].data != NULL &&
+	!(set[0].f == f && set[0].g == g && set[0].h == h)) {
+	if (set[1].data != NULL && set[1].f == f && set[1].g == g &&
+	    set[1].h == h) {
+	    entry = &set[1];
+	} else if (set[1].data != NULL &&
+		   ddCacheIsPriority(ddCacheEntryOp(&set[1])) &&
+		   !ddCacheIsPriority(ddCacheEntryOp(&set[0]))) {
+	    table->cachecollisions++;
+	    ddCacheOpStatsFind(table,ddCacheEntryOp(&set[0]))->evictions++;
+	} else {
+	    if (set[1].data != NULL) {
+		table->cachecollisions++;
+		ddCacheOpStatsFind(table,ddCacheEntryOp(&set[1]))->evictions++;
+	    }
+	    set[1] = set[0];
+	}
+    }
+
+    entry->f = f;
+    entry->g = g;
+    entry->h = h;
+    entry->data = data;
+#ifdef DD_CACHE_PROFILE
+    entry->count++;
+#endif
+
+} /* end of ddCacheStore */
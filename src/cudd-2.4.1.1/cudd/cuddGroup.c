@@ -780,8 +780,13 @@ ddGroupSifting(
 
     /* Now sift. */
     for (i = 0; i < ddMin(table->siftMaxVar,classes); i++) {
-	if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	/* NuSMV: add begin */
+	if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+	    ddReorderTimedOut(table))
 	    break;
+	/* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	            break; */
+	/* NuSMV: add end */
 	xindex = var[i];
 	if (sifted[xindex] == 1) /* variable already sifted as part of group */
 	    continue;
@@ -1260,8 +1265,11 @@ ddGroupSiftingUp(
 	    if (pr > 0) (void) fprintf(table->out,
 				       "ddGroupSiftingUp (2 single groups):\n");
 #endif
-            if ((double) size > (double) limitSize * table->maxGrowth)
+            /* NuSMV: add begin */
+            if ((double) size > (double) limitSize * table->maxGrowth ||
+                ddReorderTimedOut(table))
 		return(1);
+            /* NuSMV: add end */
             if (size < limitSize) limitSize = size;
         } else { /* Group move */
             size = ddGroupMove(table,x,y,moves);
@@ -1276,8 +1284,11 @@ ddGroupSiftingUp(
 		}
 		z = table->subtables[z].next;
 	    } while (z != (int) (*moves)->y);
-            if ((double) size > (double) limitSize * table->maxGrowth)
+            /* NuSMV: add begin */
+            if ((double) size > (double) limitSize * table->maxGrowth ||
+                ddReorderTimedOut(table))
 		return(1);
+            /* NuSMV: add end */
             if (size < limitSize) limitSize = size;
         }
         y = gxtop;
@@ -1422,8 +1433,11 @@ ddGroupSiftingDown(
             if (pr > 0) (void) fprintf(table->out,
 				       "ddGroupSiftingDown (2 single groups):\n");
 #endif
-            if ((double) size > (double) limitSize * table->maxGrowth)
+            /* NuSMV: add begin */
+            if ((double) size > (double) limitSize * table->maxGrowth ||
+                ddReorderTimedOut(table))
                 return(1);
+            /* NuSMV: add end */
             if (size < limitSize) limitSize = size;
 
             x = y;
@@ -1442,8 +1456,11 @@ ddGroupSiftingDown(
 	    } while (z <= gybot);
             size = ddGroupMove(table,x,y,moves);
             if (size == 0) goto ddGroupSiftingDownOutOfMem;
-            if ((double) size > (double) limitSize * table->maxGrowth)
+            /* NuSMV: add begin */
+            if ((double) size > (double) limitSize * table->maxGrowth ||
+                ddReorderTimedOut(table))
 		return(1);
+            /* NuSMV: add end */
             if (size < limitSize) limitSize = size;
 
 	    /* Update upper bound on node decrease: second phase. */
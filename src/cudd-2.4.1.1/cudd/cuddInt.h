@@ -143,6 +143,12 @@ extern "C" {
 #define DD_STASH_FRACTION	64 /* 1 / (fraction of memory set
 				      aside for emergencies) */
 #define DD_MAX_CACHE_TO_SLOTS_RATIO 4 /* used to limit the cache size */
+/* NuSMV: add begin */
+#define DD_MEM_BUDGET_FRAC	0.9	/* fraction of the memory budget at
+					   which memory is reclaimed */
+#define DD_MEM_BUDGET_STEP	0.1	/* fraction of the budget to use before
+					   reclaiming again after a failure */
+/* NuSMV: add end */
 
 /* Variable ordering default parameter values. */
 #define DD_SIFT_MAX_VAR		1000
@@ -152,6 +158,12 @@ extern "C" {
 #define DD_FIRST_REORDER	4004	/* 4 for the constants */
 #define DD_DYN_RATIO		2	/* when to dynamically reorder */
 
+/* NuSMV: add begin */
+/* Capacity of the per-operator computed table statistics. */
+#define DD_CACHE_OP_LOG		6
+#define DD_CACHE_OP_SLOTS	(1 << DD_CACHE_OP_LOG)
+/* NuSMV: add end */
+
 /* Primes for cache hash functions. */
 #define DD_P1			12582917
 #define DD_P2			4256249
@@ -301,6 +313,17 @@ typedef struct DdHashTable {
     DdManager *manager;
 } DdHashTable;
 
+/* NuSMV: add begin */
+/* Computed table statistics for one operator. */
+typedef struct DdCacheOpStats {
+    ptruint op;			/* tag or function address; 0 if unused */
+    double lookups;		/* number of lookups */
+    double hits;		/* number of lookups that found a result */
+    double inserts;		/* number of results stored */
+    double evictions;		/* results discarded by later insertions */
+} DdCacheOpStats;
+/* NuSMV: add end */
+
 typedef struct DdCache {
     DdNode *f,*g;		/* DDs */
     ptruint h;			/* either operator or DD */
@@ -348,6 +371,10 @@ struct DdManager {	/* specialized DD symbol table */
     double minHit;		/* hit percentage above which to resize */
     int cacheSlack;		/* slots still available for resizing */
     unsigned int maxCacheHard;	/* hard limit for cache size */
+    /* NuSMV: add begin */
+    DdCacheOpStats cacheOpStats[DD_CACHE_OP_SLOTS+1]; /* per operator,
+						      ** plus overflow */
+    /* NuSMV: add end */
     /* Unique Table */
     int size;			/* number of unique subtables */
     int sizeZ;			/* for ZDD */
@@ -400,6 +427,12 @@ struct DdManager {	/* specialized DD symbol table */
     int reorderings;		/* number of calls to Cudd_ReduceHeap */
     int siftMaxVar;		/* maximum number of vars sifted */
     int siftMaxSwap;		/* maximum number of swaps per sifting */
+    /* NuSMV: add begin */
+    long reordTimeLimit;	/* ms allowed to one reordering, 0 = none */
+    long reordTotalLimit;	/* ms allowed to automatic reordering,
+				** 0 = none */
+    long reordStartTime;	/* start of the current reordering */
+    /* NuSMV: add end */
     double maxGrowth;		/* maximum growth during reordering */
     double maxGrowthAlt;	/* alternate maximum growth for reordering */
     int reordCycle;		/* how often to apply alternate threshold */
@@ -428,6 +461,9 @@ struct DdManager {	/* specialized DD symbol table */
     DdHook *postGCHook;		/* hooks to be called after GC */
     DdHook *preReorderingHook;	/* hooks to be called before reordering */
     DdHook *postReorderingHook;	/* hooks to be called after reordering */
+    /* NuSMV: add begin */
+    DdHook *memBudgetHook;	/* hooks called when over memory budget */
+    /* NuSMV: add end */
     FILE *out;			/* stdout for this manager */
     FILE *err;			/* stderr for this manager */
 #ifdef __osf__
@@ -445,6 +481,12 @@ struct DdManager {	/* specialized DD symbol table */
             unsigned long maxmem;	target maximum memory 
             unsigned long maxmemhard;	hard limit for maximum memory */
   /* NuSMV: add end */
+  /* NuSMV: add begin */
+    ptruint memBudget;		/* soft limit for memory, 0 = none */
+    ptruint memBudgetTrigger;	/* memused at which memory is reclaimed */
+    int memBudgetEvents;	/* number of reclamations triggered */
+    unsigned int minCacheSlots;	/* the cache is not shrunk below this */
+  /* NuSMV: add end */
 
     int garbageCollections;	/* number of garbage collections */
     long GCTime;		/* total time spent in garbage collection */
@@ -778,6 +820,25 @@ typedef struct DdLevelQueue {
           #endif */
 /* NuSMV: add end */
 
+/* NuSMV: add begin */
+/**Macro***********************************************************************
+
+  Synopsis    [Checks whether the current reordering ran out of time.]
+
+  Description [Sifting algorithms test this after each swap. On
+  timeout the variable being sifted goes back to the best position
+  found for it, so stopping early keeps the best order seen so far.]
+
+  SideEffects [none]
+
+  SeeAlso     [Cudd_SetReorderingTimeLimit]
+
+******************************************************************************/
+#define ddReorderTimedOut(table)					\
+  ((table)->reordTimeLimit > 0 &&					\
+   util_cpu_time() - (table)->reordStartTime >= (table)->reordTimeLimit)
+/* NuSMV: add end */
+
 /**Macro***********************************************************************
 
   Synopsis    [Clears the 4 least significant bits of a pointer.]
@@ -1138,6 +1199,9 @@ extern DdNode * cuddCacheLookup1Zdd (DdManager *table, DdNode * (*)(DdManager *,
 extern DdNode * cuddConstantLookup (DdManager *table, ptruint op, DdNode *f, DdNode *g, DdNode *h);
 extern int cuddCacheProfile (DdManager *table, FILE *fp);
 extern void cuddCacheResize (DdManager *table);
+/* NuSMV: add begin */
+extern ptruint cuddCacheShrink (DdManager *table, unsigned int slots);
+/* NuSMV: add end */
 extern void cuddCacheFlush (DdManager *table);
 extern int cuddComputeFloorLog2 (unsigned int value);
 extern int cuddHeapProfile (DdManager *dd);
@@ -1223,6 +1287,9 @@ extern DdNode * cuddAllocNode (DdManager *unique);
 extern DdManager * cuddInitTable (unsigned int numVars, unsigned int numVarsZ, unsigned int numSlots, unsigned int looseUpTo);
 extern void cuddFreeTable (DdManager *unique);
 extern int cuddGarbageCollect (DdManager *unique, int clearCache);
+/* NuSMV: add begin */
+extern ptruint cuddReclaimMemory (DdManager *unique, int minimizeCache);
+/* NuSMV: add end */
 extern DdNode * cuddZddGetNode (DdManager *zdd, int id, DdNode *T, DdNode *E);
 extern DdNode * cuddZddGetNodeIVO (DdManager *dd, int index, DdNode *g, DdNode *h);
 extern DdNode * cuddUniqueInter (DdManager *unique, int index, DdNode *T, DdNode *E);
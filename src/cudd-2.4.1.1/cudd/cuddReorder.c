@@ -200,6 +200,9 @@ Cudd_ReduceHeap(
     table->reorderings++;
 
     localTime = util_cpu_time();
+    /* NuSMV: add begin */
+    table->reordStartTime = localTime;
+    /* NuSMV: add end */
 
     /* Run the hook functions. */
     hook = table->preReorderingHook;
@@ -557,8 +560,13 @@ cuddSifting(
 
     /* Now sift. */
     for (i = 0; i < ddMin(table->siftMaxVar,size); i++) {
-	if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	/* NuSMV: add begin */
+	if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+	    ddReorderTimedOut(table))
 	    break;
+	/* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	            break; */
+	/* NuSMV: add end */
 	x = table->perm[var[i]];
 
 	if (x < lower || x > upper || table->subtables[x].bindVar == 1) 
@@ -646,8 +654,13 @@ cuddSwapping(
     iterate = nvars;
 
     for (i = 0; i < iterate; i++) {
-	if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	/* NuSMV: add begin */
+	if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+	    ddReorderTimedOut(table))
 	    break;
+	/* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	            break; */
+	/* NuSMV: add end */
 	if (heuristic == CUDD_REORDER_RANDOM_PIVOT) {
 	    max = -1;
 	    for (j = lower; j <= upper; j++) {
@@ -1679,7 +1692,11 @@ ddSiftingUp(
 	move->size = size;
 	move->next = moves;
 	moves = move;
-	if ((double) size > (double) limitSize * table->maxGrowth) break;
+	/* NuSMV: add begin */
+	if ((double) size > (double) limitSize * table->maxGrowth ||
+	    ddReorderTimedOut(table)) break;
+	/* WAS: if ((double) size > (double) limitSize * table->maxGrowth) break; */
+	/* NuSMV: add end */
 	if (size < limitSize) limitSize = size;
 	y = x;
 	x = cuddNextLow(table,y);
@@ -1770,7 +1787,11 @@ ddSiftingDown(
 	move->size = size;
 	move->next = moves;
 	moves = move;
-	if ((double) size > (double) limitSize * table->maxGrowth) break;
+	/* NuSMV: add begin */
+	if ((double) size > (double) limitSize * table->maxGrowth ||
+	    ddReorderTimedOut(table)) break;
+	/* WAS: if ((double) size > (double) limitSize * table->maxGrowth) break; */
+	/* NuSMV: add end */
 	if (size < limitSize) limitSize = size;
 	x = y;
 	y = cuddNextHigh(table,x);
@@ -0,0 +1,932 @@
+/**CFile***********************************************************************
+
+  FileName    [cuddSnapshot.c]
+
+  PackageName [cudd]
+
+  Synopsis    [Binary snapshots of BDDs that can be mapped and reloaded
+  without parsing.]
+
+  Description [External procedures included in this file:
+		<ul>
+		<li> Cudd_SnapshotSave()
+		<li> Cudd_SnapshotOpen()
+		<li> Cudd_SnapshotClose()
+		<li> Cudd_SnapshotReadVarCount()
+		<li> Cudd_SnapshotReadVarName()
+		<li> Cudd_SnapshotReadVarLevel()
+		<li> Cudd_SnapshotReadRootCount()
+		<li> Cudd_SnapshotReadRootName()
+		<li> Cudd_SnapshotReadNodeCount()
+		<li> Cudd_SnapshotLoad()
+		</ul>
+	Static procedures included in this module:
+		<ul>
+		<li> ddSnapshotCollect()
+		<li> ddSnapshotRef()
+		<li> ddSnapshotWriteString()
+		<li> ddSnapshotReadString()
+		<li> ddSnapshotShuffle()
+		</ul>
+	A snapshot stores the nodes of a set of BDDs level by level,
+	from the deepest level to the topmost one, so that the children
+	of a node always precede it. Each node is a pair of 32-bit
+	references to its children: the reference of a node is its
+	position in the file (the constant one is 0) shifted left by
+	one, with the complement bit in the least significant bit.
+	The file layout is:
+		<ul>
+		<li> the header (DdSnapshotHeader);
+		<li> the level of each variable of the saving manager;
+		<li> for each non-empty level, the variable index and the
+		     number of nodes;
+		<li> the nodes, as (then, else) pairs;
+		<li> the references of the roots;
+		<li> the names of the variables and of the roots, as
+		     length-prefixed strings.
+		</ul>
+	All the numbers are stored in the byte order of the saving
+	machine, which is checked when the snapshot is opened. Since
+	the node array has a fixed layout, the file is memory mapped
+	when the platform allows it, and the nodes are inserted
+	directly in the unique table, without recursion nor cache
+	lookups, when the variable order is compatible.]
+
+  SeeAlso     [cuddExport.c]
+
+  Author      [NuSMV team]
+
+  Copyright   [This file is distributed under the same terms as the
+  rest of the CUDD package.]
+
+******************************************************************************/
+
+#include "util.h"
+#include "cuddInt.h"
+
+#if !defined(_WIN32)
+#define DD_SNAPSHOT_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+#define DD_SNAPSHOT_MAGIC "CUDDSNAP"
+#define DD_SNAPSHOT_VERSION 1
+#define DD_SNAPSHOT_ENDIAN 0x01020304
+
+/*---------------------------------------------------------------------------*/
+/* Stucture declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+typedef struct DdSnapshotHeader {
+    char magic[8];
+    unsigned int version;
+    unsigned int endian;
+    unsigned int nvars;
+    unsigned int nlevels;
+    unsigned int nroots;
+    unsigned int nnodes;
+} DdSnapshotHeader;
+
+struct DdSnapshot {
+    char *data;			/* mapped or read file contents */
+    size_t size;		/* size of data */
+    int mapped;			/* whether data is memory mapped */
+    DdSnapshotHeader header;
+    unsigned int *perm;		/* level of each saved variable */
+    unsigned int *levels;	/* (index, count) of each non-empty level */
+    unsigned int *nodes;	/* (then, else) of each node */
+    unsigned int *roots;	/* references of the roots */
+    char **varnames;		/* names of the variables, or NULL */
+    char **rootnames;		/* names of the roots, or NULL */
+};
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+#ifndef lint
+static char rcsid[] DD_UNUSED = "$Id: cuddSnapshot.c,v 1.1 nusmv Exp $";
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static int ddSnapshotCollect (DdManager *dd, DdNode *f, st_table *visited, unsigned int *counts);
+static unsigned int ddSnapshotRef (DdManager *dd, DdNode *f, st_table *ids);
+static int ddSnapshotWriteString (const char *s, FILE *fp);
+static char * ddSnapshotReadString (DdSnapshot *snap, size_t *offset);
+static int ddSnapshotShuffle (DdManager *dd, DdSnapshot *snap, int *varmap);
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of exported functions                                          */
+/*---------------------------------------------------------------------------*/
+
+
+/**Function********************************************************************
+
+  Synopsis    [Writes a snapshot of an array of BDDs to a file.]
+
+  Description [Writes the n BDDs in f to the file filename. The
+  shared nodes are stored only once. varnames, if not NULL, gives
+  the name of each variable of the manager, and rootnames, if not
+  NULL, the name of each BDD; both may contain NULL entries. Only
+  BDDs can be saved: the only constant allowed is the constant one.
+  Returns 1 if successful; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotOpen Cudd_SnapshotLoad]
+
+******************************************************************************/
+int
+Cudd_SnapshotSave(
+  DdManager * dd,
+  const char * filename,
+  int  n,
+  DdNode ** f,
+  char ** varnames,
+  char ** rootnames)
+{
+    DdSnapshotHeader header;
+    st_table *ids;
+    st_generator *gen;
+    DdNode *node;
+    char *value;
+    DdNode **sorted = NULL;
+    unsigned int *counts = NULL;
+    unsigned int *offsets = NULL;
+    unsigned int buf[2];
+    unsigned int nnodes, nlevels, id;
+    int i, level, index;
+    FILE *fp = NULL;
+    int ok = 0;
+
+    ids = st_init_table(st_ptrcmp, st_ptrhash);
+    if (ids == NULL) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	return(0);
+    }
+    counts = ALLOC(unsigned int, dd->size);
+    offsets = ALLOC(unsigned int, dd->size);
+    if (counts == NULL || offsets == NULL) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	goto cleanup;
+    }
+    for (i = 0; i < dd->size; i++) counts[i] = 0;
+
+    /* Collect the nodes and count them level by level. */
+    for (i = 0; i < n; i++) {
+	if (!ddSnapshotCollect(dd, f[i], ids, counts)) goto cleanup;
+    }
+
+    /* Assign the positions, from the deepest level up, so that
+    ** children always precede their parents. */
+    nnodes = 0;
+    nlevels = 0;
+    for (level = dd->size - 1; level >= 0; level--) {
+	index = dd->invperm[level];
+	offsets[index] = nnodes + 1;
+	nnodes += counts[index];
+	if (counts[index] > 0) nlevels++;
+    }
+    sorted = ALLOC(DdNode *, nnodes + 1);
+    if (sorted == NULL) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	goto cleanup;
+    }
+    gen = st_init_gen(ids);
+    while (st_gen(gen, (char **) &node, &value)) {
+	id = offsets[node->index]++;
+	sorted[id] = node;
+    }
+    st_free_gen(gen);
+    for (id = 1; id <= nnodes; id++) {
+	st_insert(ids, (char *) sorted[id], (char *) (ptruint) id);
+    }
+
+    fp = fopen(filename, "wb");
+    if (fp == NULL) goto cleanup;
+
+    /* Header and variable order. */
+    memcpy(header.magic, DD_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = DD_SNAPSHOT_VERSION;
+    header.endian = DD_SNAPSHOT_ENDIAN;
+    header.nvars = (unsigned int) dd->size;
+    header.nlevels = nlevels;
+    header.nroots = (unsigned int) n;
+    header.nnodes = nnodes;
+    if (fwrite(&header, sizeof(header), 1, fp) != 1) goto cleanup;
+    for (i = 0; i < dd->size; i++) {
+	buf[0] = (unsigned int) dd->perm[i];
+	if (fwrite(buf, sizeof(unsigned int), 1, fp) != 1) goto cleanup;
+    }
+
+    /* Level table. */
+    for (level = dd->size - 1; level >= 0; level--) {
+	index = dd->invperm[level];
+	if (counts[index] == 0) continue;
+	buf[0] = (unsigned int) index;
+	buf[1] = counts[index];
+	if (fwrite(buf, sizeof(unsigned int), 2, fp) != 2) goto cleanup;
+    }
+
+    /* Nodes. */
+    for (id = 1; id <= nnodes; id++) {
+	buf[0] = ddSnapshotRef(dd, cuddT(sorted[id]), ids);
+	buf[1] = ddSnapshotRef(dd, cuddE(sorted[id]), ids);
+	if (fwrite(buf, sizeof(unsigned int), 2, fp) != 2) goto cleanup;
+    }
+
+    /* Roots. */
+    for (i = 0; i < n; i++) {
+	buf[0] = ddSnapshotRef(dd, f[i], ids);
+	if (fwrite(buf, sizeof(unsigned int), 1, fp) != 1) goto cleanup;
+    }
+
+    /* Names. */
+    for (i = 0; i < dd->size; i++) {
+	if (!ddSnapshotWriteString(varnames == NULL ? NULL : varnames[i], fp))
+	    goto cleanup;
+    }
+    for (i = 0; i < n; i++) {
+	if (!ddSnapshotWriteString(rootnames == NULL ? NULL : rootnames[i], fp))
+	    goto cleanup;
+    }
+
+    ok = 1;
+
+cleanup:
+    if (fp != NULL && fclose(fp) != 0) ok = 0;
+    st_free_table(ids);
+    FREE(sorted);
+    FREE(counts);
+    FREE(offsets);
+    return(ok);
+
+} /* end of Cudd_SnapshotSave */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Opens a snapshot written by Cudd_SnapshotSave.]
+
+  Description [Maps the file filename in memory (or reads it when
+  mapping is not available) and checks its consistency. The
+  snapshot does not depend on any manager and must be released
+  with Cudd_SnapshotClose. Returns a pointer to the snapshot if
+  successful; NULL if the file cannot be read, or is not a snapshot
+  written by a machine with the same byte order.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotSave Cudd_SnapshotLoad Cudd_SnapshotClose]
+
+******************************************************************************/
+DdSnapshot *
+Cudd_SnapshotOpen(
+  const char * filename)
+{
+    DdSnapshot *snap;
+    DdSnapshotHeader *h;
+    size_t offset, expected;
+    unsigned int i, total, first, ref;
+    unsigned int *level;
+
+    snap = ALLOC(DdSnapshot, 1);
+    if (snap == NULL) return(NULL);
+    memset(snap, 0, sizeof(DdSnapshot));
+
+#ifdef DD_SNAPSHOT_MMAP
+    {
+	struct stat st;
+	int fd = open(filename, O_RDONLY);
+
+	if (fd < 0) goto failure;
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(*h)) {
+	    close(fd);
+	    goto failure;
+	}
+	snap->size = (size_t) st.st_size;
+	snap->data = (char *) mmap(NULL, snap->size, PROT_READ, MAP_PRIVATE,
+				   fd, 0);
+	close(fd);
+	if (snap->data == (char *) MAP_FAILED) {
+	    snap->data = NULL;
+	    goto failure;
+	}
+	snap->mapped = 1;
+#ifdef MADV_SEQUENTIAL
+	(void) madvise(snap->data, snap->size, MADV_SEQUENTIAL);
+#endif
+    }
+#else
+    {
+	FILE *fp = fopen(filename, "rb");
+	long size;
+
+	if (fp == NULL) goto failure;
+	if (fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) < 0 ||
+	    (size_t) size < sizeof(*h) || fseek(fp, 0, SEEK_SET) != 0) {
+	    fclose(fp);
+	    goto failure;
+	}
+	snap->size = (size_t) size;
+	snap->data = ALLOC(char, snap->size);
+	if (snap->data == NULL ||
+	    fread(snap->data, 1, snap->size, fp) != snap->size) {
+	    fclose(fp);
+	    goto failure;
+	}
+	fclose(fp);
+    }
+#endif
+
+    memcpy(&snap->header, snap->data, sizeof(snap->header));
+    h = &snap->header;
+    if (memcmp(h->magic, DD_SNAPSHOT_MAGIC, sizeof(h->magic)) != 0 ||
+	h->version != DD_SNAPSHOT_VERSION || h->endian != DD_SNAPSHOT_ENDIAN ||
+	h->nnodes > ((((size_t) -1) >> 4) / sizeof(unsigned int))) {
+	goto failure;
+    }
+
+    /* Locate the arrays. */
+    expected = sizeof(*h) + sizeof(unsigned int) *
+	((size_t) h->nvars + 2 * (size_t) h->nlevels +
+	 2 * (size_t) h->nnodes + (size_t) h->nroots);
+    if (expected > snap->size) goto failure;
+    snap->perm = (unsigned int *) (snap->data + sizeof(*h));
+    snap->levels = snap->perm + h->nvars;
+    snap->nodes = snap->levels + 2 * h->nlevels;
+    snap->roots = snap->nodes + 2 * h->nnodes;
+
+    /* Check that the children of a node lie in deeper levels. */
+    total = 0;
+    for (i = 0; i < h->nlevels; i++) {
+	level = snap->levels + 2 * i;
+	if (level[0] >= h->nvars || level[1] > h->nnodes - total) {
+	    goto failure;
+	}
+	first = total + 1;
+	total += level[1];
+	for (ref = 2 * (first - 1); ref < 2 * total; ref++) {
+	    if ((snap->nodes[ref] >> 1) >= first) goto failure;
+	}
+    }
+    if (total != h->nnodes) goto failure;
+    for (i = 0; i < h->nroots; i++) {
+	if ((snap->roots[i] >> 1) > h->nnodes) goto failure;
+    }
+
+    /* Read the names. */
+    snap->varnames = ALLOC(char *, h->nvars + 1);
+    snap->rootnames = ALLOC(char *, h->nroots + 1);
+    if (snap->varnames == NULL || snap->rootnames == NULL) goto failure;
+    memset(snap->varnames, 0, sizeof(char *) * (h->nvars + 1));
+    memset(snap->rootnames, 0, sizeof(char *) * (h->nroots + 1));
+    offset = expected;
+    for (i = 0; i < h->nvars; i++) {
+	snap->varnames[i] = ddSnapshotReadString(snap, &offset);
+	if (offset == 0) goto failure;
+    }
+    for (i = 0; i < h->nroots; i++) {
+	snap->rootnames[i] = ddSnapshotReadString(snap, &offset);
+	if (offset == 0) goto failure;
+    }
+
+    return(snap);
+
+failure:
+    Cudd_SnapshotClose(snap);
+    return(NULL);
+
+} /* end of Cudd_SnapshotOpen */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Releases a snapshot.]
+
+  Description [Unmaps the file and frees the snapshot. The BDDs
+  already loaded from it are not affected.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotOpen]
+
+******************************************************************************/
+void
+Cudd_SnapshotClose(
+  DdSnapshot * snap)
+{
+    unsigned int i;
+
+    if (snap == NULL) return;
+    if (snap->varnames != NULL) {
+	for (i = 0; i < snap->header.nvars; i++) FREE(snap->varnames[i]);
+	FREE(snap->varnames);
+    }
+    if (snap->rootnames != NULL) {
+	for (i = 0; i < snap->header.nroots; i++) FREE(snap->rootnames[i]);
+	FREE(snap->rootnames);
+    }
+    if (snap->data != NULL) {
+#ifdef DD_SNAPSHOT_MMAP
+	if (snap->mapped) (void) munmap(snap->data, snap->size);
+#else
+	FREE(snap->data);
+#endif
+    }
+    FREE(snap);
+
+} /* end of Cudd_SnapshotClose */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of variables of the saving manager.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotReadVarName Cudd_SnapshotReadVarLevel]
+
+******************************************************************************/
+int
+Cudd_SnapshotReadVarCount(
+  DdSnapshot * snap)
+{
+    return((int) snap->header.nvars);
+
+} /* end of Cudd_SnapshotReadVarCount */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the name of the i-th saved variable.]
+
+  Description [Returns the name given to the variable of index i when
+  the snapshot was saved; NULL if it has no name. The string belongs
+  to the snapshot.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotReadVarCount]
+
+******************************************************************************/
+const char *
+Cudd_SnapshotReadVarName(
+  DdSnapshot * snap,
+  int  i)
+{
+    if (i < 0 || (unsigned int) i >= snap->header.nvars) return(NULL);
+    return(snap->varnames[i]);
+
+} /* end of Cudd_SnapshotReadVarName */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the level of the i-th saved variable.]
+
+  Description [Returns the level of the variable of index i in the
+  saving manager; -1 if i is out of range.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotReadVarCount]
+
+******************************************************************************/
+int
+Cudd_SnapshotReadVarLevel(
+  DdSnapshot * snap,
+  int  i)
+{
+    if (i < 0 || (unsigned int) i >= snap->header.nvars) return(-1);
+    return((int) snap->perm[i]);
+
+} /* end of Cudd_SnapshotReadVarLevel */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of BDDs in a snapshot.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotReadRootName]
+
+******************************************************************************/
+int
+Cudd_SnapshotReadRootCount(
+  DdSnapshot * snap)
+{
+    return((int) snap->header.nroots);
+
+} /* end of Cudd_SnapshotReadRootCount */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the name of the i-th BDD of a snapshot.]
+
+  Description [Returns the name given to the i-th BDD when the
+  snapshot was saved; NULL if it has no name. The string belongs to
+  the snapshot.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotReadRootCount]
+
+******************************************************************************/
+const char *
+Cudd_SnapshotReadRootName(
+  DdSnapshot * snap,
+  int  i)
+{
+    if (i < 0 || (unsigned int) i >= snap->header.nroots) return(NULL);
+    return(snap->rootnames[i]);
+
+} /* end of Cudd_SnapshotReadRootName */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of nodes of a snapshot.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotOpen]
+
+******************************************************************************/
+unsigned int
+Cudd_SnapshotReadNodeCount(
+  DdSnapshot * snap)
+{
+    return(snap->header.nnodes);
+
+} /* end of Cudd_SnapshotReadNodeCount */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Rebuilds the BDDs of a snapshot in a manager.]
+
+  Description [Rebuilds the BDDs of snap in dd. The saved variable
+  of index i becomes the variable of index varmap[i]; if varmap is
+  NULL, the indices are kept. A negative entry means that the
+  variable has no counterpart, which is an error if a node depends
+  on it. If restore is non-zero, the variables of dd are first
+  permuted so that the mapped variables follow the saved order, the
+  others keeping their levels. When the order of dd is compatible
+  with the saved one, the nodes are inserted directly in the unique
+  table; otherwise they are built with Cudd_bddIte. Automatic
+  reordering is suspended during the load. Returns an array of
+  Cudd_SnapshotReadRootCount(snap) referenced BDDs, to be freed by
+  the caller, if successful; NULL otherwise.]
+
+  SideEffects [May change the variable order when restore is
+  non-zero. Creates new variables if needed.]
+
+  SeeAlso     [Cudd_SnapshotOpen Cudd_SnapshotSave]
+
+******************************************************************************/
+DdNode **
+Cudd_SnapshotLoad(
+  DdManager * dd,
+  DdSnapshot * snap,
+  int * varmap,
+  int  restore)
+{
+    DdSnapshotHeader *h = &snap->header;
+    DdNode **built = NULL;
+    DdNode **result = NULL;
+    DdNode *T, *E, *res, *var;
+    unsigned int *level;
+    unsigned int *node;
+    unsigned int i, id, end;
+    int index, maxindex, lastlevel, direct;
+    int autoDyn, autoDynZ;
+
+    /* Map the variables, creating the missing ones. */
+    maxindex = -1;
+    for (i = 0; i < h->nlevels; i++) {
+	index = (int) snap->levels[2 * i];
+	if (varmap != NULL) index = varmap[index];
+	if (index < 0 || index >= CUDD_MAXINDEX - 1) return(NULL);
+	if (index > maxindex) maxindex = index;
+    }
+    if (maxindex >= dd->size && Cudd_bddIthVar(dd, maxindex) == NULL) {
+	return(NULL);
+    }
+    if (restore && !ddSnapshotShuffle(dd, snap, varmap)) return(NULL);
+
+    /* The nodes can be inserted directly if the levels of the mapped
+    ** variables strictly decrease along the saved levels. */
+    direct = 1;
+    lastlevel = dd->size;
+    for (i = 0; i < h->nlevels; i++) {
+	index = (int) snap->levels[2 * i];
+	if (varmap != NULL) index = varmap[index];
+	if (dd->perm[index] >= lastlevel) {
+	    direct = 0;
+	    break;
+	}
+	lastlevel = dd->perm[index];
+    }
+
+    built = ALLOC(DdNode *, h->nnodes + 1);
+    result = ALLOC(DdNode *, h->nroots + 1);
+    if (built == NULL || result == NULL) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	FREE(built);
+	FREE(result);
+	return(NULL);
+    }
+    built[0] = DD_ONE(dd);
+    cuddRef(built[0]);
+
+    autoDyn = dd->autoDyn;
+    autoDynZ = dd->autoDynZ;
+    dd->autoDyn = 0;
+    dd->autoDynZ = 0;
+
+    id = 1;
+    for (i = 0; i < h->nlevels; i++) {
+	level = snap->levels + 2 * i;
+	index = (int) level[0];
+	if (varmap != NULL) index = varmap[index];
+	var = direct ? NULL : dd->vars[index];
+	for (end = id + level[1]; id < end; id++) {
+	    node = snap->nodes + 2 * (id - 1);
+	    T = Cudd_NotCond(built[node[0] >> 1], node[0] & 1);
+	    E = Cudd_NotCond(built[node[1] >> 1], node[1] & 1);
+	    if (!direct) {
+		res = cuddBddIteRecur(dd, var, T, E);
+	    } else if (T == E) {
+		res = T;
+	    } else if (Cudd_IsComplement(T)) {
+		res = cuddUniqueInter(dd, index, Cudd_Not(T), Cudd_Not(E));
+		res = Cudd_NotCond(res, res != NULL);
+	    } else {
+		res = cuddUniqueInter(dd, index, T, E);
+	    }
+	    if (res == NULL) goto failure;
+	    cuddRef(res);
+	    built[id] = res;
+	}
+    }
+
+    for (i = 0; i < h->nroots; i++) {
+	id = snap->roots[i];
+	result[i] = Cudd_NotCond(built[id >> 1], id & 1);
+	cuddRef(result[i]);
+    }
+
+    for (id = h->nnodes + 1; id > 0; id--) {
+	Cudd_RecursiveDeref(dd, built[id - 1]);
+    }
+    FREE(built);
+    dd->autoDyn = autoDyn;
+    dd->autoDynZ = autoDynZ;
+    return(result);
+
+failure:
+    while (id-- > 0) Cudd_RecursiveDeref(dd, built[id]);
+    FREE(built);
+    FREE(result);
+    dd->autoDyn = autoDyn;
+    dd->autoDynZ = autoDynZ;
+    return(NULL);
+
+} /* end of Cudd_SnapshotLoad */
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of internal functions                                          */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+
+/**Function********************************************************************
+
+  Synopsis    [Collects the nodes of a BDD for Cudd_SnapshotSave.]
+
+  Description [Inserts the regular internal nodes of f not yet in
+  visited, and counts them in counts, by variable index. Returns 1
+  if successful; 0 if f is not a BDD or memory is exhausted.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotSave]
+
+******************************************************************************/
+static int
+ddSnapshotCollect(
+  DdManager * dd,
+  DdNode * f,
+  st_table * visited,
+  unsigned int * counts)
+{
+    DdNode *F = Cudd_Regular(f);
+
+    if (cuddIsConstant(F)) {
+	return(F == DD_ONE(dd));
+    }
+    if (st_is_member(visited, (char *) F)) return(1);
+    if (st_insert(visited, (char *) F, NULL) == ST_OUT_OF_MEM) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	return(0);
+    }
+    counts[F->index]++;
+    if (!ddSnapshotCollect(dd, cuddT(F), visited, counts)) return(0);
+    return(ddSnapshotCollect(dd, cuddE(F), visited, counts));
+
+} /* end of ddSnapshotCollect */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the snapshot reference of a node.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_SnapshotSave]
+
+******************************************************************************/
+static unsigned int
+ddSnapshotRef(
+  DdManager * dd,
+  DdNode * f,
+  st_table * ids)
+{
+    DdNode *F = Cudd_Regular(f);
+    char *id = NULL;
+
+    if (!cuddIsConstant(F)) {
+	(void) st_lookup(ids, (char *) F, &id);
+    }
+    return(((unsigned int) (ptruint) id << 1) |
+	   (unsigned int) Cudd_IsComplement(f));
+
+} /* end of ddSnapshotRef */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Writes a length-prefixed string; NULL is written as
+  the empty string.]
+
+  Description [Returns 1 if successful; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [ddSnapshotReadString]
+
+******************************************************************************/
+static int
+ddSnapshotWriteString(
+  const char * s,
+  FILE * fp)
+{
+    unsigned int len = (s == NULL) ? 0 : (unsigned int) strlen(s);
+
+    if (fwrite(&len, sizeof(len), 1, fp) != 1) return(0);
+    return(len == 0 || fwrite(s, 1, len, fp) == len);
+
+} /* end of ddSnapshotWriteString */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads a length-prefixed string.]
+
+  Description [Reads the string at *offset in the snapshot data and
+  advances *offset past it. Returns a copy of the string, or NULL if
+  it is empty. Sets *offset to 0 if the string does not fit in the
+  data or memory is exhausted.]
+
+  SideEffects [None]
+
+  SeeAlso     [ddSnapshotWriteString]
+
+******************************************************************************/
+static char *
+ddSnapshotReadString(
+  DdSnapshot * snap,
+  size_t * offset)
+{
+    unsigned int len;
+    char *s;
+
+    if (snap->size - *offset < sizeof(len)) {
+	*offset = 0;
+	return(NULL);
+    }
+    memcpy(&len, snap->data + *offset, sizeof(len));
+    *offset += sizeof(len);
+    if (len == 0) return(NULL);
+    if (snap->size - *offset < len || (s = ALLOC(char, len + 1)) == NULL) {
+	*offset = 0;
+	return(NULL);
+    }
+    memcpy(s, snap->data + *offset, len);
+    s[len] = '\0';
+    *offset += len;
+    return(s);
+
+} /* end of ddSnapshotReadString */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Restores the saved order of the mapped variables.]
+
+  Description [Permutes the variables of dd so that the variables
+  that are images of saved variables appear in the saved order, in
+  the levels they currently occupy. Returns 1 if successful; 0
+  otherwise.]
+
+  SideEffects [Changes the variable order.]
+
+  SeeAlso     [Cudd_SnapshotLoad]
+
+******************************************************************************/
+static int
+ddSnapshotShuffle(
+  DdManager * dd,
+  DdSnapshot * snap,
+  int * varmap)
+{
+    int *permutation, *mapped, *bysaved;
+    int nvars = (int) snap->header.nvars;
+    int i, index, level, k, changed, ok;
+
+    permutation = ALLOC(int, dd->size);
+    mapped = ALLOC(int, dd->size);
+    bysaved = ALLOC(int, nvars + 1);
+    if (permutation == NULL || mapped == NULL || bysaved == NULL) {
+	dd->errorCode = CUDD_MEMORY_OUT;
+	FREE(permutation);
+	FREE(mapped);
+	FREE(bysaved);
+	return(0);
+    }
+
+    /* Saved variables by saved level, mapped to their new index. */
+    for (i = 0; i < nvars; i++) bysaved[i] = -1;
+    for (i = 0; i < dd->size; i++) mapped[i] = 0;
+    for (i = 0; i < nvars; i++) {
+	index = (varmap == NULL) ? i : varmap[i];
+	if (index < 0 || index >= dd->size || mapped[index]) continue;
+	if (snap->perm[i] < (unsigned int) nvars &&
+	    bysaved[snap->perm[i]] < 0) {
+	    bysaved[snap->perm[i]] = index;
+	    mapped[index] = 1;
+	}
+    }
+
+    /* Fill the levels of the mapped variables in the saved order. */
+    k = 0;
+    changed = 0;
+    for (level = 0; level < dd->size; level++) {
+	index = dd->invperm[level];
+	if (mapped[index]) {
+	    while (bysaved[k] < 0) k++;
+	    index = bysaved[k++];
+	}
+	permutation[level] = index;
+	changed |= (index != dd->invperm[level]);
+    }
+
+    ok = !changed || Cudd_ShuffleHeap(dd, permutation);
+    FREE(permutation);
+    FREE(mapped);
+    FREE(bysaved);
+    return(ok);
+
+} /* end of ddSnapshotShuffle */
@@ -360,8 +360,13 @@ cuddSymmSifting(
     }
 
     for (i = 0; i < ddMin(table->siftMaxVar,size); i++) {
-	if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	/* NuSMV: add begin */
+	if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+	    ddReorderTimedOut(table))
 	    break;
+	/* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	            break; */
+	/* NuSMV: add end */
 	x = table->perm[var[i]];
 #ifdef DD_STATS
 	previousSize = table->keys - table->isolated;
@@ -483,8 +488,13 @@ cuddSymmSiftingConv(
     }
 
     for (i = 0; i < ddMin(table->siftMaxVar, table->size); i++) {
-	if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	/* NuSMV: add begin */
+	if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+	    ddReorderTimedOut(table))
 	    break;
+	/* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	            break; */
+	/* NuSMV: add end */
 	x = table->perm[var[i]];
 	if (x < lower || x > upper) continue;
 	/* Only sift if not in symmetry group already. */
@@ -532,8 +542,13 @@ cuddSymmSiftingConv(
 
 	/* Now sift. */
 	for (i = 0; i < ddMin(table->siftMaxVar,classes); i++) {
-	    if (ddTotalNumberSwapping >= table->siftMaxSwap)
+	    /* NuSMV: add begin */
+	    if (ddTotalNumberSwapping >= table->siftMaxSwap ||
+		ddReorderTimedOut(table))
 		break;
+	    /* WAS: if (ddTotalNumberSwapping >= table->siftMaxSwap)
+		        break; */
+	    /* NuSMV: add end */
 	    x = table->perm[var[i]];
 	    if ((unsigned) x >= table->subtables[x].next) {
 #ifdef DD_STATS
@@ -1274,8 +1289,11 @@ ddSymmSiftingUp(
 	    move->size = size;
 	    move->next = moves;
 	    moves = move;
-	    if ((double) size > (double) limitSize * table->maxGrowth)
+	    /* NuSMV: add begin */
+	    if ((double) size > (double) limitSize * table->maxGrowth ||
+	        ddReorderTimedOut(table))
 		return(moves);
+	    /* NuSMV: add end */
 	    if (size < limitSize) limitSize = size;
 	} else { /* Group move */
 	    size = ddSymmGroupMove(table,x,y,&moves);
@@ -1290,8 +1308,11 @@ ddSymmSiftingUp(
 		}
 		z = table->subtables[z].next;
 	    } while (z != (int) moves->y);
-	    if ((double) size > (double) limitSize * table->maxGrowth)
+	    /* NuSMV: add begin */
+	    if ((double) size > (double) limitSize * table->maxGrowth ||
+	        ddReorderTimedOut(table))
 		return(moves);
+	    /* NuSMV: add end */
 	    if (size < limitSize) limitSize = size;
 	}
 	y = gxtop;
@@ -1405,8 +1426,11 @@ ddSymmSiftingDown(
 	    move->size = size;
 	    move->next = moves;
 	    moves = move;
-	    if ((double) size > (double) limitSize * table->maxGrowth)
+	    /* NuSMV: add begin */
+	    if ((double) size > (double) limitSize * table->maxGrowth ||
+	        ddReorderTimedOut(table))
 		return(moves);
+	    /* NuSMV: add end */
 	    if (size < limitSize) limitSize = size;
 	} else { /* Group move */
 	    /* Update upper bound on node decrease: first phase. */
@@ -1422,8 +1446,11 @@ ddSymmSiftingDown(
 	    } while (z <= gybot);
 	    size = ddSymmGroupMove(table,x,y,&moves);
 	    if (size == 0) goto ddSymmSiftingDownOutOfMem;
-	    if ((double) size > (double) limitSize * table->maxGrowth)
+	    /* NuSMV: add begin */
+	    if ((double) size > (double) limitSize * table->maxGrowth ||
+	        ddReorderTimedOut(table))
 		return(moves);
+	    /* NuSMV: add end */
 	    if (size < limitSize) limitSize = size;
 	    /* Update upper bound on node decrease: second phase. */
 	    gxtop = table->subtables[gybot].next;
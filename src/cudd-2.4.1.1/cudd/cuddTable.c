@@ -82,6 +82,11 @@
 
 #include "util.h"
 #include "cuddInt.h"
+/* NuSMV: add begin */
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+/* NuSMV: add end */
 
 /*---------------------------------------------------------------------------*/
 /* Constant declarations                                                     */
@@ -162,6 +167,9 @@ static void ddPatchTree (DdManager *dd, MtrNode *treenode);
 static int cuddCheckCollisionOrdering (DdManager *unique, int i, int j);
 #endif
 static void ddReportRefMess (DdManager *unique, int i, const char *caller);
+/* NuSMV: add begin */
+static int ddReleaseFreePages (DdManager *unique);
+/* NuSMV: add end */
 
 /**AutomaticEnd***************************************************************/
 
@@ -248,6 +256,34 @@ cuddAllocNode(
 	    (void) cuddGarbageCollect(unique,1);
 	    mem = NULL;
 	}
+	/* NuSMV: add begin */
+	/* Reclaim memory before a new page brings the manager close to
+	** its budget. On failure, wait for a further step of the budget
+	** before trying again. */
+	if (unique->nextFree == NULL && unique->memBudget != 0 &&
+	    unique->memused + (DD_MEM_CHUNK + 1) * sizeof(DdNode) >
+	    unique->memBudgetTrigger) {
+	    DdHook *hook;
+
+	    unique->memBudgetEvents++;
+	    (void) cuddReclaimMemory(unique, 0);
+	    if (unique->memused > unique->memBudgetTrigger) {
+		for (hook = unique->memBudgetHook; hook != NULL;
+		     hook = hook->next) {
+		    (void) (hook->f)(unique,"DD",NULL);
+		}
+		(void) cuddReclaimMemory(unique, 1);
+	    }
+	    if (unique->memused > unique->memBudgetTrigger) {
+		unique->memBudgetTrigger = unique->memused +
+		    (ptruint) (unique->memBudget * DD_MEM_BUDGET_STEP);
+	    } else {
+		unique->memBudgetTrigger =
+		    (ptruint) (unique->memBudget * DD_MEM_BUDGET_FRAC);
+	    }
+	    mem = NULL;
+	}
+	/* NuSMV: add end */
 	if (unique->nextFree == NULL) {
 	    if (unique->memused > unique->maxmemhard) {
 		unique->errorCode = CUDD_MAX_MEM_EXCEEDED;
@@ -526,6 +562,11 @@ cuddInitTable(
     unique->countDead = ~0;
     unique->siftMaxVar = DD_SIFT_MAX_VAR;
     unique->siftMaxSwap = DD_SIFT_MAX_SWAPS;
+    /* NuSMV: add begin */
+    unique->reordTimeLimit = 0;
+    unique->reordTotalLimit = 0;
+    unique->reordStartTime = 0;
+    /* NuSMV: add end */
     unique->tree = NULL;
     unique->treeZ = NULL;
     unique->groupcheck = CUDD_GROUP_CHECK7;
@@ -546,6 +587,9 @@ cuddInitTable(
     unique->postGCHook = NULL;
     unique->preReorderingHook = NULL;
     unique->postReorderingHook = NULL;
+    /* NuSMV: add begin */
+    unique->memBudgetHook = NULL;
+    /* NuSMV: add end */
     unique->out = stdout;
     unique->err = stderr;
     unique->errorCode = CUDD_NO_ERROR;
@@ -555,6 +599,11 @@ cuddInitTable(
     unique->maxmemhard = (ptruint) ((~ (ptruint) 0) >> 1);
       /* WAS: unique->maxmemhard = (unsigned long) ((~ (unsigned long) 0) >> 1); */
     /* NuSMV: add end */
+    /* NuSMV: add begin */
+    unique->memBudget = 0;
+    unique->memBudgetTrigger = 0;
+    unique->memBudgetEvents = 0;
+    /* NuSMV: add end */
     unique->garbageCollections = 0;
     unique->GCTime = 0;
     unique->reordTime = 0;
@@ -641,6 +690,11 @@ cuddFreeTable(
     while (unique->postReorderingHook != NULL)
 	Cudd_RemoveHook(unique,unique->postReorderingHook->f,
 			CUDD_POST_REORDERING_HOOK);
+    /* NuSMV: add begin */
+    while (unique->memBudgetHook != NULL)
+	Cudd_RemoveHook(unique,unique->memBudgetHook->f,
+			CUDD_MEM_BUDGET_HOOK);
+    /* NuSMV: add end */
     FREE(unique);
 
 } /* end of cuddFreeTable */
@@ -957,6 +1011,51 @@ cuddGarbageCollect(
 } /* end of cuddGarbageCollect */
 
 
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Gives unused memory back to the system.]
+
+  Description [Collects garbage, shrinks the computed table and frees
+  the pages of nodes that hold no live node. The computed table is
+  halved if minimizeCache is 0, and brought back to its initial size
+  otherwise. Pages are only freed if garbage collection left no dead
+  node, since only then are all the nodes with null reference count
+  free. Returns the number of bytes by which the memory in use
+  decreased.]
+
+  SideEffects [Rebuilds the free list.]
+
+  SeeAlso     [cuddGarbageCollect cuddCacheShrink Cudd_ReleaseMemory]
+
+******************************************************************************/
+ptruint
+cuddReclaimMemory(
+  DdManager * unique,
+  int  minimizeCache)
+{
+    ptruint before = unique->memused;
+
+    /* The first collection may only raise the GC fraction and return. */
+    if (cuddGarbageCollect(unique,1) == 0 &&
+	unique->dead + unique->deadZ != 0) {
+	(void) cuddGarbageCollect(unique,1);
+    }
+    (void) cuddCacheShrink(unique, minimizeCache ? 0 :
+			   unique->cacheSlots >> 1);
+    if (ddReleaseFreePages(unique) > 0) {
+#ifdef __GLIBC__
+	/* Let the allocator return the freed pages to the system. */
+	(void) malloc_trim(0);
+#endif
+    }
+
+    return(before > unique->memused ? before - unique->memused : 0);
+
+} /* end of cuddReclaimMemory */
+/* NuSMV: add end */
+
+
 /**Function********************************************************************
 
   Synopsis [Wrapper for cuddUniqueInterZdd.]
@@ -1124,8 +1223,14 @@ cuddUniqueInter(
     }
 
     /* countDead is 0 if deads should be counted and ~0 if they should not. */
+    /* NuSMV: add begin */
     if (unique->autoDyn &&
-    unique->keys - (unique->dead & unique->countDead) >= unique->nextDyn) {
+    unique->keys - (unique->dead & unique->countDead) >= unique->nextDyn &&
+    (unique->reordTotalLimit == 0 ||
+     unique->reordTime < unique->reordTotalLimit)) {
+    /* WAS: if (unique->autoDyn &&
+       unique->keys - (unique->dead & unique->countDead) >= unique->nextDyn) { */
+    /* NuSMV: add end */
 #ifdef DD_DEBUG
 	retval = Cudd_DebugCheck(unique);
 	if (retval != 0) return(NULL);
@@ -3139,6 +3244,78 @@ cuddCheckCollisionOrdering(
 
 
 
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Frees the pages of nodes that hold no live node.]
+
+  Description [Scans the pages of nodes of the manager, frees those
+  whose nodes all have null reference count and threads the free nodes
+  of the other pages into a new free list. Requires that there are no
+  dead nodes, i.e., that garbage was just collected; otherwise does
+  nothing. Returns the number of pages freed.]
+
+  SideEffects [Rebuilds the free list.]
+
+  SeeAlso     [cuddReclaimMemory]
+
+******************************************************************************/
+static int
+ddReleaseFreePages(
+  DdManager * unique)
+{
+    DdNodePtr *page, *next, *kept;
+    DdNode *nodes, *sentry;
+    ptruint offset;
+    int k, released;
+
+    if (unique->dead + unique->deadZ != 0) return(0);
+
+    released = 0;
+    kept = NULL;
+    sentry = NULL;
+    unique->nextFree = NULL;
+    page = unique->memoryList;
+    while (page != NULL) {
+	next = (DdNodePtr *) page[0];
+	offset = (ptruint) page & (sizeof(DdNode) - 1);
+	nodes = (DdNode *) (page + (sizeof(DdNode) - offset) /
+			    sizeof(DdNodePtr));
+	for (k = 0; k < DD_MEM_CHUNK; k++) {
+	    if (nodes[k].ref != 0) break;
+	}
+	if (k == DD_MEM_CHUNK) {
+	    /* Unlink the page and free it. */
+	    if (kept == NULL) {
+		unique->memoryList = next;
+	    } else {
+		kept[0] = (DdNodePtr) next;
+	    }
+	    FREE(page);
+	    unique->memused -= (DD_MEM_CHUNK + 1) * sizeof(DdNode);
+	    released++;
+	} else {
+	    for (k = 0; k < DD_MEM_CHUNK; k++) {
+		if (nodes[k].ref == 0) {
+		    if (sentry == NULL) {
+			unique->nextFree = sentry = &nodes[k];
+		    } else {
+			sentry = (sentry->next = &nodes[k]);
+		    }
+		}
+	    }
+	    kept = page;
+	}
+	page = next;
+    }
+    if (sentry != NULL) sentry->next = NULL;
+
+    return(released);
+
+} /* end of ddReleaseFreePages */
+/* NuSMV: add end */
+
+
 /**Function********************************************************************
 
   Synopsis    [Reports problem in garbage collection.]
@@ -94,6 +94,30 @@ DD::DD(const DD &from) {
 } // DD::DD
 
 
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+DD::DD(DD &&from) noexcept {
+    ddMgr = from.ddMgr;
+    node = from.node;
+    from.node = 0;
+
+} // DD::DD
+#endif
+
+
+// Gives up the reference held on the node, which is returned; the
+// caller becomes responsible for dereferencing it.
+DdNode *
+DD::release()
+{
+    DdNode *result = node;
+    node = 0;
+    return result;
+
+} // DD::release
+/* NuSMV: add end */
+
+
 inline DdManager *
 DD::checkSameManager(
   const DD &other) const
@@ -180,12 +204,16 @@ DD::manager() const
 } // DD::manager
 
 
+/* NuSMV: remove begin */
+/* Defined in cuddObj.hh, so that it can be inlined by client code
 inline DdNode *
 DD::getNode() const
 {
     return node;
 
 } // DD::getNode
+*/
+/* NuSMV: remove end */
 
 
 int
@@ -204,6 +232,11 @@ DD::nodeCount() const
 ABDD::ABDD(Cudd *bddManager, DdNode *bddNode) : DD(bddManager,bddNode) {}
 ABDD::ABDD() : DD() {}
 ABDD::ABDD(const ABDD &from) : DD(from) {}
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+ABDD::ABDD(ABDD &&from) noexcept : DD(std::move(from)) {}
+#endif
+/* NuSMV: add end */
 
 
 ABDD::~ABDD() {
@@ -257,6 +290,41 @@ ABDD::print(
 BDD::BDD(Cudd *bddManager, DdNode *bddNode) : ABDD(bddManager,bddNode) {}
 BDD::BDD() : ABDD() {}
 BDD::BDD(const BDD &from) : ABDD(from) {}
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+BDD::BDD(BDD &&from) noexcept : ABDD(std::move(from)) {}
+
+
+BDD&
+BDD::operator=(
+  BDD &&right) noexcept
+{
+    if (this == &right) return *this;
+    DdNode *old = node;
+    Cudd *oldMgr = ddMgr;
+    node = right.node;
+    ddMgr = right.ddMgr;
+    right.node = 0;
+    if (old != 0) Cudd_RecursiveDeref(oldMgr->p->manager,old);
+    return *this;
+
+} // BDD::operator=
+#endif
+
+
+// Wraps a node that is already referenced, taking over its reference.
+BDD
+BDD::adopt(
+  Cudd *manager,
+  DdNode *node)
+{
+    BDD result;
+    result.ddMgr = manager;
+    result.node = node;
+    return result;
+
+} // BDD::adopt
+/* NuSMV: add end */
 
 
 int
@@ -279,7 +347,7 @@ BDD::operator!=(
 } // BDD::operator!=
 
 
-BDD
+BDD&
 BDD::operator=(
   const BDD& right)
 {
@@ -371,7 +439,7 @@ BDD::operator*(
 } // BDD::operator*
 
 
-BDD
+BDD&
 BDD::operator*=(
   const BDD& other)
 {
@@ -398,7 +466,7 @@ BDD::operator&(
 } // BDD::operator&
 
 
-BDD
+BDD&
 BDD::operator&=(
   const BDD& other)
 {
@@ -425,7 +493,7 @@ BDD::operator+(
 } // BDD::operator+
 
 
-BDD
+BDD&
 BDD::operator+=(
   const BDD& other)
 {
@@ -452,7 +520,7 @@ BDD::operator|(
 } // BDD::operator|
 
 
-BDD
+BDD&
 BDD::operator|=(
   const BDD& other)
 {
@@ -479,7 +547,7 @@ BDD::operator^(
 } // BDD::operator^
 
 
-BDD
+BDD&
 BDD::operator^=(
   const BDD& other)
 {
@@ -506,7 +574,7 @@ BDD::operator-(
 } // BDD::operator-
 
 
-BDD
+BDD&
 BDD::operator-=(
   const BDD& other)
 {
@@ -529,6 +597,41 @@ BDD::operator-=(
 ADD::ADD(Cudd *bddManager, DdNode *bddNode) : ABDD(bddManager,bddNode) {}
 ADD::ADD() : ABDD() {}
 ADD::ADD(const ADD &from) : ABDD(from) {}
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+ADD::ADD(ADD &&from) noexcept : ABDD(std::move(from)) {}
+
+
+ADD&
+ADD::operator=(
+  ADD &&right) noexcept
+{
+    if (this == &right) return *this;
+    DdNode *old = node;
+    Cudd *oldMgr = ddMgr;
+    node = right.node;
+    ddMgr = right.ddMgr;
+    right.node = 0;
+    if (old != 0) Cudd_RecursiveDeref(oldMgr->p->manager,old);
+    return *this;
+
+} // ADD::operator=
+#endif
+
+
+// Wraps a node that is already referenced, taking over its reference.
+ADD
+ADD::adopt(
+  Cudd *manager,
+  DdNode *node)
+{
+    ADD result;
+    result.ddMgr = manager;
+    result.node = node;
+    return result;
+
+} // ADD::adopt
+/* NuSMV: add end */
 
 
 int
@@ -551,7 +654,7 @@ ADD::operator!=(
 } // ADD::operator!=
 
 
-ADD
+ADD&
 ADD::operator=(
   const ADD& right)
 {
@@ -610,7 +713,17 @@ ADD::operator>(
 ADD
 ADD::operator-() const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return ADD(ddMgr, Cudd_addNegate(ddMgr->p->manager,node));
+    /* NuSMV: add begin */
+#else
+    // Cudd_addNegate is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator- is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator-
 
@@ -619,18 +732,31 @@ ADD
 ADD::operator*(
   const ADD& other) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addTimes,node,other.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addTimes is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator* is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator*
 
 
-ADD
+ADD&
 ADD::operator*=(
   const ADD& other)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addTimes,node,other.node);
     this->checkReturnValue(result);
@@ -638,6 +764,13 @@ ADD::operator*=(
     Cudd_RecursiveDeref(mgr,node);
     node = result;
     return *this;
+    /* NuSMV: add begin */
+#else
+    // Cudd_addTimes is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator*= is not available.");
+    return *this;
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator*=
 
@@ -646,18 +779,31 @@ ADD
 ADD::operator+(
   const ADD& other) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addPlus,node,other.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addPlus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator+ is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator+
 
 
-ADD
+ADD&
 ADD::operator+=(
   const ADD& other)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addPlus,node,other.node);
     this->checkReturnValue(result);
@@ -665,6 +811,13 @@ ADD::operator+=(
     Cudd_RecursiveDeref(mgr,node);
     node = result;
     return *this;
+    /* NuSMV: add begin */
+#else
+    // Cudd_addPlus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator+= is not available.");
+    return *this;
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator+=
 
@@ -673,18 +826,31 @@ ADD
 ADD::operator-(
   const ADD& other) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addMinus,node,other.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMinus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator- is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator-
 
 
-ADD
+ADD&
 ADD::operator-=(
   const ADD& other)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(other);
     DdNode *result = Cudd_addApply(mgr,Cudd_addMinus,node,other.node);
     this->checkReturnValue(result);
@@ -692,6 +858,13 @@ ADD::operator-=(
     Cudd_RecursiveDeref(mgr,node);
     node = result;
     return *this;
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMinus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("operator-= is not available.");
+    return *this;
+#endif
+    /* NuSMV: add end */
 
 } // ADD::operator-=
 
@@ -709,19 +882,37 @@ ADD::operator&(
   const ADD& other) const
 {
     DdManager *mgr = this->checkSameManager(other);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr,Cudd_addTimes,node,other.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addAnd(mgr, node, other.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
 
 } // ADD::operator&
 
 
-ADD
+ADD&
 ADD::operator&=(
   const ADD& other)
 {
     DdManager *mgr = this->checkSameManager(other);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr,Cudd_addTimes,node,other.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addAnd(mgr, node, other.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     Cudd_Ref(result);
     Cudd_RecursiveDeref(mgr,node);
@@ -736,19 +927,37 @@ ADD::operator|(
   const ADD& other) const
 {
     DdManager *mgr = this->checkSameManager(other);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr,Cudd_addOr,node,other.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addOr(mgr, node, other.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
 
 } // ADD::operator|
 
 
-ADD
+ADD&
 ADD::operator|=(
   const ADD& other)
 {
     DdManager *mgr = this->checkSameManager(other);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr,Cudd_addOr,node,other.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addOr(mgr, node, other.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     Cudd_Ref(result);
     Cudd_RecursiveDeref(mgr,node);
@@ -766,6 +975,41 @@ ADD::operator|=(
 ZDD::ZDD(Cudd *bddManager, DdNode *bddNode) : DD(bddManager,bddNode) {}
 ZDD::ZDD() : DD() {}
 ZDD::ZDD(const ZDD &from) : DD(from) {}
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+ZDD::ZDD(ZDD &&from) noexcept : DD(std::move(from)) {}
+
+
+ZDD&
+ZDD::operator=(
+  ZDD &&right) noexcept
+{
+    if (this == &right) return *this;
+    DdNode *old = node;
+    Cudd *oldMgr = ddMgr;
+    node = right.node;
+    ddMgr = right.ddMgr;
+    right.node = 0;
+    if (old != 0) Cudd_RecursiveDerefZdd(oldMgr->p->manager,old);
+    return *this;
+
+} // ZDD::operator=
+#endif
+
+
+// Wraps a node that is already referenced, taking over its reference.
+ZDD
+ZDD::adopt(
+  Cudd *manager,
+  DdNode *node)
+{
+    ZDD result;
+    result.ddMgr = manager;
+    result.node = node;
+    return result;
+
+} // ZDD::adopt
+/* NuSMV: add end */
 
 
 ZDD::~ZDD() {
@@ -780,7 +1024,7 @@ ZDD::~ZDD() {
 } // ZDD::~ZDD
 
 
-ZDD
+ZDD&
 ZDD::operator=(
   const ZDD& right)
 {
@@ -890,7 +1134,7 @@ ZDD::operator*(
 } // ZDD::operator*
 
 
-ZDD
+ZDD&
 ZDD::operator*=(
   const ZDD& other)
 {
@@ -917,7 +1161,7 @@ ZDD::operator&(
 } // ZDD::operator&
 
 
-ZDD
+ZDD&
 ZDD::operator&=(
   const ZDD& other)
 {
@@ -944,7 +1188,7 @@ ZDD::operator+(
 } // ZDD::operator+
 
 
-ZDD
+ZDD&
 ZDD::operator+=(
   const ZDD& other)
 {
@@ -971,7 +1215,7 @@ ZDD::operator|(
 } // ZDD::operator|
 
 
-ZDD
+ZDD&
 ZDD::operator|=(
   const ZDD& other)
 {
@@ -998,7 +1242,7 @@ ZDD::operator-(
 } // ZDD::operator-
 
 
-ZDD
+ZDD&
 ZDD::operator-=(
   const ZDD& other)
 {
@@ -1013,6 +1257,67 @@ ZDD::operator-=(
 } // ZDD::operator-=
 
 
+/* NuSMV: add begin */
+// ---------------------------------------------------------------------------
+// Members of classes BDDAndExpr and BDDIteExpr
+// ---------------------------------------------------------------------------
+
+
+BDDAndExpr::operator BDD() const
+{
+    return f.And(g);
+
+} // BDDAndExpr::operator BDD
+
+
+BDD
+BDDAndExpr::ExistAbstract(
+  const BDD& cube) const
+{
+    return f.AndAbstract(g, cube);
+
+} // BDDAndExpr::ExistAbstract
+
+
+int
+BDDAndExpr::IsZero() const
+{
+    DdManager *mgr = f.manager()->getManager();
+    return Cudd_bddLeq(mgr, f.getNode(), Cudd_Not(g.getNode()));
+
+} // BDDAndExpr::IsZero
+
+
+BDDIteExpr::operator BDD() const
+{
+    return f.Ite(g, h);
+
+} // BDDIteExpr::operator BDD
+
+
+int
+BDDIteExpr::IsZero() const
+{
+    // f & g and !f & h are both empty
+    DdManager *mgr = f.manager()->getManager();
+    return Cudd_bddLeq(mgr, f.getNode(), Cudd_Not(g.getNode())) &&
+	Cudd_bddLeq(mgr, h.getNode(), f.getNode());
+
+} // BDDIteExpr::IsZero
+
+
+int
+BDDIteExpr::IsOne() const
+{
+    // f implies g and !f implies h
+    DdManager *mgr = f.manager()->getManager();
+    return Cudd_bddLeq(mgr, f.getNode(), g.getNode()) &&
+	Cudd_bddLeq(mgr, Cudd_Not(f.getNode()), h.getNode());
+
+} // BDDIteExpr::IsOne
+/* NuSMV: add end */
+
+
 // ---------------------------------------------------------------------------
 // Members of class Cudd
 // ---------------------------------------------------------------------------
@@ -1026,14 +1331,41 @@ Cudd::Cudd(
   unsigned long maxMemory)
 {
     p = new capsule;
-    p->manager = Cudd_Init(numVars,numVarsZ,numSlots,cacheSize,maxMemory);
+    /* NuSMV: add begin */
+    // NuSMV constants are node pointers; a standalone manager only needs
+    // them to be distinct.
+    p->manager = Cudd_Init(numVars,numVarsZ,numSlots,cacheSize,maxMemory,
+			   (CUDD_VALUE_TYPE) 0, (CUDD_VALUE_TYPE) 1,
+			   (CUDD_VALUE_TYPE) 0, (CUDD_VALUE_TYPE) 1);
+    /* WAS: p->manager = Cudd_Init(numVars,numVarsZ,numSlots,cacheSize,maxMemory); */
+    /* NuSMV: add end */
     p->errorHandler = defaultError;
     p->verbose = 0;		// initially terse
     p->ref = 1;
+    /* NuSMV: add begin */
+    p->owner = 1;
+    /* NuSMV: add end */
 
 } // Cudd::Cudd
 
 
+/* NuSMV: add begin */
+// Wraps an existing manager, e.g. the one of NuSMV, which is not quit
+// when the last copy of this object is destroyed.
+Cudd::Cudd(
+  DdManager *manager)
+{
+    p = new capsule;
+    p->manager = manager;
+    p->errorHandler = defaultError;
+    p->verbose = 0;
+    p->ref = 1;
+    p->owner = 0;
+
+} // Cudd::Cudd
+/* NuSMV: add end */
+
+
 Cudd::Cudd(
   Cudd& x)
 {
@@ -1045,7 +1377,13 @@ Cudd::Cudd(
 
 Cudd::~Cudd()
 {
-    if (--p->ref == 0) {
+    /* NuSMV: add begin */
+    if (--p->ref == 0 && !p->owner) {
+	delete p;
+	return;
+    }
+    /* NuSMV: add end */
+    if (p->ref == 0) {
 	int retval = Cudd_CheckZeroRef(p->manager);
 	if (retval != 0) {
 	    cerr << retval << " unexpected non-zero reference counts\n";
@@ -1064,7 +1402,14 @@ Cudd::operator=(
   const Cudd& right)
 {
     right.p->ref++;
-    if (--p->ref == 0) {	// disconnect self
+    /* NuSMV: add begin */
+    if (--p->ref == 0 && !p->owner) {
+	delete p;
+	p = right.p;
+	return *this;
+    }
+    /* NuSMV: add end */
+    if (p->ref == 0) {	// disconnect self
 	int retval = Cudd_CheckZeroRef(p->manager);
 	if (retval != 0) {
 	    cerr << retval << " unexpected non-zero reference counts\n";
@@ -1265,7 +1610,10 @@ ZDD
 Cudd::zddOne(
   int i)
 {
-    DdNode *result = Cudd_ReadZddOne(p->manager,i);
+    /* NuSMV: add begin */
+    DdNode *result = Cudd_ReadZddTrue(p->manager,i);
+    /* WAS: DdNode *result = Cudd_ReadZddOne(p->manager,i); */
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     return ZDD(this, result);
 
@@ -2406,10 +2754,20 @@ ADD
 ADD::ExistAbstract(
   const ADD& cube) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(cube);
     DdNode *result = Cudd_addExistAbstract(mgr, node, cube.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addExistAbstract is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("ExistAbstract is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::ExistAbstract
 
@@ -2418,10 +2776,20 @@ ADD
 ADD::UnivAbstract(
   const ADD& cube) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(cube);
     DdNode *result = Cudd_addUnivAbstract(mgr, node, cube.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addUnivAbstract is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("UnivAbstract is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::UnivAbstract
 
@@ -2430,10 +2798,20 @@ ADD
 ADD::OrAbstract(
   const ADD& cube) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(cube);
     DdNode *result = Cudd_addOrAbstract(mgr, node, cube.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addOrAbstract is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("OrAbstract is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::OrAbstract
 
@@ -2442,10 +2820,20 @@ ADD
 ADD::Plus(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addPlus, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addPlus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Plus is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Plus
 
@@ -2454,10 +2842,20 @@ ADD
 ADD::Times(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addTimes, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addTimes is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Times is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Times
 
@@ -2466,10 +2864,20 @@ ADD
 ADD::Threshold(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addThreshold, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addThreshold is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Threshold is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Threshold
 
@@ -2478,10 +2886,20 @@ ADD
 ADD::SetNZ(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addSetNZ, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addSetNZ is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("SetNZ is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::SetNZ
 
@@ -2490,10 +2908,20 @@ ADD
 ADD::Divide(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addDivide, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addDivide is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Divide is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Divide
 
@@ -2502,10 +2930,20 @@ ADD
 ADD::Minus(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addMinus, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMinus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Minus is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Minus
 
@@ -2514,10 +2952,20 @@ ADD
 ADD::Minimum(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addMinimum, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMinimum is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Minimum is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Minimum
 
@@ -2526,10 +2974,20 @@ ADD
 ADD::Maximum(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addMaximum, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMaximum is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Maximum is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Maximum
 
@@ -2538,10 +2996,20 @@ ADD
 ADD::OneZeroMaximum(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addOneZeroMaximum, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addOneZeroMaximum is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("OneZeroMaximum is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::OneZeroMaximum
 
@@ -2550,10 +3018,20 @@ ADD
 ADD::Diff(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addDiff, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addDiff is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Diff is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Diff
 
@@ -2562,10 +3040,20 @@ ADD
 ADD::Agreement(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addAgreement, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addAgreement is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Agreement is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Agreement
 
@@ -2575,7 +3063,16 @@ ADD::Or(
   const ADD& g) const
 {
     DdManager *mgr = this->checkSameManager(g);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr, Cudd_addOr, node, g.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addOr(mgr, node, g.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
 
@@ -2586,10 +3083,20 @@ ADD
 ADD::Nand(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addNand, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addNand is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Nand is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Nand
 
@@ -2598,10 +3105,20 @@ ADD
 ADD::Nor(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addNor, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addNor is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Nor is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Nor
 
@@ -2611,7 +3128,16 @@ ADD::Xor(
   const ADD& g) const
 {
     DdManager *mgr = this->checkSameManager(g);
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addApply(mgr, Cudd_addXor, node, g.node);
+    /* NuSMV: add begin */
+#else
+    // The NuSMV Cudd_addApply applies op to the leaves
+    DdNode *result = Cudd_addXor(mgr, node, g.node);
+#endif
+    /* NuSMV: add end */
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
 
@@ -2622,10 +3148,20 @@ ADD
 ADD::Xnor(
   const ADD& g) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     DdNode *result = Cudd_addApply(mgr, Cudd_addXnor, node, g.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addXnor is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Xnor is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Xnor
 
@@ -2633,10 +3169,20 @@ ADD::Xnor(
 ADD
 ADD::Log() const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     DdNode *result = Cudd_addMonadicApply(mgr, Cudd_addLog, node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addLog and Cudd_addMonadicApply are not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Log is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Log
 
@@ -2679,10 +3225,20 @@ ADD
 ADD::ScalarInverse(
   const ADD& epsilon) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(epsilon);
     DdNode *result = Cudd_addScalarInverse(mgr, node, epsilon.node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addScalarInverse is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("ScalarInverse is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::ScalarInverse
 
@@ -2751,10 +3307,20 @@ ADD::Cmpl() const
 ADD
 ADD::Negate() const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     DdNode *result = Cudd_addNegate(mgr, node);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addNegate is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Negate is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Negate
 
@@ -2763,10 +3329,20 @@ ADD
 ADD::RoundOff(
   int N) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     DdNode *result = Cudd_addRoundOff(mgr, node, N);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addRoundOff is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("RoundOff is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::RoundOff
 
@@ -2776,6 +3352,9 @@ Cudd::Walsh(
   ADDvector x,
   ADDvector y)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int n = x.count();
     DdNode **X = ALLOC(DdNode *,n);
     DdNode **Y = ALLOC(DdNode *,n);
@@ -2788,6 +3367,13 @@ Cudd::Walsh(
     FREE(Y);
     this->checkReturnValue(result);
     return ADD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addWalsh is not part of the NuSMV version of CUDD
+    p->errorHandler("Walsh is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Walsh
 
@@ -2799,9 +3385,19 @@ Cudd::addResidue(
   int options,
   int top)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdNode *result = Cudd_addResidue(p->manager, n, m, options, top);
     this->checkReturnValue(result);
     return ADD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addResidue is not part of the NuSMV version of CUDD
+    p->errorHandler("addResidue is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::addResidue
 
@@ -2820,6 +3416,30 @@ BDD::AndAbstract(
 } // BDD::AndAbstract
 
 
+/* NuSMV: add begin */
+BDDAndExpr
+BDD::AndExpr(
+  const BDD& g) const
+{
+    this->checkSameManager(g);
+    return BDDAndExpr(*this, g);
+
+} // BDD::AndExpr
+
+
+BDDIteExpr
+BDD::IteExpr(
+  const BDD& g,
+  const BDD& h) const
+{
+    this->checkSameManager(g);
+    this->checkSameManager(h);
+    return BDDIteExpr(*this, g, h);
+
+} // BDD::IteExpr
+/* NuSMV: add end */
+
+
 BDD
 BDD::AndAbstractLimit(
   const BDD& g,
@@ -2840,7 +3460,17 @@ int
 Cudd::ApaNumberOfDigits(
   int binaryDigits) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return Cudd_ApaNumberOfDigits(binaryDigits);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaNumberOfDigits is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaNumberOfDigits is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaNumberOfDigits
 
@@ -2849,7 +3479,17 @@ DdApaNumber
 Cudd::NewApaNumber(
   int digits) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return Cudd_NewApaNumber(digits);
+    /* NuSMV: add begin */
+#else
+    // Cudd_NewApaNumber is not part of the NuSMV version of CUDD
+    p->errorHandler("NewApaNumber is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::NewApaNumber
 
@@ -2860,7 +3500,16 @@ Cudd::ApaCopy(
   DdApaNumber source,
   DdApaNumber dest) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     Cudd_ApaCopy(digits, source, dest);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaCopy is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaCopy is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaCopy
 
@@ -2872,7 +3521,17 @@ Cudd::ApaAdd(
   DdApaNumber b,
   DdApaNumber sum) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return Cudd_ApaAdd(digits, a, b, sum);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaAdd is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaAdd is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaAdd
 
@@ -2884,7 +3543,17 @@ Cudd::ApaSubtract(
   DdApaNumber b,
   DdApaNumber diff) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return Cudd_ApaSubtract(digits, a, b, diff);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaSubtract is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaSubtract is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaSubtract
 
@@ -2896,7 +3565,17 @@ Cudd::ApaShortDivision(
   DdApaDigit divisor,
   DdApaNumber quotient) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     return Cudd_ApaShortDivision(digits, dividend, divisor, quotient);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaShortDivision is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaShortDivision is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaShortDivision
 
@@ -2908,7 +3587,16 @@ Cudd::ApaShiftRight(
   DdApaNumber a,
   DdApaNumber b) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     Cudd_ApaShiftRight(digits, in, a, b);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaShiftRight is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaShiftRight is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaShiftRight
 
@@ -2919,7 +3607,16 @@ Cudd::ApaSetToLiteral(
   DdApaNumber number,
   DdApaDigit literal) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     Cudd_ApaSetToLiteral(digits, number, literal);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaSetToLiteral is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaSetToLiteral is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaSetToLiteral
 
@@ -2930,7 +3627,16 @@ Cudd::ApaPowerOfTwo(
   DdApaNumber number,
   int power) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     Cudd_ApaPowerOfTwo(digits, number, power);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaPowerOfTwo is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaPowerOfTwo is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaPowerOfTwo
 
@@ -2941,9 +3647,18 @@ Cudd::ApaPrintHex(
   int digits,
   DdApaNumber number) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     cout.flush();
     int result = Cudd_ApaPrintHex(fp, digits, number);
     this->checkReturnValue(result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaPrintHex is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaPrintHex is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaPrintHex
 
@@ -2954,9 +3669,18 @@ Cudd::ApaPrintDecimal(
   int digits,
   DdApaNumber number) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     cout.flush();
     int result = Cudd_ApaPrintDecimal(fp, digits, number);
     this->checkReturnValue(result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaPrintDecimal is not part of the NuSMV version of CUDD
+    p->errorHandler("ApaPrintDecimal is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::ApaPrintDecimal
 
@@ -2966,8 +3690,18 @@ ABDD::ApaCountMinterm(
   int nvars,
   int * digits) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     return Cudd_ApaCountMinterm(mgr, node, nvars, digits);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaCountMinterm is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("ApaCountMinterm is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // ABDD::ApaCountMinterm
 
@@ -2977,10 +3711,19 @@ ABDD::ApaPrintMinterm(
   int nvars,
   FILE * fp) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     cout.flush();
     DdManager *mgr = ddMgr->p->manager;
     int result = Cudd_ApaPrintMinterm(fp, mgr, node, nvars);
     this->checkReturnValue(result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_ApaPrintMinterm is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("ApaPrintMinterm is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // ABDD::ApaPrintMinterm
 
@@ -2990,6 +3733,9 @@ ABDD::EpdPrintMinterm(
   int nvars,
   FILE * fp) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     EpDouble count;
     char str[24];
     cout.flush();
@@ -2998,6 +3744,12 @@ ABDD::EpdPrintMinterm(
     this->checkReturnValue(result,0);
     EpdGetString(&count, str);
     fprintf(fp, "%s\n", str);
+    /* NuSMV: add begin */
+#else
+    // Cudd_EpdCountMinterm is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("EpdPrintMinterm is not available.");
+#endif
+    /* NuSMV: add end */
 
 } // ABDD::ApaPrintMinterm
 
@@ -3549,6 +4301,9 @@ ADD
 ADD::VectorCompose(
   ADDvector vector) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     int n = Cudd_ReadSize(mgr);
     DdNode **X = ALLOC(DdNode *,n);
@@ -3559,6 +4314,13 @@ ADD::VectorCompose(
     FREE(X);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addVectorCompose is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("VectorCompose is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::VectorCompose
 
@@ -3567,6 +4329,9 @@ ADD
 ADD::NonSimCompose(
   ADDvector vector) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     int n = Cudd_ReadSize(mgr);
     DdNode **X = ALLOC(DdNode *,n);
@@ -3577,6 +4342,13 @@ ADD::NonSimCompose(
     FREE(X);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addNonSimCompose is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("NonSimCompose is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::NonSimCompose
 
@@ -4143,6 +4915,9 @@ ADD::MatrixMultiply(
   const ADD& B,
   ADDvector z) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int nz = z.count();
     DdManager *mgr = this->checkSameManager(B);
     DdNode **Z = ALLOC(DdNode *,nz);
@@ -4153,6 +4928,13 @@ ADD::MatrixMultiply(
     FREE(Z);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addMatrixMultiply is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("MatrixMultiply is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::MatrixMultiply
 
@@ -4162,6 +4944,9 @@ ADD::TimesPlus(
   const ADD& B,
   ADDvector z) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int nz = z.count();
     DdManager *mgr = this->checkSameManager(B);
     DdNode **Z = ALLOC(DdNode *,nz);
@@ -4172,6 +4957,13 @@ ADD::TimesPlus(
     FREE(Z);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addTimesPlus is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("TimesPlus is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::TimesPlus
 
@@ -4181,6 +4973,9 @@ ADD::Triangle(
   const ADD& g,
   ADDvector z) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int nz = z.count();
     DdManager *mgr = this->checkSameManager(g);
     DdNode **Z = ALLOC(DdNode *,nz);
@@ -4191,6 +4986,13 @@ ADD::Triangle(
     FREE(Z);
     this->checkReturnValue(result);
     return ADD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addTriangle is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("Triangle is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Triangle
 
@@ -4203,6 +5005,9 @@ BDD::PrioritySelect(
   const BDD& Pi,
   DD_PRFP Pifunc) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int n = x.count();
     DdManager *mgr = ddMgr->p->manager;
     DdNode **X = ALLOC(DdNode *,n);
@@ -4219,6 +5024,13 @@ BDD::PrioritySelect(
     FREE(Z);
     this->checkReturnValue(result);
     return BDD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_PrioritySelect is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("PrioritySelect is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // BDD::PrioritySelect
 
@@ -4229,6 +5041,9 @@ Cudd::Xgty(
   BDDvector x,
   BDDvector y)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int N = z.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,N);
@@ -4245,6 +5060,13 @@ Cudd::Xgty(
     FREE(Z);
     this->checkReturnValue(result);
     return BDD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_Xgty is not part of the NuSMV version of CUDD
+    p->errorHandler("Xgty is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::Xgty
 
@@ -4254,6 +5076,9 @@ Cudd::Xeqy(
   BDDvector x,
   BDDvector y)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int N = x.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,N);
@@ -4267,6 +5092,13 @@ Cudd::Xeqy(
     FREE(Y);
     this->checkReturnValue(result);
     return BDD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_Xeqy is not part of the NuSMV version of CUDD
+    p->errorHandler("Xeqy is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // BDD::Xeqy
 
@@ -4276,6 +5108,9 @@ Cudd::Xeqy(
   ADDvector x,
   ADDvector y)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int N = x.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,N);
@@ -4289,6 +5124,13 @@ Cudd::Xeqy(
     FREE(Y);
     this->checkReturnValue(result);
     return ADD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addXeqy is not part of the NuSMV version of CUDD
+    p->errorHandler("Xeqy is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // ADD::Xeqy
 
@@ -4299,6 +5141,9 @@ Cudd::Dxygtdxz(
   BDDvector y,
   BDDvector z)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int N = x.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,N);
@@ -4315,6 +5160,13 @@ Cudd::Dxygtdxz(
     FREE(Z);
     this->checkReturnValue(result);
     return BDD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_Dxygtdxz is not part of the NuSMV version of CUDD
+    p->errorHandler("Dxygtdxz is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::Dxygtdxz
 
@@ -4325,6 +5177,9 @@ Cudd::Dxygtdyz(
   BDDvector y,
   BDDvector z)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int N = x.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,N);
@@ -4338,6 +5193,13 @@ Cudd::Dxygtdyz(
     DdNode *result = Cudd_Dxygtdyz(mgr, N, X, Y, Z);
     this->checkReturnValue(result);
     return BDD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_Dxygtdyz is not part of the NuSMV version of CUDD
+    p->errorHandler("Dxygtdyz is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::Dxygtdyz
 
@@ -4346,10 +5208,20 @@ BDD
 BDD::CProjection(
   const BDD& Y) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(Y);
     DdNode *result = Cudd_CProjection(mgr, node, Y.node);
     this->checkReturnValue(result);
     return BDD(ddMgr, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_CProjection is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("CProjection is not available.");
+    return BDD();
+#endif
+    /* NuSMV: add end */
 
 } // BDD::CProjection
 
@@ -4359,9 +5231,19 @@ BDD::MinHammingDist(
   int *minterm,
   int upperBound) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = ddMgr->p->manager;
     int result = Cudd_MinHammingDist(mgr, node, minterm, upperBound);
     return result;
+    /* NuSMV: add begin */
+#else
+    // Cudd_MinHammingDist is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("MinHammingDist is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // BDD::MinHammingDist
 
@@ -4371,6 +5253,9 @@ Cudd::Hamming(
   ADDvector xVars,
   ADDvector yVars)
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     int nVars = xVars.count();
     DdManager *mgr = p->manager;
     DdNode **X = ALLOC(DdNode *,nVars);
@@ -4384,6 +5269,13 @@ Cudd::Hamming(
     FREE(Y);
     this->checkReturnValue(result);
     return ADD(this, result);
+    /* NuSMV: add begin */
+#else
+    // Cudd_addHamming is not part of the NuSMV version of CUDD
+    p->errorHandler("Hamming is not available.");
+    return ADD();
+#endif
+    /* NuSMV: add end */
 
 } // Cudd::Hamming
 
@@ -4561,8 +5453,18 @@ ADD::EqualSupNorm(
   CUDD_VALUE_TYPE tolerance,
   int pr) const
 {
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     DdManager *mgr = this->checkSameManager(g);
     return Cudd_EqualSupNorm(mgr, node, g.node, tolerance, pr);
+    /* NuSMV: add begin */
+#else
+    // Cudd_EqualSupNorm is not part of the NuSMV version of CUDD
+    ddMgr->p->errorHandler("EqualSupNorm is not available.");
+    return 0;
+#endif
+    /* NuSMV: add end */
 
 } // ADD::EqualSupNorm
 
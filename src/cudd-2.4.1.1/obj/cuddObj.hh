@@ -59,6 +59,11 @@
 
 #include <string>
 #include <iostream>
+/* NuSMV: add begin */
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+/* NuSMV: add end */
 #include "util.h"
 #include "cudd.h"
 
@@ -79,6 +84,10 @@ class Cudd;
 class BDDvector;
 class ADDvector;
 class ZDDvector;
+/* NuSMV: add begin */
+class BDDAndExpr;
+class BDDIteExpr;
+/* NuSMV: add end */
 
 typedef void (*PFC)(string);	// error function type
 
@@ -111,6 +120,12 @@ public:
     DD(Cudd *ddManager, DdNode *ddNode);
     DD();
     DD(const DD &from);
+    /* NuSMV: add begin */
+#if __cplusplus >= 201103L
+    DD(DD &&from) noexcept;
+#endif
+    DdNode * release();
+    /* NuSMV: add end */
     Cudd *manager() const;
     inline DdNode * getNode() const;
     int nodeCount() const;
@@ -118,6 +133,15 @@ public:
 
 }; // DD
 
+/* NuSMV: add begin */
+inline DdNode *
+DD::getNode() const
+{
+    return node;
+
+} // DD::getNode
+/* NuSMV: add end */
+
 
 /**Class***********************************************************************
 
@@ -136,6 +160,11 @@ public:
     ABDD(Cudd *bddManager, DdNode *bddNode);
     ABDD();
     ABDD(const ABDD &from);
+    /* NuSMV: add begin */
+#if __cplusplus >= 201103L
+    ABDD(ABDD &&from) noexcept;
+#endif
+    /* NuSMV: add end */
     virtual ~ABDD();
     int operator==(const ABDD &other) const;
     int operator!=(const ABDD &other) const;
@@ -179,9 +208,16 @@ public:
     BDD(Cudd *bddManager, DdNode *bddNode);
     BDD();
     BDD(const BDD &from);
+    /* NuSMV: add begin */
+#if __cplusplus >= 201103L
+    BDD(BDD &&from) noexcept;
+    BDD& operator=(BDD &&right) noexcept;
+#endif
+    static BDD adopt(Cudd *manager, DdNode *node);
+    /* NuSMV: add end */
     int operator==(const BDD& other) const;
     int operator!=(const BDD& other) const;
-    BDD operator=(const BDD& right);
+    BDD& operator=(const BDD& right);
     int operator<=(const BDD& other) const;
     int operator>=(const BDD& other) const;
     int operator<(const BDD& other) const;
@@ -189,18 +225,22 @@ public:
     BDD operator!() const;
     BDD operator~() const;
     BDD operator*(const BDD& other) const;
-    BDD operator*=(const BDD& other);
+    BDD& operator*=(const BDD& other);
     BDD operator&(const BDD& other) const;
-    BDD operator&=(const BDD& other);
+    BDD& operator&=(const BDD& other);
     BDD operator+(const BDD& other) const;
-    BDD operator+=(const BDD& other);
+    BDD& operator+=(const BDD& other);
     BDD operator|(const BDD& other) const;
-    BDD operator|=(const BDD& other);
+    BDD& operator|=(const BDD& other);
     BDD operator^(const BDD& other) const;
-    BDD operator^=(const BDD& other);
+    BDD& operator^=(const BDD& other);
     BDD operator-(const BDD& other) const;
-    BDD operator-=(const BDD& other);
+    BDD& operator-=(const BDD& other);
     BDD AndAbstract(const BDD& g, const BDD& cube) const;
+    /* NuSMV: add begin */
+    BDDAndExpr AndExpr(const BDD& g) const;
+    BDDIteExpr IteExpr(const BDD& g, const BDD& h) const;
+    /* NuSMV: add end */
     BDD AndAbstractLimit(const BDD& g, const BDD& cube, unsigned int limit)
 	const;
     BDD UnderApprox(
@@ -294,6 +334,57 @@ public:
 }; // BDD
 
 
+/* NuSMV: add begin */
+/**Class***********************************************************************
+
+  Synopsis     [Conjunction of two BDDs, not computed yet.]
+
+  Description  [Returned by BDD::AndExpr. The conjunction is only built
+  when converted to a BDD; abstracting it or testing it for emptiness
+  is done with a single CUDD operation, without building it. The
+  expression refers to its operands and must not outlive them.]
+
+  SeeAlso      [BDD::AndExpr BDDIteExpr]
+
+******************************************************************************/
+class BDDAndExpr {
+    const BDD &f;
+    const BDD &g;
+public:
+    BDDAndExpr(const BDD &f, const BDD &g) : f(f), g(g) {}
+    operator BDD() const;
+    BDD ExistAbstract(const BDD& cube) const;
+    int IsZero() const;
+
+}; // BDDAndExpr
+
+
+/**Class***********************************************************************
+
+  Synopsis     [If-then-else of three BDDs, not computed yet.]
+
+  Description  [Returned by BDD::IteExpr. The result is only built when
+  converted to a BDD; testing whether it is constant only uses
+  containment checks, which build no node. The expression refers to
+  its operands and must not outlive them.]
+
+  SeeAlso      [BDD::IteExpr BDDAndExpr]
+
+******************************************************************************/
+class BDDIteExpr {
+    const BDD &f;
+    const BDD &g;
+    const BDD &h;
+public:
+    BDDIteExpr(const BDD &f, const BDD &g, const BDD &h) : f(f), g(g), h(h) {}
+    operator BDD() const;
+    int IsZero() const;
+    int IsOne() const;
+
+}; // BDDIteExpr
+/* NuSMV: add end */
+
+
 /**Class***********************************************************************
 
   Synopsis     [Class for ADDs.]
@@ -309,9 +400,16 @@ public:
     ADD(Cudd *bddManager, DdNode *bddNode);
     ADD();
     ADD(const ADD &from);
+    /* NuSMV: add begin */
+#if __cplusplus >= 201103L
+    ADD(ADD &&from) noexcept;
+    ADD& operator=(ADD &&right) noexcept;
+#endif
+    static ADD adopt(Cudd *manager, DdNode *node);
+    /* NuSMV: add end */
     int operator==(const ADD& other) const;
     int operator!=(const ADD& other) const;
-    ADD operator=(const ADD& right);
+    ADD& operator=(const ADD& right);
     // Relational operators
     int operator<=(const ADD& other) const;
     int operator>=(const ADD& other) const;
@@ -320,17 +418,17 @@ public:
     // Arithmetic operators
     ADD operator-() const;
     ADD operator*(const ADD& other) const;
-    ADD operator*=(const ADD& other);
+    ADD& operator*=(const ADD& other);
     ADD operator+(const ADD& other) const;
-    ADD operator+=(const ADD& other);
+    ADD& operator+=(const ADD& other);
     ADD operator-(const ADD& other) const;
-    ADD operator-=(const ADD& other);
+    ADD& operator-=(const ADD& other);
     // Logical operators
     ADD operator~() const;
     ADD operator&(const ADD& other) const;
-    ADD operator&=(const ADD& other);
+    ADD& operator&=(const ADD& other);
     ADD operator|(const ADD& other) const;
-    ADD operator|=(const ADD& other);
+    ADD& operator|=(const ADD& other);
     ADD ExistAbstract(const ADD& cube) const;
     ADD UnivAbstract(const ADD& cube) const;
     ADD OrAbstract(const ADD& cube) const;
@@ -399,8 +497,15 @@ public:
     ZDD(Cudd *bddManager, DdNode *bddNode);
     ZDD();
     ZDD(const ZDD &from);
+    /* NuSMV: add begin */
+#if __cplusplus >= 201103L
+    ZDD(ZDD &&from) noexcept;
+    ZDD& operator=(ZDD &&right) noexcept;
+#endif
+    static ZDD adopt(Cudd *manager, DdNode *node);
+    /* NuSMV: add end */
     ~ZDD();
-    ZDD operator=(const ZDD& right);
+    ZDD& operator=(const ZDD& right);
     int operator==(const ZDD& other) const;
     int operator!=(const ZDD& other) const;
     int operator<=(const ZDD& other) const;
@@ -409,15 +514,15 @@ public:
     int operator>(const ZDD& other) const;
     void print(int nvars, int verbosity = 1) const;
     ZDD operator*(const ZDD& other) const;
-    ZDD operator*=(const ZDD& other);
+    ZDD& operator*=(const ZDD& other);
     ZDD operator&(const ZDD& other) const;
-    ZDD operator&=(const ZDD& other);
+    ZDD& operator&=(const ZDD& other);
     ZDD operator+(const ZDD& other) const;
-    ZDD operator+=(const ZDD& other);
+    ZDD& operator+=(const ZDD& other);
     ZDD operator|(const ZDD& other) const;
-    ZDD operator|=(const ZDD& other);
+    ZDD& operator|=(const ZDD& other);
     ZDD operator-(const ZDD& other) const;
-    ZDD operator-=(const ZDD& other);
+    ZDD& operator-=(const ZDD& other);
     int Count() const;
     double CountDouble() const;
     ZDD Product(const ZDD& g) const;
@@ -462,9 +567,15 @@ class Cudd {
 	PFC errorHandler;
 	int verbose;
 	int ref;
+	/* NuSMV: add begin */
+	int owner;		// whether the manager is quit with the capsule
+	/* NuSMV: add end */
     };
     capsule *p;
 public:
+    /* NuSMV: add begin */
+    Cudd(DdManager *manager);
+    /* NuSMV: add end */
     Cudd(
       unsigned int numVars = 0,
       unsigned int numVarsZ = 0,
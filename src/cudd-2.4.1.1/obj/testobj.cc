@@ -57,10 +57,67 @@
 static char rcsid[] UTIL_UNUSED = "$Id: testobj.cc,v 1.1.2.1 2010-02-04 10:41:21 nusmv Exp $";
 #endif
 
+/* NuSMV: add begin */
+/*---------------------------------------------------------------------------*/
+/* NuSMV functions used by CUDD                                              */
+/*---------------------------------------------------------------------------*/
+
+// The NuSMV version of CUDD prints and checks ADD leaves with NuSMV
+// functions. This program is not linked with NuSMV, and its leaves are the
+// constants given to Cudd_Init, 0 and 1.
+extern "C" {
+
+int
+print_node(
+  FILE * stream,
+  struct node * n)
+{
+    return fprintf(stream, "%ld", (long) n);
+
+} // print_node
+
+
+char *
+sprint_node(
+  struct node * n)
+{
+    char *result = (char *) malloc(24);
+    sprintf(result, "%ld", (long) n);
+    return result;
+
+} // sprint_node
+
+
+int
+node_is_failure(
+  struct node * x)
+{
+    return 0;
+
+} // node_is_failure
+
+
+void
+start_parsing_err(void)
+{
+} // start_parsing_err
+
+
+void
+finish_parsing_err(void)
+{
+} // finish_parsing_err
+
+}
+/* NuSMV: add end */
+
 /*---------------------------------------------------------------------------*/
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
+/* NuSMV: add begin */
+#if 0
+/* NuSMV: add end */
 static void testBdd(Cudd& mgr, int verbosity);
 static void testAdd(Cudd& mgr, int verbosity);
 static void testAdd2(Cudd& mgr, int verbosity);
@@ -69,6 +126,11 @@ static void testBdd2(Cudd& mgr, int verbosity);
 static void testBdd3(Cudd& mgr, int verbosity);
 static void testZdd2(Cudd& mgr, int verbosity);
 static void testBdd4(Cudd& mgr, int verbosity);
+/* NuSMV: add begin */
+#endif
+static void testNuSMV(Cudd& mgr, int verbosity);
+static void testNuSMVAdd(Cudd& mgr, int verbosity);
+/* NuSMV: add end */
 
 
 /*---------------------------------------------------------------------------*/
@@ -93,6 +155,9 @@ main()
 
     Cudd mgr(0,2);
     // mgr.makeVerbose();		// trace constructors and destructors
+    /* NuSMV: add begin */
+#if 0
+    /* NuSMV: add end */
     testBdd(mgr,verbosity);
     testAdd(mgr,verbosity);
     testAdd2(mgr,verbosity);
@@ -101,11 +166,22 @@ main()
     testBdd3(mgr,verbosity);
     testZdd2(mgr,verbosity);
     testBdd4(mgr,verbosity);
+    /* NuSMV: add begin */
+#else
+    // These tests print DDs, use ZDDs or transfer BDDs, which the NuSMV
+    // version of CUDD does not support.
+    testNuSMV(mgr,verbosity);
+    testNuSMVAdd(mgr,verbosity);
+#endif
+    /* NuSMV: add end */
     mgr.info();
     return 0;
 
 } // main
 
+/* NuSMV: add begin */
+#if 0
+/* NuSMV: add end */
 
 /**Function********************************************************************
 
@@ -494,3 +570,131 @@ testBdd4(
     cout << "f and h are" << (f == h ? "" : " not") << " identical\n";
 
 } // testBdd4
+/* NuSMV: add begin */
+#endif
+/* NuSMV: add end */
+
+
+/* NuSMV: add begin */
+/**Function********************************************************************
+
+  Synopsis    [Test the NuSMV additions to the interface.]
+
+  Description [Test move semantics, adoption and release of referenced
+  nodes, unevaluated conjunctions and if-then-else, and managers
+  wrapped without ownership. The function returns void because it
+  relies on the error hadling done by the interface. The default error
+  handler causes program termination.]
+
+  SideEffects [May create BDD variables in the manager.]
+
+  SeeAlso     [testBdd]
+
+******************************************************************************/
+static void
+testNuSMV(
+  Cudd& mgr,
+  int verbosity)
+{
+    cout << "Entering testNuSMV\n";
+    BDD x = mgr.bddVar(0);
+    BDD y = mgr.bddVar(1);
+    BDD z = mgr.bddVar(2);
+    DdManager *dd = mgr.getManager();
+
+    // Release and adopt: the reference is handed over, not duplicated.
+    BDD f = x * y;
+    DdNode *node = BDD(f).release();
+    BDD g = BDD::adopt(&mgr, node);
+    cout << "f and g are" << (f == g ? "" : " not") << " identical\n";
+
+#if __cplusplus >= 201103L
+    // Move semantics.
+    BDD h = std::move(g);
+    cout << "h is" << (h.getNode() == node ? "" : " not") << " f\n";
+    cout << "g is" << (g.getNode() == 0 ? "" : " not") << " empty\n";
+    g = std::move(h);
+    cout << "g is" << (g == f ? "" : " not") << " f again\n";
+#endif
+
+    // Unevaluated expressions.
+    BDD cube = y * z;
+    BDD e = f.AndExpr(!x).ExistAbstract(cube);
+    cout << "f * !x is" << (f.AndExpr(!x).IsZero() ? "" : " not") <<
+	" empty\n";
+    cout << "exists y z. (x * y * z) is" <<
+	(BDD(f.AndExpr(z)).ExistAbstract(cube) == x ? "" : " not") << " x\n";
+    cout << "e has " << e.CountMinterm(3) << " minterms\n";
+    cout << "x ? y : y is" << (x.IteExpr(y, y).IsOne() ? "" : " not") <<
+	" valid\n";
+    cout << "x ? 1 : !x is" << (x.IteExpr(mgr.bddOne(), !x).IsOne() ? "" :
+				" not") << " valid\n";
+    cout << "x ? !x : x is" << (x.IteExpr(!x, x).IsZero() ? "" : " not") <<
+	" empty\n";
+    cout << "ite is" << (BDD(x.IteExpr(y, z)) == x.Ite(y, z) ? "" : " not") <<
+	" x.Ite(y,z)\n";
+
+    // A wrapper that does not own its manager leaves it alive.
+    {
+	Cudd wrapper(dd);
+	BDD w = BDD::adopt(&wrapper, Cudd_bddIthVar(dd, 0));
+	Cudd_Ref(w.getNode());
+	cout << "w is" << (w.getNode() == x.getNode() ? "" : " not") << " x\n";
+    }
+    cout << "x has " << x.nodeCount() << " nodes\n";
+
+} // testNuSMV
+
+
+/**Function********************************************************************
+
+  Synopsis    [Test the ADD operators available in NuSMV.]
+
+  Description [Test the Boolean operators on 0-1 ADDs. The NuSMV
+  version of CUDD applies the operators given to Cudd_addApply to its
+  own leaves; the interface maps them to Cudd_addAnd, Cudd_addOr and
+  Cudd_addXor instead. The function returns void because it relies on
+  the error hadling done by the interface. The default error handler
+  causes program termination.]
+
+  SideEffects [May create ADD variables in the manager.]
+
+  SeeAlso     [testNuSMV]
+
+******************************************************************************/
+static void
+testNuSMVAdd(
+  Cudd& mgr,
+  int verbosity)
+{
+    cout << "Entering testNuSMVAdd\n";
+    ADD p = mgr.addVar(0);
+    ADD q = mgr.addVar(1);
+    ADD one = mgr.addOne();
+    ADD zero = mgr.addZero();
+
+    ADD r = p & q;
+    ADD s = p;
+    s &= q;
+    cout << "p & q and p &= q are" << (r == s ? "" : " not") <<
+	" identical\n";
+    cout << "p & !p is" << ((p & (p.Xor(one))) == zero ? "" : " not") <<
+	" zero\n";
+
+    r = p | q;
+    s = p;
+    s |= q;
+    cout << "p | q and p |= q are" << (r == s ? "" : " not") <<
+	" identical\n";
+    cout << "p | !p is" << ((p | (p.Xor(one))) == one ? "" : " not") <<
+	" one\n";
+
+    r = p.Xor(q);
+    s = (p & q.Xor(one)) | (p.Xor(one) & q);
+    cout << "p xor q is" << (r == s ? "" : " not") <<
+	" (p & !q) | (!p & q)\n";
+    cout << "p xor p is" << (p.Xor(p) == zero ? "" : " not") << " zero\n";
+    cout << "r has " << r.nodeCount() << " nodes\n";
+
+} // testNuSMVAdd
+/* NuSMV: add end */
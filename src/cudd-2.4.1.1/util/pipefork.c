@@ -40,7 +40,7 @@ int util_pipefork(char **argv,		/* normal argv argument list */
     int topipe[2], frompipe[2];
     char buffer[1024];
 
-#if (defined __hpux) || (defined __osf__) || (defined _IBMR2) || (defined __SVR4) || (defined __CYGWIN32__) || (defined __MINGW32__) 
+#if (defined __hpux) || (defined __osf__) || (defined _IBMR2) || (defined __SVR4) || (defined __CYGWIN32__) || (defined __MINGW32__) || (defined __GLIBC__)
     int status;
 #else
     union wait status;
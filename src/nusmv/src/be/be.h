@@ -88,6 +88,19 @@ typedef struct Be_Cnf_TAG* Be_Cnf_ptr; /* cnf representation */
 typedef void* be_ptr;
 
 
+/**Struct**********************************************************************
+
+  Synopsis    [A Boolean Expression compiled for repeated substitutions]
+
+  Description [Built by Be_LogicalTemplate_Create, and instantiated by
+  Be_LogicalTemplate_ShiftVar and Be_LogicalTemplate_VarSubst]
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct Be_Template_TAG* Be_Template_ptr;
+
+
 /**Struct**********************************************************************
 
   Synopsis    [Specific to generic BE conversion gateway type]
@@ -126,6 +139,22 @@ typedef void*  (*Be_Be2Spec_fun)(Be_Manager_ptr self, be_ptr be);
 #include "utils/utils.h" /* for EXTERN and ARGS */
 #include "utils/Slist.h"
 
+
+/**Struct**********************************************************************
+
+  Synopsis    [Equivalence oracle type]
+
+  Description [Used by Be_apply_sweeping to prove that two boolean
+  expressions are equivalent. Must return true only if the
+  equivalence has been proved.]
+
+  SeeAlso     [Be_apply_sweeping]
+
+******************************************************************************/
+typedef boolean (*Be_EquivCheck_fun)(Be_Manager_ptr self,
+                                     be_ptr a, be_ptr b, void* data);
+
+
 /*---------------------------------------------------------------------------*/
 /* Constant declarations                                                     */
 /*---------------------------------------------------------------------------*/
@@ -246,6 +275,25 @@ Be_LogicalVarSubst ARGS((Be_Manager_ptr manager, be_ptr f,
                          const int* log2phy, 
                          const int* phy2log));
 
+EXTERN Be_Template_ptr
+Be_LogicalTemplate_Create ARGS((Be_Manager_ptr manager, be_ptr f,
+                                const int* phy2log));
+
+EXTERN void
+Be_LogicalTemplate_Destroy ARGS((Be_Template_ptr self));
+
+EXTERN be_ptr
+Be_LogicalTemplate_ShiftVar ARGS((Be_Manager_ptr manager,
+                                  Be_Template_ptr self,
+                                  int shift,
+                                  const int* log2phy));
+
+EXTERN be_ptr
+Be_LogicalTemplate_VarSubst ARGS((Be_Manager_ptr manager,
+                                  Be_Template_ptr self,
+                                  int* subst,
+                                  const int* log2phy));
+
 
 /* ================================================== */
 
@@ -304,6 +352,13 @@ EXTERN int Be_BeLiteral_Negate ARGS((const Be_Manager_ptr self,
 EXTERN be_ptr 
 Be_apply_inlining ARGS((Be_Manager_ptr self, be_ptr f, boolean add_conj));
 
+EXTERN be_ptr
+Be_apply_balancing ARGS((Be_Manager_ptr self, be_ptr f));
+
+EXTERN be_ptr
+Be_apply_sweeping ARGS((Be_Manager_ptr self, be_ptr f,
+                        Be_EquivCheck_fun check, void* data));
+
 EXTERN void
 Be_Cnf_PrintStat ARGS((const Be_Cnf_ptr self, FILE* outFile, char* prefix));
 
@@ -61,6 +61,21 @@ const int BE_INVALID_SUBST_VALUE = RBC_INVALID_SUBST_VALUE;
 /* Structure declarations                                                    */
 /*---------------------------------------------------------------------------*/
 
+/**Struct**********************************************************************
+
+  Synopsis    [Adapts a be equivalence oracle to the rbc layer]
+
+  Description [Used by Be_apply_sweeping]
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct BeRbc_EquivCheckData_TAG {
+  Be_Manager_ptr mgr;
+  Be_EquivCheck_fun check;
+  void* data;
+} BeRbc_EquivCheckData;
+
 /*---------------------------------------------------------------------------*/
 /* Variable declarations                                                     */
 /*---------------------------------------------------------------------------*/
@@ -128,6 +143,8 @@ const int BE_INVALID_SUBST_VALUE = RBC_INVALID_SUBST_VALUE;
 /*---------------------------------------------------------------------------*/
 static void* beRbc_Be2Rbc(Be_Manager_ptr mgr, be_ptr be);
 static be_ptr beRbc_Rbc2Be(Be_Manager_ptr mgr, void* rbc);
+static boolean beRbc_equiv_check(Rbc_Manager_t* rbcm, Rbc_t* a, Rbc_t* b,
+                                 void* data);
 
 
 /**AutomaticEnd***************************************************************/
@@ -522,6 +539,102 @@ be_ptr Be_LogicalVarSubst(Be_Manager_ptr manager, be_ptr f, int* subst,
 }
 
 
+/**Function********************************************************************
+
+  Synopsis    [Compiles f into a template for repeated logical
+               shifting and substitution]
+
+  Description [The template keeps the variables of f at logical level
+               (phy2log maps the physical indices to the logical
+               ones). It can be instantiated many times with
+               Be_LogicalTemplate_ShiftVar and
+               Be_LogicalTemplate_VarSubst, each instantiation being a
+               single linear pass over the compiled expression.
+
+               The template remains valid as long as the logical
+               indices of the variables of f do not change. It must be
+               released with Be_LogicalTemplate_Destroy.]
+
+  SideEffects []
+
+  SeeAlso     [Be_LogicalTemplate_ShiftVar, Be_LogicalTemplate_VarSubst]
+
+******************************************************************************/
+Be_Template_ptr Be_LogicalTemplate_Create(Be_Manager_ptr manager, be_ptr f,
+                                          const int* phy2log)
+{
+  return (Be_Template_ptr) Rbc_TemplateCreate(GET_RBC_MGR(manager),
+                                              RBC(manager, f), phy2log);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Releases a template]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Be_LogicalTemplate_Create]
+
+******************************************************************************/
+void Be_LogicalTemplate_Destroy(Be_Template_ptr self)
+{
+  Rbc_TemplateDestroy((Rbc_Template_t*) self);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Instantiates a template by shifting its variables at
+               logical level]
+
+  Description [Returns the same expression Be_LogicalShiftVar would
+               return on the expression the template has been compiled
+               from.]
+
+  SideEffects []
+
+  SeeAlso     [Be_LogicalShiftVar]
+
+******************************************************************************/
+be_ptr Be_LogicalTemplate_ShiftVar(Be_Manager_ptr manager,
+                                   Be_Template_ptr self,
+                                   int shift, const int* log2phy)
+{
+  return BE(manager,
+            Rbc_TemplateLogicalShift(GET_RBC_MGR(manager),
+                                     (Rbc_Template_t*) self,
+                                     shift, log2phy));
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Instantiates a template by substituting its variables at
+               logical level]
+
+  Description [Returns the same expression Be_LogicalVarSubst would
+               return on the expression the template has been compiled
+               from.]
+
+  SideEffects []
+
+  SeeAlso     [Be_LogicalVarSubst]
+
+******************************************************************************/
+be_ptr Be_LogicalTemplate_VarSubst(Be_Manager_ptr manager,
+                                   Be_Template_ptr self,
+                                   int* subst, const int* log2phy)
+{
+  return BE(manager,
+            Rbc_TemplateLogicalSubst(GET_RBC_MGR(manager),
+                                     (Rbc_Template_t*) self,
+                                     subst, log2phy));
+}
+
+
 /**Function********************************************************************
 
   Synopsis    [Converts the given be into the corresponding CNF-ed be]
@@ -942,6 +1055,59 @@ be_ptr Be_apply_inlining(Be_Manager_ptr mgr, be_ptr f, boolean add_conj)
 }
 
 
+/**Function********************************************************************
+
+  Synopsis    [Rewrites the conjunctions of f as balanced trees]
+
+  Description [Returns an expression equivalent to f, where the
+  maximal conjunctions have been simplified and rebuilt as trees of
+  minimal depth.]
+
+  SideEffects []
+
+  SeeAlso     [Be_apply_sweeping, Rbc_Balance]
+
+******************************************************************************/
+be_ptr Be_apply_balancing(Be_Manager_ptr mgr, be_ptr f)
+{
+  /* lazy evaluation: */
+  if (Be_IsConstant(mgr, f)) return f;
+
+  return BE(mgr, Rbc_Balance(GET_RBC_MGR(mgr), RBC(mgr, f)));
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Merges the functionally equivalent subexpressions of f]
+
+  Description [Candidate equivalences are found by random simulation,
+  and every candidate is submitted to check. Only the equivalences
+  proved by check are merged, so the returned expression is
+  equivalent to f.]
+
+  SideEffects []
+
+  SeeAlso     [Be_apply_balancing, Rbc_Sweep]
+
+******************************************************************************/
+be_ptr Be_apply_sweeping(Be_Manager_ptr mgr, be_ptr f,
+                         Be_EquivCheck_fun check, void* data)
+{
+  BeRbc_EquivCheckData check_data;
+
+  /* lazy evaluation: */
+  if (Be_IsConstant(mgr, f)) return f;
+
+  check_data.mgr = mgr;
+  check_data.check = check;
+  check_data.data = data;
+
+  return BE(mgr, Rbc_Sweep(GET_RBC_MGR(mgr), RBC(mgr, f),
+                           beRbc_equiv_check, (void*) &check_data));
+}
+
+
 /*---------------------------------------------------------------------------*/
 /* Definitions of internal functions                                         */
 /*---------------------------------------------------------------------------*/
@@ -985,3 +1151,24 @@ static be_ptr beRbc_Rbc2Be(Be_Manager_ptr mgr, void* rbc)
 {
   return (be_ptr) rbc;
 }
+
+
+/**Function********************************************************************
+
+  Synopsis    [Calls the be equivalence oracle on two rbcs]
+
+  Description [Used as rbc equivalence oracle by Be_apply_sweeping]
+
+  SideEffects []
+
+  SeeAlso     [Be_apply_sweeping]
+
+******************************************************************************/
+static boolean beRbc_equiv_check(Rbc_Manager_t* rbcm, Rbc_t* a, Rbc_t* b,
+                                 void* data)
+{
+  BeRbc_EquivCheckData* cd = (BeRbc_EquivCheckData*) data;
+
+  return cd->check(cd->mgr, BE(cd->mgr, a), BE(cd->mgr, b), cd->data);
+}
+
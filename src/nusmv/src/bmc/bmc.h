@@ -82,6 +82,7 @@
 #define BMC_SBMC_IL_OPT "bmc_sbmc_il_opt"
 #define BMC_SBMC_GF_FG_OPT "bmc_sbmc_gf_fg_opt"
 #define BMC_SBMC_CACHE_OPT "bmc_sbmc_cache_opt"
+#define BMC_PARALLEL_INDUCTION "bmc_parallel_induction"
 
 
 /**Constant********************************************************************
@@ -176,6 +177,9 @@ EXTERN boolean opt_bmc_sbmc_il_opt ARGS((OptsHandler_ptr opt));
 EXTERN void set_bmc_sbmc_cache ARGS((OptsHandler_ptr opt));
 EXTERN void unset_bmc_sbmc_cache ARGS((OptsHandler_ptr opt));
 EXTERN boolean opt_bmc_sbmc_cache ARGS((OptsHandler_ptr opt));
+EXTERN void set_bmc_parallel_induction ARGS((OptsHandler_ptr opt));
+EXTERN void unset_bmc_parallel_induction ARGS((OptsHandler_ptr opt));
+EXTERN boolean opt_bmc_parallel_induction ARGS((OptsHandler_ptr opt));
 
 
 /**AutomaticEnd***************************************************************/
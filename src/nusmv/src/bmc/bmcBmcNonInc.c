@@ -76,6 +76,16 @@
 clock_t start_time;
 #endif
 
+#if NUSMV_HAVE_UNISTD_H && NUSMV_HAVE_SIGNAL_H && !defined(__MINGW32__)
+#define BMC_HAVE_FORK 1
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <time.h>
+#endif
+
 
 static char rcsid[] UTIL_UNUSED = "$Id: bmcBmcNonInc.c,v 1.1.2.13.2.8.4.18 2010-02-12 17:14:49 nusmv Exp $";
 
@@ -101,12 +111,74 @@ static char rcsid[] UTIL_UNUSED = "$Id: bmcBmcNonInc.c,v 1.1.2.13.2.8.4.18 2010-
 
 #define BMC_REWRITE_INVARSPEC_LAYER_NAME "bmc_invarspec_rewrite_layer"
 
+/* Exit codes of the processes solving problems in parallel */
+#define BMC_PROC_SAT       0
+#define BMC_PROC_UNSAT     1
+#define BMC_PROC_ERROR     2
+#define BMC_PROC_NO_SOLVER 3
+
+/* Delay between two polls of the processes solving problems in parallel */
+#define BMC_PROC_POLL_NSEC 1000000L
+
+/* Processes solving the Een/Sorensson problems in parallel: the base for
+   bound k, the steps for k and the steps for k+1 (the lookahead) */
+#define BMC_ES_BASE       0
+#define BMC_ES_STEPS      1
+#define BMC_ES_NEXT_STEPS 3
+#define BMC_ES_PROCS      5
+
 /**AutomaticStart*************************************************************/
 
 /*---------------------------------------------------------------------------*/
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
+static be_ptr
+bmc_een_sorensson_build_base ARGS((BeFsm_ptr be_fsm,
+                                   be_ptr be_invarspec,
+                                   be_ptr be_init,
+                                   int k));
+
+static void
+bmc_een_sorensson_build_steps ARGS((BeFsm_ptr be_fsm,
+                                    be_ptr be_invarspec,
+                                    be_ptr be_init,
+                                    lsList crnt_state_be_vars,
+                                    int k,
+                                    boolean use_extra_step,
+                                    be_ptr* be_steps));
+
+static void
+bmc_een_sorensson_print_no_proof ARGS((int k, Prop_ptr pp));
+
+#if BMC_HAVE_FORK
+static boolean
+bmc_een_sorensson_parallel ARGS((BeFsm_ptr be_fsm,
+                                 be_ptr be_invarspec,
+                                 be_ptr be_init,
+                                 lsList crnt_state_be_vars,
+                                 int max_k,
+                                 Prop_ptr pp,
+                                 boolean print_steps,
+                                 boolean use_extra_step,
+                                 int* k,
+                                 Bmc_result* result));
+
+static boolean
+bmc_induction_parallel ARGS((BeFsm_ptr be_fsm,
+                             node_ptr binvarspec,
+                             Bmc_result* result));
+
+static pid_t
+bmc_fork_solver ARGS((Be_Manager_ptr be_mgr, be_ptr be_prob));
+
+static int
+bmc_wait_any_solver ARGS((pid_t* pids, int num, int* code));
+
+static void
+bmc_kill_solvers ARGS((pid_t* pids, int num));
+#endif
+
 /*---------------------------------------------------------------------------*/
 /* Definition of exported functions                                          */
 /*---------------------------------------------------------------------------*/
@@ -591,6 +663,21 @@ Bmc_result Bmc_induction_algorithm(BeFsm_ptr be_fsm,
   be_enc = BeFsm_get_be_encoding(be_fsm);
   be_mgr = BeEnc_get_be_manager(be_enc);
 
+#if BMC_HAVE_FORK
+  /* The base and the step are solved by two child processes. The whole
+     problem is solved here only if they could not conclude, or to build
+     the counterexample of a failed induction. */
+  if (opt_bmc_parallel_induction(OptsHandler_get_instance())) {
+    Bmc_result par_result;
+
+    if (bmc_induction_parallel(be_fsm, binvarspec, &par_result) &&
+        ((BMC_UNKNOWN != par_result) ||
+         !opt_counter_examples(OptsHandler_get_instance()))) {
+      return par_result;
+    }
+  }
+#endif
+
   prob = Bmc_Gen_InvarProblem(be_fsm, binvarspec);
   prob = Bmc_Utils_apply_inlining(be_mgr, prob);
 
@@ -899,6 +986,19 @@ Bmc_result Bmc_een_sorensson_algorithm(BeFsm_ptr be_fsm,
   crnt_state_be_vars =
     Bmc_Utils_get_vars_list_for_uniqueness_fsm(be_enc, (SexpFsm_ptr) bool_fsm);
 
+#if BMC_HAVE_FORK
+  /* The problems are solved by child processes, no dumping is allowed in
+     this mode. The search goes on here if it stops without a result,
+     which also rebuilds the counterexample found by the base. */
+  if (opt_bmc_parallel_induction(OptsHandler_get_instance()) &&
+      (dump_type == BMC_DUMP_NONE)) {
+    solved = bmc_een_sorensson_parallel(be_fsm, be_invarspec, be_init,
+                                        crnt_state_be_vars, max_k, pp,
+                                        print_steps, use_extra_step,
+                                        &k, &result);
+  }
+#endif
+
   while (!solved && (k <= max_k)) {
     be_ptr be_base;
     Be_Cnf_ptr cnf;
@@ -908,22 +1008,7 @@ Bmc_result Bmc_een_sorensson_algorithm(BeFsm_ptr be_fsm,
       fprintf(nusmv_stderr, "\nBuilding the base for k=%d\n", k);
     }
 
-    /* Get the unrolling (s_0,...,s_k)*/
-    be_base = Bmc_Model_GetUnrolling(be_fsm, 0, k);
-    /* Set the initial condition to hold in s_0 */
-    be_base = Be_And(be_mgr, be_base, be_init);
-    /* The invariant property should be true in all s_0...s_{k-1}*/
-    for (i = 0; i < k; i++) {
-      be_base = Be_And(be_mgr, be_base,
-                       BeEnc_untimed_expr_to_timed(be_enc, be_invarspec, i));
-    }
-
-    /* The invariant property should be violated in s_k */
-    be_base = Be_And(be_mgr, be_base,
-                     Be_Not(be_mgr,
-                            BeEnc_untimed_expr_to_timed(be_enc,
-                                                        be_invarspec, k)));
-    be_base = Bmc_Utils_apply_inlining(be_mgr, be_base);
+    be_base = bmc_een_sorensson_build_base(be_fsm, be_invarspec, be_init, k);
 
     /* Problem is cnf-ed */
     cnf = (Be_Cnf_ptr) NULL;
@@ -1016,77 +1101,15 @@ Bmc_result Bmc_een_sorensson_algorithm(BeFsm_ptr be_fsm,
 
     /* induction step */
     if (!solved) {
-      /*
-         steps[0]: P(S0) ^ ... ^ P(Si-1) ^ !P(Si) ^ path(0..i) ^
-         loopFree(0..i)
-
-         steps[1]: Init(S0) ^ !Init(S1) ^ ... ^ !Init(Si) ^ path(0..i)
-         ^ loopFree(0..i)
-      */
       be_ptr be_steps[3] = {(be_ptr)NULL, (be_ptr)NULL, (be_ptr)NULL};
-      be_ptr be_unique;
-      int j;
 
       if (opt_verbose_level_gt(OptsHandler_get_instance(), 0)) {
         fprintf(nusmv_stderr, "\nBuilding the step for k=%d\n", k);
       }
 
-      /* Get the unrolling (s_0,...,s_k)*/
-      be_steps[0] = Bmc_Model_GetUnrolling(be_fsm, 0, k);
-
-      if (use_extra_step) {
-        /* The same for the extra step, plus the initial states @0 */
-        be_steps[1] = Be_And(be_mgr, be_steps[0], be_init);
-      }
-
-      /* The invariant property should be true in all s_0...s_{k-1}*/
-      for (i = 0; i < k; i++) {
-        be_steps[0] = Be_And(be_mgr,
-                             be_steps[0],
-                             BeEnc_untimed_expr_to_timed(be_enc,
-                                                         be_invarspec, i));
-
-        if (use_extra_step) {
-          be_steps[1] = Be_And(be_mgr, be_steps[1],
-                               Be_Not(be_mgr,
-                                      Bmc_Model_GetInitI(be_fsm, i + 1)));
-        }
-      }
-
-      /* The invariant property should be violated in s_k */
-      be_steps[0] = Be_And(be_mgr, be_steps[0],
-                           Be_Not(be_mgr,
-                                  BeEnc_untimed_expr_to_timed(be_enc,
-                                                              be_invarspec,
-                                                              k)));
-
-      /* All states s_0,...,s_{k-1} should be different.
-       * Insert and force to true s_j != s_i for each 0 <= j < i <= k-1
-       * in frame 0 */
-      be_unique = Be_Truth(be_mgr);
-      for (i = 0; i < k ; i++) {
-        for (j = 0; j < i; j++) {
-          be_ptr not_equal = Be_Falsity(be_mgr);
-          be_ptr be_var;
-          lsGen gen;
-
-          lsForEachItem(crnt_state_be_vars, gen, be_var) {
-            be_ptr be_xor = Be_Xor(be_mgr,
-                                   BeEnc_untimed_expr_to_timed(be_enc, be_var, i),
-                                   BeEnc_untimed_expr_to_timed(be_enc, be_var, j));
-            not_equal = Be_Or(be_mgr, not_equal, be_xor);
-          }
-
-          be_unique = Be_And(be_mgr, be_unique, not_equal);
-        }
-      } /* for i */
-      be_steps[0] = Be_And(be_mgr, be_steps[0], be_unique);
-      be_steps[0] = Bmc_Utils_apply_inlining(be_mgr, be_steps[0]);
-
-      if (use_extra_step) {
-        be_steps[1] = Be_And(be_mgr, be_steps[1], be_unique);
-        be_steps[1] = Bmc_Utils_apply_inlining(be_mgr, be_steps[1]);
-      }
+      bmc_een_sorensson_build_steps(be_fsm, be_invarspec, be_init,
+                                    crnt_state_be_vars, k, use_extra_step,
+                                    be_steps);
 
       nusmv_assert(use_extra_step || (be_ptr)NULL == be_steps[1]);
 
@@ -1147,13 +1170,7 @@ Bmc_result Bmc_een_sorensson_algorithm(BeFsm_ptr be_fsm,
           if (print_steps) {
             /* Prints out the current state of solving, and continues
                the loop */
-            fprintf(nusmv_stdout,
-                    "-- no proof or counterexample found with bound %d", k);
-            if ((PROP(NULL) != pp) && opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
-              fprintf(nusmv_stdout, " for ");
-              print_invar(nusmv_stdout, pp);
-            }
-            fprintf(nusmv_stdout, "\n");
+            bmc_een_sorensson_print_no_proof(k, pp);
           }
           break;
 
@@ -1208,5 +1225,551 @@ Bmc_result Bmc_een_sorensson_algorithm(BeFsm_ptr be_fsm,
 /* Definition of static functions                                            */
 /*---------------------------------------------------------------------------*/
 
+/**Function********************************************************************
+
+   Synopsis           [Builds the base problem of the Een/Sorensson method
+                       for the bound k]
+
+   Description        [Returns Init(S0) ^ path(0..k) ^ P(S0) ^ ... ^
+                       P(Sk-1) ^ !P(Sk), inlined.]
+
+   SideEffects        []
+
+   SeeAlso            [bmc_een_sorensson_build_steps]
+
+******************************************************************************/
+static be_ptr bmc_een_sorensson_build_base(BeFsm_ptr be_fsm,
+                                           be_ptr be_invarspec,
+                                           be_ptr be_init,
+                                           int k)
+{
+  BeEnc_ptr be_enc = BeFsm_get_be_encoding(be_fsm);
+  Be_Manager_ptr be_mgr = BeEnc_get_be_manager(be_enc);
+  be_ptr be_base;
+  int i;
+
+  /* Get the unrolling (s_0,...,s_k)*/
+  be_base = Bmc_Model_GetUnrolling(be_fsm, 0, k);
+  /* Set the initial condition to hold in s_0 */
+  be_base = Be_And(be_mgr, be_base, be_init);
+  /* The invariant property should be true in all s_0...s_{k-1}*/
+  for (i = 0; i < k; i++) {
+    be_base = Be_And(be_mgr, be_base,
+                     BeEnc_untimed_expr_to_timed(be_enc, be_invarspec, i));
+  }
+
+  /* The invariant property should be violated in s_k */
+  be_base = Be_And(be_mgr, be_base,
+                   Be_Not(be_mgr,
+                          BeEnc_untimed_expr_to_timed(be_enc,
+                                                      be_invarspec, k)));
+  return Bmc_Utils_apply_inlining(be_mgr, be_base);
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Builds the induction step problems of the
+                       Een/Sorensson method for the bound k]
+
+   Description        [be_steps must have room for three elements.
+                       be_steps[0] is set to P(S0) ^ ... ^ P(Sk-1) ^ !P(Sk)
+                       ^ path(0..k) ^ loopFree(0..k). If use_extra_step is
+                       true, be_steps[1] is set to Init(S0) ^ !Init(S1) ^
+                       ... ^ !Init(Sk) ^ path(0..k) ^ loopFree(0..k). The
+                       remaining elements are set to NULL.]
+
+   SideEffects        [be_steps is filled in]
+
+   SeeAlso            [Bmc_een_sorensson_algorithm]
+
+******************************************************************************/
+static void bmc_een_sorensson_build_steps(BeFsm_ptr be_fsm,
+                                          be_ptr be_invarspec,
+                                          be_ptr be_init,
+                                          lsList crnt_state_be_vars,
+                                          int k,
+                                          boolean use_extra_step,
+                                          be_ptr* be_steps)
+{
+  BeEnc_ptr be_enc = BeFsm_get_be_encoding(be_fsm);
+  Be_Manager_ptr be_mgr = BeEnc_get_be_manager(be_enc);
+  be_ptr be_unique;
+  int i, j;
+
+  be_steps[0] = be_steps[1] = be_steps[2] = (be_ptr)NULL;
+
+  /* Get the unrolling (s_0,...,s_k)*/
+  be_steps[0] = Bmc_Model_GetUnrolling(be_fsm, 0, k);
+
+  if (use_extra_step) {
+    /* The same for the extra step, plus the initial states @0 */
+    be_steps[1] = Be_And(be_mgr, be_steps[0], be_init);
+  }
+
+  /* The invariant property should be true in all s_0...s_{k-1}*/
+  for (i = 0; i < k; i++) {
+    be_steps[0] = Be_And(be_mgr,
+                         be_steps[0],
+                         BeEnc_untimed_expr_to_timed(be_enc,
+                                                     be_invarspec, i));
+
+    if (use_extra_step) {
+      be_steps[1] = Be_And(be_mgr, be_steps[1],
+                           Be_Not(be_mgr,
+                                  Bmc_Model_GetInitI(be_fsm, i + 1)));
+    }
+  }
+
+  /* The invariant property should be violated in s_k */
+  be_steps[0] = Be_And(be_mgr, be_steps[0],
+                       Be_Not(be_mgr,
+                              BeEnc_untimed_expr_to_timed(be_enc,
+                                                          be_invarspec,
+                                                          k)));
+
+  /* All states s_0,...,s_{k-1} should be different.
+   * Insert and force to true s_j != s_i for each 0 <= j < i <= k-1
+   * in frame 0 */
+  be_unique = Be_Truth(be_mgr);
+  for (i = 0; i < k ; i++) {
+    for (j = 0; j < i; j++) {
+      be_ptr not_equal = Be_Falsity(be_mgr);
+      be_ptr be_var;
+      lsGen gen;
+
+      lsForEachItem(crnt_state_be_vars, gen, be_var) {
+        be_ptr be_xor = Be_Xor(be_mgr,
+                               BeEnc_untimed_expr_to_timed(be_enc, be_var, i),
+                               BeEnc_untimed_expr_to_timed(be_enc, be_var, j));
+        not_equal = Be_Or(be_mgr, not_equal, be_xor);
+      }
+
+      be_unique = Be_And(be_mgr, be_unique, not_equal);
+    }
+  } /* for i */
+  be_steps[0] = Be_And(be_mgr, be_steps[0], be_unique);
+  be_steps[0] = Bmc_Utils_apply_inlining(be_mgr, be_steps[0]);
+
+  if (use_extra_step) {
+    be_steps[1] = Be_And(be_mgr, be_steps[1], be_unique);
+    be_steps[1] = Bmc_Utils_apply_inlining(be_mgr, be_steps[1]);
+  }
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Prints that the induction step failed for bound k]
+
+   Description        []
+
+   SideEffects        []
+
+   SeeAlso            [Bmc_een_sorensson_algorithm]
+
+******************************************************************************/
+static void bmc_een_sorensson_print_no_proof(int k, Prop_ptr pp)
+{
+  fprintf(nusmv_stdout,
+          "-- no proof or counterexample found with bound %d", k);
+  if ((PROP(NULL) != pp) && opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+    fprintf(nusmv_stdout, " for ");
+    print_invar(nusmv_stdout, pp);
+  }
+  fprintf(nusmv_stdout, "\n");
+}
+
+
+#if BMC_HAVE_FORK
+/**Function********************************************************************
+
+   Synopsis           [Solves the Een/Sorensson problems in child processes]
+
+   Description        [Starting from bound *k, the base for bound k, the
+                       induction steps for bound k and the steps for bound
+                       k+1 (the lookahead) are solved at the same time by
+                       child processes. The first process to answer is
+                       taken into account, and the others are killed as
+                       soon as the property is decided:
+                       - a satisfiable base makes the property false;
+                       - a step for k proven unsatisfiable makes it true,
+                         as the bases up to k-1 are unsatisfiable, even
+                         if the base for k is still running;
+                       - a step for k+1 proven unsatisfiable makes it true
+                         as soon as the base for k is unsatisfiable.
+                       Otherwise the search moves to k+1 once the base and
+                       the steps for k are solved, the lookahead steps
+                       becoming the steps for k+1.
+
+                       Returns true if the property is decided, and sets
+                       result accordingly. Returns false if the search
+                       ends with no result, or stops at bound *k because
+                       a counterexample must be built, a process could not
+                       be created or the solver is not available; in these
+                       cases the caller goes on sequentially from *k.
+                       Learned clauses are not shared between the
+                       processes.]
+
+   SideEffects        [*k is set to the bound the search stopped at]
+
+   SeeAlso            [Bmc_een_sorensson_algorithm]
+
+******************************************************************************/
+static boolean bmc_een_sorensson_parallel(BeFsm_ptr be_fsm,
+                                          be_ptr be_invarspec,
+                                          be_ptr be_init,
+                                          lsList crnt_state_be_vars,
+                                          int max_k,
+                                          Prop_ptr pp,
+                                          boolean print_steps,
+                                          boolean use_extra_step,
+                                          int* k,
+                                          Bmc_result* result)
+{
+  Be_Manager_ptr be_mgr =
+    BeEnc_get_be_manager(BeFsm_get_be_encoding(be_fsm));
+  pid_t pids[BMC_ES_PROCS];
+  int num_steps, failed_steps; /* steps for k, and those satisfiable */
+  int num_next, failed_next;   /* the same for the lookahead steps */
+  boolean next_proved;
+  boolean solved;
+  int i;
+
+  for (i = 0; i < BMC_ES_PROCS; ++i) pids[i] = (pid_t) -1;
+  num_next = failed_next = 0;
+  solved = false;
+
+  while (!solved && (*k <= max_k)) {
+    boolean base_unsat = false;
+    boolean forked = true;
+
+    /* the lookahead steps become the steps for k */
+    pids[BMC_ES_STEPS] = pids[BMC_ES_NEXT_STEPS];
+    pids[BMC_ES_STEPS + 1] = pids[BMC_ES_NEXT_STEPS + 1];
+    pids[BMC_ES_NEXT_STEPS] = pids[BMC_ES_NEXT_STEPS + 1] = (pid_t) -1;
+    num_steps = num_next;
+    failed_steps = failed_next;
+    num_next = failed_next = 0;
+    next_proved = false;
+
+    if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+      fprintf(nusmv_stderr, "\nBuilding the base for k=%d\n", *k);
+    }
+
+    /* the buffered output must not be duplicated by the children */
+    fflush(nusmv_stdout);
+    fflush(nusmv_stderr);
+
+    pids[BMC_ES_BASE] =
+      bmc_fork_solver(be_mgr, bmc_een_sorensson_build_base(be_fsm,
+                                                           be_invarspec,
+                                                           be_init, *k));
+    forked = (pids[BMC_ES_BASE] > 0);
+
+    /* the steps for k are only built here for the first bound, then
+       the steps for k+1 are started in advance */
+    for (i = ((0 == num_steps) ? *k : *k + 1);
+         forked && (i <= *k + 1) && (i <= max_k); ++i) {
+      be_ptr be_steps[3];
+      pid_t* step_pids;
+      int* num;
+      int j;
+
+      if (opt_verbose_level_gt(OptsHandler_get_instance(), 0)) {
+        fprintf(nusmv_stderr, "\nBuilding the step for k=%d\n", i);
+      }
+
+      bmc_een_sorensson_build_steps(be_fsm, be_invarspec, be_init,
+                                    crnt_state_be_vars, i, use_extra_step,
+                                    be_steps);
+
+      step_pids = pids + ((i == *k) ? BMC_ES_STEPS : BMC_ES_NEXT_STEPS);
+      num = (i == *k) ? &num_steps : &num_next;
+
+      fflush(nusmv_stdout);
+      fflush(nusmv_stderr);
+
+      for (j = 0; forked && ((be_ptr)NULL != be_steps[j]); ++j) {
+        step_pids[j] = bmc_fork_solver(be_mgr, be_steps[j]);
+        forked = (step_pids[j] > 0);
+        if (forked) *num += 1;
+      }
+    }
+
+    if (!forked) {
+      /* the search goes on sequentially from k */
+      bmc_kill_solvers(pids, BMC_ES_PROCS);
+      return false;
+    }
+
+    /* waits until the property is decided or the bound k is done */
+    while (!solved && !(base_unsat && (failed_steps == num_steps))) {
+      int code;
+      const int which = bmc_wait_any_solver(pids, BMC_ES_PROCS, &code);
+
+      nusmv_assert(which >= 0);
+
+      if ((BMC_PROC_SAT != code) && (BMC_PROC_UNSAT != code)) {
+        bmc_kill_solvers(pids, BMC_ES_PROCS);
+
+        /* the missing solver is reported by the sequential search */
+        if (BMC_PROC_NO_SOLVER == code) return false;
+
+        internal_error("Sorry, solver answered with a fatal Internal "
+                       "Failure during problem solving.\n");
+      }
+
+      if (BMC_ES_BASE == which) {
+        if (BMC_PROC_SAT == code) {
+          bmc_kill_solvers(pids, BMC_ES_PROCS);
+
+          /* the counterexample is built by the sequential search */
+          if (opt_counter_examples(OptsHandler_get_instance())) return false;
+
+          *result = BMC_FALSE;
+          solved = true;
+        }
+        else {
+          base_unsat = true;
+          solved = next_proved;
+        }
+      }
+      else if (which < BMC_ES_NEXT_STEPS) {
+        if (BMC_PROC_UNSAT == code) solved = true;
+        else failed_steps += 1;
+      }
+      else {
+        if (BMC_PROC_UNSAT == code) {
+          next_proved = true;
+          solved = base_unsat;
+        }
+        else failed_next += 1;
+      }
+
+      if (solved && (BMC_ES_BASE != which || BMC_PROC_UNSAT == code)) {
+        *result = BMC_TRUE;
+      }
+    }
+
+    if (!solved) {
+      if (print_steps) {
+        for (i = 0; i < num_steps; ++i) {
+          bmc_een_sorensson_print_no_proof(*k, pp);
+        }
+      }
+      *k = *k + 1;
+    }
+  }
+
+  bmc_kill_solvers(pids, BMC_ES_PROCS);
+  return solved;
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Solves the classic induction problem in child
+                       processes]
+
+   Description        [The negated base and the negated induction step are
+                       solved at the same time by two child processes.
+                       As soon as one of them is satisfiable the induction
+                       fails, and the other process is killed. Returns
+                       true and sets result to BMC_TRUE or BMC_UNKNOWN if
+                       the induction is decided, false if a process could
+                       not be created or the solver is not available.]
+
+   SideEffects        []
+
+   SeeAlso            [Bmc_induction_algorithm]
+
+******************************************************************************/
+static boolean bmc_induction_parallel(BeFsm_ptr be_fsm,
+                                      node_ptr binvarspec,
+                                      Bmc_result* result)
+{
+  Be_Manager_ptr be_mgr =
+    BeEnc_get_be_manager(BeFsm_get_be_encoding(be_fsm));
+  be_ptr be_probs[2];
+  pid_t pids[2];
+  int proved = 0;
+  int code = BMC_PROC_ERROR;
+  int i;
+
+  be_probs[0] = Be_Not(be_mgr, Bmc_Gen_InvarBaseStep(be_fsm, binvarspec));
+  be_probs[1] = Be_Not(be_mgr, Bmc_Gen_InvarInductStep(be_fsm, binvarspec));
+
+  /* the buffered output must not be duplicated by the children */
+  fflush(nusmv_stdout);
+  fflush(nusmv_stderr);
+
+  for (i = 0; i < 2; ++i) {
+    pids[i] = bmc_fork_solver(be_mgr,
+                              Bmc_Utils_apply_inlining(be_mgr, be_probs[i]));
+    if (pids[i] < 0) {
+      bmc_kill_solvers(pids, i);
+      return false;
+    }
+  }
+
+  while ((proved < 2) && (bmc_wait_any_solver(pids, 2, &code) >= 0) &&
+         (BMC_PROC_UNSAT == code)) {
+    proved += 1;
+  }
+  bmc_kill_solvers(pids, 2);
+
+  if (2 == proved) {
+    *result = BMC_TRUE;
+    return true;
+  }
+
+  switch (code) {
+  case BMC_PROC_SAT:
+    *result = BMC_UNKNOWN;
+    return true;
+
+  case BMC_PROC_NO_SOLVER:
+    /* reported by the sequential algorithm */
+    return false;
+
+  default:
+    internal_error("Sorry, solver answered with a fatal Internal "
+                   "Failure during problem solving.\n");
+  }
+
+  return false;
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Solves a problem in a child process]
+
+   Description        [Forks a process that converts be_prob to CNF, solves
+                       it with a fresh non-incremental solver and exits
+                       with BMC_PROC_UNSAT if it is unsatisfiable,
+                       BMC_PROC_SAT if it is satisfiable,
+                       BMC_PROC_NO_SOLVER if the solver is not available
+                       and BMC_PROC_ERROR otherwise. Returns the pid of the
+                       child, or -1 if the process could not be created.]
+
+   SideEffects        [A child process is created]
+
+   SeeAlso            [bmc_wait_any_solver, bmc_kill_solvers]
+
+******************************************************************************/
+static pid_t bmc_fork_solver(Be_Manager_ptr be_mgr, be_ptr be_prob)
+{
+  pid_t pid = fork();
+
+  if (0 == pid) {
+    SatSolver_ptr solver;
+    SatSolverResult sat_res;
+    Be_Cnf_ptr cnf;
+    int code;
+
+    solver = Sat_CreateNonIncSolver(get_sat_solver(OptsHandler_get_instance()));
+    if (solver == SAT_SOLVER(NULL)) _exit(BMC_PROC_NO_SOLVER);
+
+    cnf = Be_ConvertToCnf(be_mgr, be_prob, 1);
+    SatSolver_add(solver, cnf, SatSolver_get_permanent_group(solver));
+    SatSolver_set_polarity(solver, cnf, 1,
+                           SatSolver_get_permanent_group(solver));
+    sat_res = SatSolver_solve_all_groups(solver);
+
+    switch (sat_res) {
+    case SAT_SOLVER_UNSATISFIABLE_PROBLEM: code = BMC_PROC_UNSAT; break;
+    case SAT_SOLVER_SATISFIABLE_PROBLEM: code = BMC_PROC_SAT; break;
+    default: code = BMC_PROC_ERROR;
+    }
+
+    /* no cleanup: the process image is simply thrown away */
+    fflush(nusmv_stderr);
+    _exit(code);
+  }
+
+  return pid;
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Waits for the first of the given processes to end]
+
+   Description        [Only the processes in pids (entries not greater than
+                       0 are skipped) are waited for, by polling them in
+                       turn, so that the other children of NuSMV are left
+                       alone. Returns the index of the process that ended
+                       and sets code to its exit code, or to
+                       BMC_PROC_ERROR if it did not exit normally. Returns
+                       -1 if no process is left.]
+
+   SideEffects        [The entry of the ended process is set to -1]
+
+   SeeAlso            [bmc_fork_solver, bmc_kill_solvers]
+
+******************************************************************************/
+static int bmc_wait_any_solver(pid_t* pids, int num, int* code)
+{
+  const struct timespec delay = {0, BMC_PROC_POLL_NSEC};
+
+  while (true) {
+    boolean running = false;
+    int i;
+
+    for (i = 0; i < num; ++i) {
+      int status;
+      pid_t pid;
+
+      if (pids[i] <= 0) continue;
+
+      pid = waitpid(pids[i], &status, WNOHANG);
+      if (0 == pid || ((pid < 0) && (EINTR == errno))) {
+        running = true;
+        continue;
+      }
+
+      /* the process is terminated, or is not a child any more */
+      pids[i] = (pid_t) -1;
+      *code = ((pid > 0) && WIFEXITED(status)) ?
+        WEXITSTATUS(status) : BMC_PROC_ERROR;
+      return i;
+    }
+
+    if (!running) return -1;
+    nanosleep(&delay, (struct timespec*) NULL);
+  }
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Kills and reaps the given processes]
+
+   Description        [Entries of pids not greater than 0 are skipped.]
+
+   SideEffects        [The entries of pids are set to -1]
+
+   SeeAlso            [bmc_fork_solver, bmc_wait_any_solver]
+
+******************************************************************************/
+static void bmc_kill_solvers(pid_t* pids, int num)
+{
+  int i;
+
+  for (i = 0; i < num; ++i) {
+    if (pids[i] > 0) kill(pids[i], SIGKILL);
+  }
+
+  for (i = 0; i < num; ++i) {
+    if (pids[i] > 0) {
+      while ((waitpid(pids[i], (int*) NULL, 0) < 0) && (EINTR == errno));
+      pids[i] = (pid_t) -1;
+    }
+  }
+}
+#endif
+
 
 /**AutomaticEnd***************************************************************/
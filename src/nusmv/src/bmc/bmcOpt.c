@@ -183,6 +183,10 @@ void Bmc_init_opt()
                                          true, false);
   nusmv_assert(res);
 
+  res = OptsHandler_register_bool_option(opts, BMC_PARALLEL_INDUCTION,
+                                         false, true);
+  nusmv_assert(res);
+
 
   res = OptsHandler_register_bool_option(opts, BMC_OPT_INITIALIZED,
                                          true, false);
@@ -367,6 +371,25 @@ boolean opt_bmc_sbmc_cache(OptsHandler_ptr opt)
   return OptsHandler_get_bool_option_value(opt, BMC_SBMC_CACHE_OPT);
 }
 
+void set_bmc_parallel_induction(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, BMC_PARALLEL_INDUCTION,
+                                                  true);
+  nusmv_assert(res);
+}
+
+void unset_bmc_parallel_induction(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, BMC_PARALLEL_INDUCTION,
+                                                  false);
+  nusmv_assert(res);
+}
+
+boolean opt_bmc_parallel_induction(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_bool_option_value(opt, BMC_PARALLEL_INDUCTION);
+}
+
 
 /*---------------------------------------------------------------------------*/
 /* Definition of internal functions                                          */
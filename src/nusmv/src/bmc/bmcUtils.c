@@ -44,6 +44,8 @@
 
 #include "parser/parser.h"
 #include "parser/symbols.h"
+#include "sat/sat.h" /* for solver and result */
+#include "sat/SatSolver.h"
 
 #include <limits.h>
 
@@ -91,6 +93,13 @@ bmc_utils_costraint_from_string ARGS((BeEnc_ptr be_enc,
                                       boolean accept_next_expr,
                                       Expr_ptr* node_expr));
 
+static be_ptr
+bmc_utils_simplify ARGS((Be_Manager_ptr be_mgr, be_ptr f));
+
+static boolean
+bmc_utils_sat_equivalence ARGS((Be_Manager_ptr be_mgr, be_ptr a, be_ptr b,
+                                void* data));
+
 /**AutomaticEnd***************************************************************/
 
 
@@ -656,20 +665,24 @@ lsList Bmc_Utils_get_vars_list_for_uniqueness_fsm(BeEnc_ptr be_enc,
   Synopsis    [Applies inlining taking into account of current user
                settings]
 
-  Description []
+  Description [After inlining, the formula is also balanced and
+               swept if the corresponding options (rbc_balancing and
+               rbc_sweeping) are set]
 
   SideEffects []
 
-  SeeAlso     []
+  SeeAlso     [Bmc_Utils_apply_inlining4inc]
 
 ******************************************************************************/
 be_ptr Bmc_Utils_apply_inlining(Be_Manager_ptr be_mgr, be_ptr f)
 {
-  if (!opt_rbc_inlining(OptsHandler_get_instance())) return f;
+  if (opt_rbc_inlining(OptsHandler_get_instance())) {
+    f = Be_apply_inlining(be_mgr, f,
+                          (!opt_rbc_inlining_lazy(OptsHandler_get_instance()) &&
+                           opt_counter_examples(OptsHandler_get_instance())));
+  }
 
-  return Be_apply_inlining(be_mgr, f,
-                           (!opt_rbc_inlining_lazy(OptsHandler_get_instance()) &&
-                            opt_counter_examples(OptsHandler_get_instance())));
+  return bmc_utils_simplify(be_mgr, f);
 }
 
 
@@ -679,18 +692,22 @@ be_ptr Bmc_Utils_apply_inlining(Be_Manager_ptr be_mgr, be_ptr f)
                set. Useful in the incremental SAT applications to
                guarantee soundness]
 
-  Description []
+  Description [After inlining, the formula is also balanced and
+               swept if the corresponding options (rbc_balancing and
+               rbc_sweeping) are set]
 
   SideEffects []
 
-  SeeAlso     []
+  SeeAlso     [Bmc_Utils_apply_inlining]
 
 ******************************************************************************/
 be_ptr Bmc_Utils_apply_inlining4inc(Be_Manager_ptr be_mgr, be_ptr f)
 {
-  if (!opt_rbc_inlining(OptsHandler_get_instance())) return f;
+  if (opt_rbc_inlining(OptsHandler_get_instance())) {
+    f = Be_apply_inlining(be_mgr, f, true);
+  }
 
-  return Be_apply_inlining(be_mgr, f, true);
+  return bmc_utils_simplify(be_mgr, f);
 }
 
 
@@ -810,3 +827,83 @@ bmc_utils_costraint_from_string(BeEnc_ptr be_enc,
 
   return result;
 }
+
+
+
+/**Function********************************************************************
+
+  Synopsis    [Applies balancing and sweeping taking into account of
+               current user settings]
+
+  Description [The returned formula is equivalent to f. Sweeping uses
+               a single instance of the current incremental SAT solver
+               to prove all the candidate equivalences, and is skipped
+               if that solver is not available.]
+
+  SideEffects []
+
+  SeeAlso     [Be_apply_balancing, Be_apply_sweeping]
+
+******************************************************************************/
+static be_ptr bmc_utils_simplify(Be_Manager_ptr be_mgr, be_ptr f)
+{
+  if (opt_rbc_balancing(OptsHandler_get_instance())) {
+    f = Be_apply_balancing(be_mgr, f);
+  }
+
+  if (opt_rbc_sweeping(OptsHandler_get_instance())) {
+    SatIncSolver_ptr solver =
+      Sat_CreateIncSolver(get_sat_solver(OptsHandler_get_instance()));
+
+    if (solver != SAT_INC_SOLVER(NULL)) {
+      f = Be_apply_sweeping(be_mgr, f, bmc_utils_sat_equivalence,
+                            (void*) solver);
+      SatIncSolver_destroy(solver);
+    }
+  }
+
+  return f;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Proves that two BE formulae are equivalent]
+
+  Description [Returns true if the exclusive or of a and b has been
+               found unsatisfiable by the incremental SAT solver given
+               as data. The clauses of every check are added to a
+               group of their own, destroyed after the check, so that
+               the solver is shared by all the checks of a sweep.]
+
+  SideEffects [A group is created and destroyed in the solver]
+
+  SeeAlso     [bmc_utils_simplify]
+
+******************************************************************************/
+static boolean bmc_utils_sat_equivalence(Be_Manager_ptr be_mgr,
+                                         be_ptr a, be_ptr b, void* data)
+{
+  SatIncSolver_ptr solver = SAT_INC_SOLVER(data);
+  be_ptr diff = Be_Xor(be_mgr, a, b);
+  SatSolverGroup group;
+  Be_Cnf_ptr cnf;
+  SatSolverResult sat_res;
+
+  /* lazy evaluation */
+  if (Be_IsFalse(be_mgr, diff)) return true;
+  if (Be_IsTrue(be_mgr, diff)) return false;
+
+  cnf = Be_ConvertToCnf(be_mgr, diff, 1);
+
+  group = SatIncSolver_create_group(solver);
+  SatSolver_add(SAT_SOLVER(solver), cnf, group);
+  SatSolver_set_polarity(SAT_SOLVER(solver), cnf, 1, group);
+  sat_res = SatSolver_solve_all_groups(SAT_SOLVER(solver));
+  SatIncSolver_destroy_group(solver, group);
+
+  Be_Cnf_Delete(cnf);
+
+  return (sat_res == SAT_SOLVER_UNSATISFIABLE_PROBLEM);
+}
+
@@ -84,6 +84,9 @@
 #define DAG_DEFAULT_DENSITY           20
 #define DAG_DEFAULT_GROWTH           1.5
 
+/* Vertices with at most this many sons keep them inline. */
+#define DAG_INLINE_SONS               3
+
 /* Constants for setting and clearing pointer annotation bit which is 
    lowest (rightmost) bit. 
 */
@@ -148,6 +151,9 @@ typedef struct Dag_DfsFunctions Dag_DfsFunctions_t;  /* Depth First Search. */
                  <li> data, a generic pointer (vertex annotation)
                  <li> outList, a list of sons ((lsList)NULL for leafs)
                  </ul>
+                 When there are at most DAG_INLINE_SONS sons, outList
+                 points to the inline array sons, otherwise to a
+                 separately allocated array.
                  Some fields are for internal purposes:
                  <ul>
                  <li> dag, a reference to the dag manager that owns the node
@@ -174,6 +180,7 @@ struct Dag_Vertex {
 
   Dag_Vertex_t* * outList;
   unsigned        numSons;
+  Dag_Vertex_t  * sons[DAG_INLINE_SONS];
 
   Dag_Manager_t * dag;
   int             mark;
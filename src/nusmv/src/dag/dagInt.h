@@ -57,6 +57,12 @@
 #define DAGMAX_WORDS  ((int) 10)
 #define DAGWORD_SIZE  ((int) (NUSMV_SIZEOF_VOID_P * 4))
 
+/* Vertices are allocated in chunks of this many elements. */
+#define DAG_VERTEX_CHUNK  ((int) 4096)
+
+/* The unique table doubles when filled above this percentage. */
+#define DAG_MAX_LOAD      ((unsigned) 70)
+
 
 /*---------------------------------------------------------------------------*/
 /* Type declarations                                                         */
@@ -71,7 +77,14 @@
   Synopsis      [DAG manager.]
   Description   [Holds the vertices of a dag:
                  <ul> 
-                 <li> vTable, the vertices hash (maintains uniqueness);
+                 <li> vTable, the vertices hash (maintains uniqueness),
+                      an open addressing table with linear probing of
+                      vSize (a power of two) slots, vEntries of which
+                      are in use;
+                 <li> chunks, the vertex pools: vertices are carved out
+                      of contiguous arrays of DAG_VERTEX_CHUNK elements
+                      and collected vertices are chained in freeVertices
+                      for reuse;
                  <li> gcList, the free list (candidates for GC);
                  <li> dfsCode, initially 0 is the code of the current DFS;
 		 <li> stats, for bookkeeping.
@@ -79,7 +92,15 @@
   SeeAlso       []
 ******************************************************************************/
 struct DagManager {
-  st_table     * vTable;
+  Dag_Vertex_t** vTable;
+  unsigned       vSize;
+  unsigned       vEntries;
+
+  Dag_Vertex_t** chunks;
+  int            chunksNo;
+  int            chunksCapacity;
+  Dag_Vertex_t * freeVertices;
+
   int            hashFn[DAGMAX_WORDS];
   lsList         gcList;
   int            dfsCode;
@@ -106,6 +127,14 @@ struct DagManager {
 EXTERN void DagVertexInit(Dag_Manager_t * dagManager, Dag_Vertex_t * v);
 EXTERN int DagVertexComp(const char * v1, const char * v2);
 EXTERN int DagVertexHash(char * v, int modulus);
+EXTERN unsigned DagVertexKey(Dag_Vertex_t * v);
+EXTERN Dag_Vertex_t* DagManagerAllocVertex(Dag_Manager_t * dagManager);
+EXTERN void DagManagerFreeVertex(Dag_Manager_t * dagManager, Dag_Vertex_t * v);
+EXTERN Dag_Vertex_t** DagManagerFindSlot(Dag_Manager_t * dagManager,
+                                         Dag_Vertex_t * v);
+EXTERN void DagManagerAddToSlot(Dag_Manager_t * dagManager,
+                                Dag_Vertex_t ** slot, Dag_Vertex_t * v);
+EXTERN void DagManagerRemove(Dag_Manager_t * dagManager, Dag_Vertex_t * v);
 
 /**AutomaticEnd***************************************************************/
 
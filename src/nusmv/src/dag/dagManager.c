@@ -12,6 +12,14 @@
               <li> <b>Dag_ManagerAllocWithParams()</b> user-driven allocation;
               <li> <b>Dag_ManagerFree()</b> deallocates a DAG Manager;
               <li> <b>Dag_ManagerGC()</b> forces a garbage collection.
+              </ul>
+              Internal procedures included in this module:
+              <ul>
+              <li> <b>DagManagerAllocVertex()</b> takes a vertex from the pool;
+              <li> <b>DagManagerFreeVertex()</b> gives a vertex back to the pool;
+              <li> <b>DagManagerFindSlot()</b> unique table lookup;
+              <li> <b>DagManagerAddToSlot()</b> unique table insertion;
+              <li> <b>DagManagerRemove()</b> unique table deletion.
               </ul>]
 
   SeeAlso     [dagVertex.c dagDfs.c]
@@ -48,6 +56,7 @@
 
 #include "dagInt.h"
 #include "utils/utils.h"
+#include "utils/Stack.h"
 
 /*---------------------------------------------------------------------------*/
 /* Constant declarations                                                     */
@@ -80,7 +89,8 @@
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
-static void GC(Dag_Vertex_t * v, Dag_ProcPtr_t freeData, Dag_ProcPtr_t freeGen);
+static void GC(Dag_Manager_t * dagManager, Dag_Vertex_t * v, Dag_ProcPtr_t freeData, Dag_ProcPtr_t freeGen, Stack_ptr stack);
+static void dag_manager_resize(Dag_Manager_t * dagManager, unsigned vSize);
 
 /**AutomaticEnd***************************************************************/
 
@@ -94,7 +104,8 @@ static void GC(Dag_Vertex_t * v, Dag_ProcPtr_t freeData, Dag_ProcPtr_t freeGen);
 
   Synopsis    [Creates a new DAG manager.]
 
-  Description [Allocates the unique table (vTable) and the free list (gcList).
+  Description [Allocates the unique table (vTable), the vertex pools
+               (chunks) and the free list (gcList).
                Initializes the counters for various statistics (stats).
                Returns the pointer to the dag manager.]
 
@@ -111,13 +122,22 @@ Dag_ManagerAlloc()
   Dag_Manager_t * dagManager = ALLOC(Dag_Manager_t, 1);
   nusmv_assert(dagManager != (Dag_Manager_t*) NULL);
 
-  /* Number of bins is DAG_INIT_VERTICES_NO, number of max entries per bin is
-     20, growth factor is 1.5, no reordering occurs. */
-  dagManager -> vTable = 
-    st_init_table_with_params(DagVertexComp, DagVertexHash,
-                              DAG_DEFAULT_VERTICES_NO, 
-                              DAG_DEFAULT_DENSITY, 
-                              DAG_DEFAULT_GROWTH, 0);
+  /* The number of slots is the first power of two above
+     DAG_DEFAULT_VERTICES_NO, the table grows by doubling. */
+  dagManager -> vSize = 1;
+  while (dagManager -> vSize < DAG_DEFAULT_VERTICES_NO) {
+    dagManager -> vSize <<= 1;
+  }
+  dagManager -> vTable = ALLOC(Dag_Vertex_t*, dagManager -> vSize);
+  nusmv_assert(dagManager -> vTable != (Dag_Vertex_t**) NULL);
+  memset(dagManager -> vTable, 0, dagManager -> vSize * sizeof(Dag_Vertex_t*));
+  dagManager -> vEntries = 0;
+
+  /* Pools are allocated on demand. */
+  dagManager -> chunks = (Dag_Vertex_t**) NULL;
+  dagManager -> chunksNo = 0;
+  dagManager -> chunksCapacity = 0;
+  dagManager -> freeVertices = NIL(Dag_Vertex_t);
 
   /* Calculate universal hash function parameters. */
   utils_random_set_seed();
@@ -165,21 +185,31 @@ Dag_ManagerFree(
 
   lsGen          gen;
   Dag_Vertex_t * v;
+  Stack_ptr      stack;
+  int            i;
 
   if (dagManager == NIL(Dag_Manager_t)) {
     return;
   }
 
   /* Collect everything (including permanent nodes) as garbage. */
+  stack = Stack_create();
   gen = lsStart(dagManager -> gcList);
   while (lsNext(gen, (lsGeneric*) &v, LS_NH) == LS_OK) {
     v = Dag_VertexGetRef(v);
-    GC(v, freeData, freeGen);
+    GC(dagManager, v, freeData, freeGen, stack);
   }
   lsFinish(gen);
+  Stack_destroy(stack);
   
-  /* Free vertices table and vertices list. */
-  st_free_table(dagManager -> vTable);
+  /* Free vertices table, vertex pools and vertices list. */
+  FREE(dagManager -> vTable);
+  for (i = 0; i < dagManager -> chunksNo; i++) {
+    FREE(dagManager -> chunks[i]);
+  }
+  if (dagManager -> chunks != (Dag_Vertex_t**) NULL) {
+    FREE(dagManager -> chunks);
+  }
   lsDestroy(dagManager -> gcList, (void (*)()) NULL);
   
   /* Free the dag itself. */
@@ -217,26 +247,239 @@ Dag_ManagerGC(
   
   Dag_Vertex_t  * v;
   lsGen           gen;
+  Stack_ptr       stack;
   
   if (dagManager == NIL(Dag_Manager_t)) {
     return;
   }
 
   /* Start from fatherless and non-permanent vertices. */
+  stack = Stack_create();
   gen = lsStart(dagManager -> gcList);
   while (lsNext(gen, (lsGeneric*) &v, LS_NH) == LS_OK) {
     v = Dag_VertexGetRef(v);
     if (v -> mark == 0) {
-      GC(v, freeData, freeGen);
+      GC(dagManager, v, freeData, freeGen, stack);
     }
   }
   lsFinish(gen);
+  Stack_destroy(stack);
     
   return;
 
 } /* End of Dag_ManagerGC. */
 
 
+/*---------------------------------------------------------------------------*/
+/* Definition of internal functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Takes a vertex from the pool.]
+
+  Description [Returns a previously collected vertex if there is one,
+               otherwise a fresh vertex from the current chunk. A new
+               chunk of DAG_VERTEX_CHUNK contiguous vertices is allocated
+               when the free vertices are exhausted. The fields of the
+               returned vertex are not initialized.]
+
+  SideEffects [none]
+
+  SeeAlso     [DagManagerFreeVertex]
+
+******************************************************************************/
+Dag_Vertex_t *
+DagManagerAllocVertex(
+  Dag_Manager_t * dagManager)
+{
+  Dag_Vertex_t * v;
+  Dag_Vertex_t * chunk;
+  int            i;
+
+  if (dagManager -> freeVertices == NIL(Dag_Vertex_t)) {
+    if (dagManager -> chunksNo == dagManager -> chunksCapacity) {
+      dagManager -> chunksCapacity = (dagManager -> chunksCapacity == 0) ?
+        16 : 2 * dagManager -> chunksCapacity;
+      dagManager -> chunks = REALLOC(Dag_Vertex_t*, dagManager -> chunks,
+                                     dagManager -> chunksCapacity);
+      nusmv_assert(dagManager -> chunks != (Dag_Vertex_t**) NULL);
+    }
+
+    chunk = ALLOC(Dag_Vertex_t, DAG_VERTEX_CHUNK);
+    nusmv_assert(chunk != NIL(Dag_Vertex_t));
+    dagManager -> chunks[dagManager -> chunksNo++] = chunk;
+
+    /* Chain the new vertices in address order through the data field. */
+    for (i = DAG_VERTEX_CHUNK - 1; i >= 0; i--) {
+      chunk[i].data = (char*) dagManager -> freeVertices;
+      dagManager -> freeVertices = &(chunk[i]);
+    }
+  }
+
+  v = dagManager -> freeVertices;
+  dagManager -> freeVertices = (Dag_Vertex_t*) v -> data;
+
+  return v;
+
+} /* End of DagManagerAllocVertex. */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Gives a vertex back to the pool.]
+
+  Description [Frees the out edges of v, unless they are stored inline,
+               and chains v among the free vertices.]
+
+  SideEffects [none]
+
+  SeeAlso     [DagManagerAllocVertex]
+
+******************************************************************************/
+void
+DagManagerFreeVertex(
+  Dag_Manager_t * dagManager,
+  Dag_Vertex_t  * v)
+{
+  if ((v -> outList != (Dag_Vertex_t**) NULL) && (v -> outList != v -> sons)) {
+    FREE(v -> outList);
+  }
+  v -> outList = (Dag_Vertex_t**) NULL;
+
+  v -> data = (char*) dagManager -> freeVertices;
+  dagManager -> freeVertices = v;
+
+  return;
+
+} /* End of DagManagerFreeVertex. */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Unique table lookup.]
+
+  Description [Probes the unique table linearly, starting from the key
+               of v, and returns the slot holding a vertex equal to v
+               or the first empty slot if there is no such vertex.
+               Only the basic fields of v (symbol, data and sons) need
+               to be filled in.]
+
+  SideEffects [none]
+
+  SeeAlso     [DagManagerAddToSlot DagVertexKey DagVertexComp]
+
+******************************************************************************/
+Dag_Vertex_t **
+DagManagerFindSlot(
+  Dag_Manager_t * dagManager,
+  Dag_Vertex_t  * v)
+{
+  unsigned        mask = dagManager -> vSize - 1;
+  unsigned        i = DagVertexKey(v) & mask;
+  Dag_Vertex_t ** table = dagManager -> vTable;
+
+  while (table[i] != NIL(Dag_Vertex_t)) {
+    if (DagVertexComp((char*) table[i], (char*) v) == 0) {
+      break;
+    }
+    i = (i + 1) & mask;
+  }
+
+  return &(table[i]);
+
+} /* End of DagManagerFindSlot. */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Unique table insertion.]
+
+  Description [Stores v in slot, that must be the empty slot returned by
+               DagManagerFindSlot for v. The table is doubled when its
+               load exceeds DAG_MAX_LOAD percent.]
+
+  SideEffects [Slots previously returned by DagManagerFindSlot become
+               invalid]
+
+  SeeAlso     [DagManagerFindSlot]
+
+******************************************************************************/
+void
+DagManagerAddToSlot(
+  Dag_Manager_t * dagManager,
+  Dag_Vertex_t ** slot,
+  Dag_Vertex_t  * v)
+{
+  nusmv_assert(*slot == NIL(Dag_Vertex_t));
+
+  *slot = v;
+  ++(dagManager -> vEntries);
+
+  if ((unsigned long) dagManager -> vEntries * 100 >
+      (unsigned long) dagManager -> vSize * DAG_MAX_LOAD) {
+    dag_manager_resize(dagManager, 2 * dagManager -> vSize);
+  }
+
+  return;
+
+} /* End of DagManagerAddToSlot. */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Unique table deletion.]
+
+  Description [Removes v (compared by address) from the unique table, if
+               it is there. The following vertices in the same cluster
+               are shifted backwards, so that no tombstones are needed.]
+
+  SideEffects [none]
+
+  SeeAlso     [DagManagerFindSlot]
+
+******************************************************************************/
+void
+DagManagerRemove(
+  Dag_Manager_t * dagManager,
+  Dag_Vertex_t  * v)
+{
+  unsigned        mask = dagManager -> vSize - 1;
+  unsigned        i = DagVertexKey(v) & mask;
+  unsigned        j, k;
+  Dag_Vertex_t ** table = dagManager -> vTable;
+
+  /* Vertices added with Dag_VertexInsert are not in the table. */
+  while (table[i] != v) {
+    if (table[i] == NIL(Dag_Vertex_t)) {
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+
+  /* Fill the hole with the next vertex of the cluster that does not
+     hash in between the hole and its current position. */
+  j = i;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (table[j] == NIL(Dag_Vertex_t)) {
+      break;
+    }
+    k = DagVertexKey(table[j]) & mask;
+    if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) {
+      continue;
+    }
+    table[i] = table[j];
+    i = j;
+  }
+  table[i] = NIL(Dag_Vertex_t);
+  --(dagManager -> vEntries);
+
+  return;
+
+} /* End of DagManagerRemove. */
+
+
 /*---------------------------------------------------------------------------*/
 /* Definition of static functions                                            */
 /*---------------------------------------------------------------------------*/
@@ -244,12 +487,13 @@ Dag_ManagerGC(
   
 /**Function********************************************************************
 
-  Synopsis    [Depth-first garbage collection.]
+  Synopsis    [Garbage collection.]
 
   Description [Gets a vertex to be freed. If the vertex has permanent or 
                non-orphan brothers it is rescued. Otherwise the brother is
                unconnected and the sons marks are updated. GC is then 
-               propagated to each fatherless son.]
+               propagated to each fatherless son, using stack (that is
+               left empty) instead of recursion.]
 
   SideEffects [none]
 
@@ -258,53 +502,99 @@ Dag_ManagerGC(
 ******************************************************************************/
 static void
 GC(
+  Dag_Manager_t * dagManager,
   Dag_Vertex_t  * v,
   Dag_ProcPtr_t   freeData,
-  Dag_ProcPtr_t   freeGen)
+  Dag_ProcPtr_t   freeGen,
+  Stack_ptr       stack)
 {
   unsigned       gen;
   Dag_Vertex_t * vTemp;
 
-  /* While the vertex is still intact remove it from the hash table. */
-  st_delete(v -> dag -> vTable, (char**) &v, (char**) &vTemp);
+  Stack_push(stack, v);
 
-  /* If deallocating functions are provided, use them on data and gRef. */
-  if (freeData != (void (*)()) NULL) {
-    (*freeData)(v -> data);
-  }
-  if (freeGen != (void (*)()) NULL) {
-    (*freeData)(v -> gRef);
-  }
+  while (!Stack_is_empty(stack)) {
+    v = (Dag_Vertex_t*) Stack_pop(stack);
 
-  /* Decrement the mark of the sons and possibly propagate
-     the garbage collection. */
-  if (v -> outList != (Dag_Vertex_t**) NULL) {
+    /* While the vertex is still intact remove it from the hash table. */
+    DagManagerRemove(dagManager, v);
 
-    for (gen=0; gen<v->numSons; gen++) {
-      vTemp = v->outList[gen];
-      vTemp = Dag_VertexGetRef(vTemp);
-      --(vTemp -> mark);
-      if (vTemp -> mark == 0) {
-        GC(vTemp, freeData, freeGen);
+    /* If deallocating functions are provided, use them on data and gRef. */
+    if (freeData != (void (*)()) NULL) {
+      (*freeData)(v -> data);
+    }
+    if (freeGen != (void (*)()) NULL) {
+      (*freeData)(v -> gRef);
+    }
+
+    /* Decrement the mark of the sons and possibly propagate
+       the garbage collection. */
+    if (v -> outList != (Dag_Vertex_t**) NULL) {
+      for (gen=0; gen<v->numSons; gen++) {
+        vTemp = v->outList[gen];
+        vTemp = Dag_VertexGetRef(vTemp);
+        --(vTemp -> mark);
+        if (vTemp -> mark == 0) {
+          Stack_push(stack, vTemp);
+        }
       }
     }
 
-    /* Deallocate out edges. */
-    FREE(v->outList);
-  }
+    /* If the vertex has an handle to the garbage bin, remove the vertex
+       from the bin. */
+    if (v ->vHandle != (lsHandle) NULL) {
+      lsRemoveItem(v -> vHandle, (lsGeneric*) &v);
+    }
 
-  /* If the vertex has an handle to the garbage bin, remove the vertex
-     from the bin. */
-  if (v ->vHandle != (lsHandle) NULL) {
-    lsRemoveItem(v -> vHandle, (lsGeneric*) &v);
+    /* Update GC statistics and give the vertex back to the pool. */
+    ++(dagManager -> stats[DAG_GC_NO]);
+    DagManagerFreeVertex(dagManager, v);
   }
 
-  /* Update GC statistics and free the vertex. */
-  ++(v -> dag -> stats[DAG_GC_NO]);
-  FREE(v);
-
   return;
 
 } /* End of GC. */
 
 
+/**Function********************************************************************
+
+  Synopsis    [Resizes the unique table.]
+
+  Description [Rehashes every vertex into a table of vSize slots, vSize
+               must be a power of two.]
+
+  SideEffects [none]
+
+  SeeAlso     [DagManagerAddToSlot]
+
+******************************************************************************/
+static void
+dag_manager_resize(
+  Dag_Manager_t * dagManager,
+  unsigned        vSize)
+{
+  Dag_Vertex_t ** oldTable = dagManager -> vTable;
+  unsigned        oldSize = dagManager -> vSize;
+  unsigned        mask = vSize - 1;
+  unsigned        i, j;
+
+  dagManager -> vTable = ALLOC(Dag_Vertex_t*, vSize);
+  nusmv_assert(dagManager -> vTable != (Dag_Vertex_t**) NULL);
+  memset(dagManager -> vTable, 0, vSize * sizeof(Dag_Vertex_t*));
+  dagManager -> vSize = vSize;
+
+  for (i = 0; i < oldSize; i++) {
+    if (oldTable[i] != NIL(Dag_Vertex_t)) {
+      j = DagVertexKey(oldTable[i]) & mask;
+      while (dagManager -> vTable[j] != NIL(Dag_Vertex_t)) {
+        j = (j + 1) & mask;
+      }
+      dagManager -> vTable[j] = oldTable[i];
+    }
+  }
+
+  FREE(oldTable);
+
+  return;
+
+} /* End of dag_manager_resize. */
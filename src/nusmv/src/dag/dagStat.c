@@ -117,26 +117,23 @@ Dag_PrintStats(
 
   int               min, max, runSz, totClust;
   int               i, j = 0;
-  st_table_entry *  b;
 
   int               shared = 0;
   float             total = 0.0;
   float             variance = 0.0;
   float             mean = 0.0;
-  int               numBins = dagManager -> vTable -> num_bins;
-  st_table_entry ** theHash = dagManager -> vTable -> bins;
+  int               numBins = (int) dagManager -> vSize;
+  Dag_Vertex_t   ** theHash = dagManager -> vTable;
 
   /* First pass: calculating the total, shared vertices and (eventually) 
      printing the bin's data. */
   runSz = clustSz;
   totClust = 0;
   for (i = 0; i < numBins; i++) {
-    /* Scan each bin entries. */
-    for (j = 0, b = theHash[i]; b != NIL(st_table_entry); b = b -> next, j++) {
-      /* For each entry, check if the vertex is shared. */
-      if (((Dag_Vertex_t*)(b -> key)) -> mark > 1) {
-	shared += 1;
-      }
+    /* Each bin holds at most one vertex: check if it is shared. */
+    j = (theHash[i] != NIL(Dag_Vertex_t)) ? 1 : 0;
+    if ((j > 0) && (theHash[i] -> mark > 1)) {
+      shared += 1;
     }
     total += (float)j;
     totClust += j;
@@ -158,7 +155,7 @@ Dag_PrintStats(
 
   /* Second pass: variance, min and max. */
   for (i = 0; i < numBins; i++) {
-    for (j = 0, b = theHash[i]; b != NIL(st_table_entry); b = b -> next, j++);
+    j = (theHash[i] != NIL(Dag_Vertex_t)) ? 1 : 0;
     variance += pow(((float)j - mean), 2.0);
     if (j > max) {
       max = j;
@@ -18,6 +18,7 @@
                 <li> <b>DagVertexInit()</b> Initialize a vertex;
                 <li> <b>DagVertexComp()</b> Compare two vertices;
                 <li> <b>DagVertexHash()</b> calculate vertex hash code;
+                <li> <b>DagVertexKey()</b> calculate vertex unique table key;
                 </ul>]
 
   SeeAlso     [dagManager dagDfs]
@@ -66,6 +67,10 @@
 # define HASH_INTLOWER   ((((nusmv_ptrint) 1) << (NUSMV_SIZEOF_INT * 8 / 2)) - 1)
 # define HASH_INTUPPER   ((nusmv_ptrint) (~ HASH_INTLOWER))
 
+/* Mixes the word w into the hash value h. */
+# define HASH_COMBINE(h, w) \
+  ((h) ^ ((unsigned long) (w) + 0x9e3779b9UL + ((h) << 6) + ((h) >> 2)))
+
 
 /*---------------------------------------------------------------------------*/
 /* Stucture declarations                                                     */
@@ -93,6 +98,7 @@
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
+static void dag_vertex_set_sons(Dag_Vertex_t * v, Dag_Vertex_t ** vSons, unsigned numSons);
 
 /**AutomaticEnd***************************************************************/
 
@@ -130,9 +136,9 @@ Dag_VertexLookup(
   unsigned        numSons)
 {
 
-  char        ** slot;
-  int            found;
-  Dag_Vertex_t * v;
+  Dag_Vertex_t    key;
+  Dag_Vertex_t ** slot;
+  Dag_Vertex_t  * v;
 
   /* A vertex cannot be added to an uninitialized dag and vSymb
      cannot be a negative number. */
@@ -140,35 +146,35 @@ Dag_VertexLookup(
     return NIL(Dag_Vertex_t);
   }
 
-  /* Temporary allocate the vertex, and fill in just the basic
-     information to calculate the hash code. */
-  v = ALLOC(Dag_Vertex_t, 1);
-  nusmv_assert(v != (Dag_Vertex_t*) NULL);
-  v -> symbol = vSymb;
-  v -> data = vData;
-  v -> outList = vSons;
-  v -> numSons = numSons;
-  v -> dag = dagManager;
+  /* Fill in just the basic information to calculate the hash code
+     in a key living on the stack. */
+  key.symbol = vSymb;
+  key.data = vData;
+  key.outList = vSons;
+  key.numSons = numSons;
+  key.dag = dagManager;
 
-  /* Lookup the vertex in the hash table. */
-  found = st_find_or_add(dagManager -> vTable, (char *) v, &slot);
-  nusmv_assert(found == 0 || found == 1); /* no out of memory */
+  /* Lookup the vertex in the unique table. */
+  slot = DagManagerFindSlot(dagManager, &key);
 
-  if (found) {
-    /* The key already existed: free temporary allocations and
-       let v be the vertex found in the table. */
+  if (*slot != NIL(Dag_Vertex_t)) {
+    /* The key already existed: free the sons and return the vertex
+       found in the table. */
     if (vSons != (Dag_Vertex_t**) NULL) {
       FREE(vSons);
     }
-    FREE(v);
-    v = (Dag_Vertex_t*) *slot;
-  } else {
-    /* The key was not there: store the vertex (the value coincides
-       with the key), and make the vertex information complete. */
-    *slot = (char *) v;
-    DagVertexInit(dagManager, v);
+    return *slot;
   }
 
+  /* The key was not there: allocate the vertex from the pool, store
+     it in the free slot and make the vertex information complete. */
+  v = DagManagerAllocVertex(dagManager);
+  v -> symbol = vSymb;
+  v -> data = vData;
+  dag_vertex_set_sons(v, vSons, numSons);
+  DagVertexInit(dagManager, v);
+  DagManagerAddToSlot(dagManager, slot, v);
+
   return v;
 
 } /* End of Dag_VertexLookup. */
@@ -214,11 +220,10 @@ Dag_VertexInsert(
   }
 
   /* Allocate the vertex, and fill in the information. */
-  v = ALLOC(Dag_Vertex_t, 1);
+  v = DagManagerAllocVertex(dagManager);
   v -> symbol = vSymb;
   v -> data = vData;
-  v -> outList = vSons;
-  v -> numSons = numSons;
+  dag_vertex_set_sons(v, vSons, numSons);
 
   /* Initialize the vertex and return it. */
   DagVertexInit(dagManager, v);
@@ -450,3 +455,83 @@ int DagVertexHash(char* v, int modulus)
 
 } /* End of DagVertexHash. */
 
+
+/**Function********************************************************************
+
+  Synopsis    [Calculate the unique table key of a vertex.]
+
+  Description [Mixes the symbol, the data reference and the sons of v
+               into an unsigned value whose low order bits are well
+               spread, so that it can be reduced to an index of the
+               unique table by masking.]
+
+  SideEffects [None]
+
+  SeeAlso     [DagVertexHash]
+
+******************************************************************************/
+unsigned DagVertexKey(Dag_Vertex_t * v)
+{
+  unsigned      gen;
+  unsigned long h;
+
+  h = HASH_COMBINE(0UL, v -> symbol);
+  h = HASH_COMBINE(h, (nusmv_ptrint) v -> data);
+
+  if (v -> outList != (Dag_Vertex_t**) NULL) {
+    for (gen = 0; gen < v -> numSons; gen++) {
+      h = HASH_COMBINE(h, (nusmv_ptrint) v -> outList[gen]);
+    }
+  }
+
+  /* Final avalanche, vertices are close in memory. */
+  h ^= h >> 16;
+  h *= 0x45d9f3bUL;
+  h ^= h >> 16;
+
+  return (unsigned) h;
+
+} /* End of DagVertexKey. */
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Attaches the sons to a vertex.]
+
+  Description [The ownership of vSons is transferred to the vertex. If
+               there are at most DAG_INLINE_SONS sons they are copied
+               into the vertex itself and vSons is freed.]
+
+  SideEffects [vSons may be freed]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void
+dag_vertex_set_sons(
+  Dag_Vertex_t  * v,
+  Dag_Vertex_t ** vSons,
+  unsigned        numSons)
+{
+  unsigned gen;
+
+  v -> numSons = numSons;
+
+  if ((vSons != (Dag_Vertex_t**) NULL) && (numSons <= DAG_INLINE_SONS)) {
+    for (gen = 0; gen < numSons; gen++) {
+      v -> sons[gen] = vSons[gen];
+    }
+    FREE(vSons);
+    v -> outList = v -> sons;
+  }
+  else {
+    v -> outList = vSons;
+  }
+
+  return;
+
+} /* End of dag_vertex_set_sons. */
@@ -56,6 +56,8 @@
 #include "enc/operators.h"
 #include "parser/symbols.h" /* for FAILURE value */
 
+#include <time.h>
+
 static char rcsid[] UTIL_UNUSED = "$Id: dd.c,v 1.7.6.12.2.1.2.6.4.20 2010-02-08 12:25:27 nusmv Exp $";
 
 /*---------------------------------------------------------------------------*/
@@ -67,6 +69,18 @@ node_ptr true_const = Nil;
 node_ptr false_const = Nil;
 node_ptr boolean_range = Nil;
 
+/* The events recorded by the trace hooks, see dd_trace_start */
+typedef struct DdTraceEvent_TAG {
+  int kind;
+  double time;
+  long nodes;
+} DdTraceEvent;
+
+static DdTraceEvent* dd_trace_events = (DdTraceEvent*) NULL;
+static int dd_trace_capacity = 0;
+static int dd_trace_count = 0;
+static int dd_trace_dropped = 0;
+
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -89,6 +103,15 @@ node_ptr boolean_range = Nil;
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 static void InvalidType(FILE *file, char *field, char *expected);
+static bdd_ptr dd_balanced_apply(DdManager * dd, bdd_ptr * fns, int n,
+                                 boolean conj);
+static void dd_trace_record(DdManager * dd, int kind);
+static int dd_trace_gc_begin(DdManager * dd, const char * str, void * data);
+static int dd_trace_gc_end(DdManager * dd, const char * str, void * data);
+static int dd_trace_reorder_begin(DdManager * dd, const char * str,
+                                  void * data);
+static int dd_trace_reorder_end(DdManager * dd, const char * str,
+                                void * data);
 
 /*---------------------------------------------------------------------------*/
 /* Definition of exported functions                                          */
@@ -230,7 +253,8 @@ void walk_dd(DdManager * dd, VPFDD f, node_ptr l)
 
   Synopsis    [Prints out statistic and setting of the DD manager.]
 
-  Description [Prints out statistics and settings for a CUDD manager.]
+  Description [Prints out statistics and settings for a CUDD manager,
+  followed by the computed table statistics of each operator.]
 
   SideEffects []
 
@@ -238,6 +262,8 @@ void walk_dd(DdManager * dd, VPFDD f, node_ptr l)
 void dd_print_stats(DdManager *mgr, FILE *file)
 {
   Cudd_PrintInfo(mgr, file);
+  fprintf(file, "\n");
+  Cudd_PrintCacheOpStats(mgr, file);
 
   /* Print some guidance to the parameters */
   fprintf(file, "\nMore detailed information about the semantics ");
@@ -248,6 +274,416 @@ void dd_print_stats(DdManager *mgr, FILE *file)
   return;
 } /* end of dd_print_stats */
 
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of operators with computed table
+  statistics.]
+
+  Description [Operators are numbered from 0 to the returned value
+  minus one, see dd_get_cache_op_name and the related functions.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_name]
+
+******************************************************************************/
+int dd_get_cache_op_count(DdManager *dd)
+{
+  return Cudd_ReadCacheOpCount(dd);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the name of the i-th operator of the computed table
+  statistics.]
+
+  Description [Operators that CUDD cannot name are identified by their
+  key in the computed table. The returned string must not be freed, and
+  may be overwritten by the next call.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_count]
+
+******************************************************************************/
+const char* dd_get_cache_op_name(DdManager *dd, int i)
+{
+  static char buf[32];
+  const char* name;
+  ptruint op;
+  int chars;
+
+  nusmv_assert(i >= 0 && i < dd_get_cache_op_count(dd));
+  Cudd_ReadCacheOpStats(dd, i, &name, &op, NULL, NULL, NULL, NULL);
+  if (name != (const char*) NULL) return name;
+
+  chars = snprintf(buf, sizeof(buf), "op@0x%lx", (unsigned long) op);
+  SNPRINTF_CHECK(chars, sizeof(buf));
+  return buf;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of computed table lookups done by the
+  i-th operator.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_count]
+
+******************************************************************************/
+double dd_get_cache_op_lookups(DdManager *dd, int i)
+{
+  double res;
+
+  nusmv_assert(i >= 0 && i < dd_get_cache_op_count(dd));
+  Cudd_ReadCacheOpStats(dd, i, NULL, NULL, &res, NULL, NULL, NULL);
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of computed table hits of the i-th
+  operator.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_count]
+
+******************************************************************************/
+double dd_get_cache_op_hits(DdManager *dd, int i)
+{
+  double res;
+
+  nusmv_assert(i >= 0 && i < dd_get_cache_op_count(dd));
+  Cudd_ReadCacheOpStats(dd, i, NULL, NULL, NULL, &res, NULL, NULL);
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of results the i-th operator stored in
+  the computed table.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_count]
+
+******************************************************************************/
+double dd_get_cache_op_inserts(DdManager *dd, int i)
+{
+  double res;
+
+  nusmv_assert(i >= 0 && i < dd_get_cache_op_count(dd));
+  Cudd_ReadCacheOpStats(dd, i, NULL, NULL, NULL, NULL, &res, NULL);
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of results of the i-th operator evicted
+  from the computed table by later insertions.]
+
+  SideEffects []
+
+  SeeAlso     [dd_get_cache_op_count]
+
+******************************************************************************/
+double dd_get_cache_op_evictions(DdManager *dd, int i)
+{
+  double res;
+
+  nusmv_assert(i >= 0 && i < dd_get_cache_op_count(dd));
+  Cudd_ReadCacheOpStats(dd, i, NULL, NULL, NULL, NULL, NULL, &res);
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of bytes of memory used by the manager.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_memory_budget]
+
+******************************************************************************/
+long dd_get_memory_in_use(DdManager *dd)
+{
+  return (long) Cudd_ReadMemoryInUse(dd);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Sets the memory budget of the manager.]
+
+  Description [Sets a soft limit of bytes on the memory used by the
+  manager, 0 meaning no limit. When the manager gets close to it,
+  garbage is collected, the computed table is shrunk and unused pages
+  of nodes are given back to the system; if this is not enough, the
+  functions registered with dd_add_memory_budget_hook are called.
+  Operations never fail because of the budget.]
+
+  SideEffects []
+
+  SeeAlso     [dd_release_memory Cudd_SetMemoryBudget]
+
+******************************************************************************/
+void dd_set_memory_budget(DdManager *dd, long bytes)
+{
+  nusmv_assert(bytes >= 0);
+  Cudd_SetMemoryBudget(dd, (ptruint) bytes);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the memory budget of the manager, 0 if none.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_memory_budget]
+
+******************************************************************************/
+long dd_get_memory_budget(DdManager *dd)
+{
+  return (long) Cudd_ReadMemoryBudget(dd);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of times memory was reclaimed because
+  the manager was close to its budget.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_memory_budget]
+
+******************************************************************************/
+int dd_get_memory_budget_events(DdManager *dd)
+{
+  return Cudd_ReadMemoryBudgetEvents(dd);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Registers a function called when the memory budget is
+  about to be exceeded.]
+
+  Description [f is called when collecting garbage was not enough to
+  stay within the budget. It may free the BDDs it caches, but must not
+  build new ones. Returns 1 if f was added, 2 if it was already
+  registered and 0 on failure.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_memory_budget dd_remove_memory_budget_hook]
+
+******************************************************************************/
+int dd_add_memory_budget_hook(DdManager *dd, DD_HFP f)
+{
+  return Cudd_AddHook(dd, f, CUDD_MEM_BUDGET_HOOK);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Unregisters a function registered with
+  dd_add_memory_budget_hook.]
+
+  Description [Returns 1 if f was removed, 0 if it was not registered.]
+
+  SideEffects []
+
+  SeeAlso     [dd_add_memory_budget_hook]
+
+******************************************************************************/
+int dd_remove_memory_budget_hook(DdManager *dd, DD_HFP f)
+{
+  return Cudd_RemoveHook(dd, f, CUDD_MEM_BUDGET_HOOK);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Gives the memory the manager does not need back to the
+  system.]
+
+  Description [Collects garbage, shrinks the computed table to its
+  initial size and frees the pages of nodes holding no live node.
+  Returns the number of bytes released. Useful after freeing large
+  BDDs, e.g. between two verification tasks.]
+
+  SideEffects [Clears the computed table.]
+
+  SeeAlso     [dd_set_memory_budget Cudd_ReleaseMemory]
+
+******************************************************************************/
+long dd_release_memory(DdManager *dd)
+{
+  return (long) Cudd_ReleaseMemory(dd);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Starts recording the garbage collections and reorderings
+  of dd.]
+
+  Description [Each garbage collection and each reordering of dd records
+  a begin and an end event, with the processor time in microseconds (as
+  given by clock) and the number of live nodes of dd. At most capacity
+  events are kept; the next ones are counted as dropped. Previously
+  recorded events are discarded. Returns 1 if successful, 0 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_stop dd_trace_get_event_count]
+
+******************************************************************************/
+int dd_trace_start(DdManager *dd, int capacity)
+{
+  nusmv_assert(capacity > 0);
+
+  if (capacity != dd_trace_capacity) {
+    if (dd_trace_events != (DdTraceEvent*) NULL) FREE(dd_trace_events);
+    dd_trace_events = ALLOC(DdTraceEvent, capacity);
+    if (dd_trace_events == (DdTraceEvent*) NULL) {
+      dd_trace_capacity = 0;
+      return 0;
+    }
+    dd_trace_capacity = capacity;
+  }
+  dd_trace_count = 0;
+  dd_trace_dropped = 0;
+
+  if (Cudd_AddHook(dd, dd_trace_gc_begin, CUDD_PRE_GC_HOOK) == 0 ||
+      Cudd_AddHook(dd, dd_trace_gc_end, CUDD_POST_GC_HOOK) == 0 ||
+      Cudd_AddHook(dd, dd_trace_reorder_begin,
+                   CUDD_PRE_REORDERING_HOOK) == 0 ||
+      Cudd_AddHook(dd, dd_trace_reorder_end,
+                   CUDD_POST_REORDERING_HOOK) == 0) {
+    dd_trace_stop(dd);
+    return 0;
+  }
+  return 1;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Stops recording the garbage collections and reorderings
+  of dd.]
+
+  Description [The recorded events are kept until the next call to
+  dd_trace_start or dd_trace_clear.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_start]
+
+******************************************************************************/
+void dd_trace_stop(DdManager *dd)
+{
+  Cudd_RemoveHook(dd, dd_trace_gc_begin, CUDD_PRE_GC_HOOK);
+  Cudd_RemoveHook(dd, dd_trace_gc_end, CUDD_POST_GC_HOOK);
+  Cudd_RemoveHook(dd, dd_trace_reorder_begin, CUDD_PRE_REORDERING_HOOK);
+  Cudd_RemoveHook(dd, dd_trace_reorder_end, CUDD_POST_REORDERING_HOOK);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Frees the recorded events.]
+
+  Description [Must be called once no manager is traced anymore.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_stop]
+
+******************************************************************************/
+void dd_trace_clear()
+{
+  if (dd_trace_events != (DdTraceEvent*) NULL) FREE(dd_trace_events);
+  dd_trace_events = (DdTraceEvent*) NULL;
+  dd_trace_capacity = 0;
+  dd_trace_count = 0;
+  dd_trace_dropped = 0;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of recorded events.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_start dd_trace_get_dropped_count]
+
+******************************************************************************/
+int dd_trace_get_event_count()
+{
+  return dd_trace_count;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of events that were not recorded
+  because the capacity was reached.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_start]
+
+******************************************************************************/
+int dd_trace_get_dropped_count()
+{
+  return dd_trace_dropped;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the kind of the i-th recorded event.]
+
+  Description [The kind is one of DD_TRACE_GC_BEGIN, DD_TRACE_GC_END,
+  DD_TRACE_REORDER_BEGIN and DD_TRACE_REORDER_END.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_get_event_count]
+
+******************************************************************************/
+int dd_trace_get_event_kind(int i)
+{
+  nusmv_assert(i >= 0 && i < dd_trace_count);
+  return dd_trace_events[i].kind;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the processor time of the i-th recorded event, in
+  microseconds.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_get_event_count]
+
+******************************************************************************/
+double dd_trace_get_event_time(int i)
+{
+  nusmv_assert(i >= 0 && i < dd_trace_count);
+  return dd_trace_events[i].time;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of live nodes of the manager when the
+  i-th event was recorded.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_get_event_count]
+
+******************************************************************************/
+long dd_trace_get_event_nodes(int i)
+{
+  nusmv_assert(i >= 0 && i < dd_trace_count);
+  return dd_trace_events[i].nodes;
+}
+
 /**Function********************************************************************
 
   Synopsis    [Builds a group of variables that should stay adjacent
@@ -499,6 +935,115 @@ int dd_reorder(DdManager *dd, int method, int minsize)
   return(result);
 } /* end of dd_reorder */
 
+/**Function********************************************************************
+
+  Synopsis    [Sets the time budget of a single reordering.]
+
+  Description [Sets the number of milliseconds a single reordering is
+  allowed to run, 0 meaning no limit. When the budget expires, sifting
+  stops and keeps the best order found so far.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_reorder_total_limit Cudd_SetReorderingTimeLimit]
+
+******************************************************************************/
+void dd_set_reorder_time_limit(DdManager *dd, long msecs)
+{
+  nusmv_assert(msecs >= 0);
+  Cudd_SetReorderingTimeLimit(dd, msecs);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Sets the total time budget of automatic reordering.]
+
+  Description [Sets the number of milliseconds of reordering after which
+  automatic dynamic reordering is no longer triggered, 0 meaning no
+  limit. Explicit calls to dd_reorder are not affected.]
+
+  SideEffects []
+
+  SeeAlso     [dd_set_reorder_time_limit Cudd_SetReorderingTotalLimit]
+
+******************************************************************************/
+void dd_set_reorder_total_limit(DdManager *dd, long msecs)
+{
+  nusmv_assert(msecs >= 0);
+  Cudd_SetReorderingTotalLimit(dd, msecs);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Suspends automatic dynamic reordering.]
+
+  Description [Disables automatic dynamic reordering, keeping the
+  selected method. Returns true if it was enabled; the returned value
+  must be passed to dd_autodyn_resume. While reordering is suspended,
+  dd_reorder_if_due can be used to reorder at points chosen by the
+  caller, e.g. between the iterations of a fixpoint.]
+
+  SideEffects []
+
+  SeeAlso     [dd_autodyn_resume dd_reorder_if_due]
+
+******************************************************************************/
+boolean dd_autodyn_suspend(DdManager *dd)
+{
+  dd_reorderingtype method;
+  boolean enabled;
+
+  enabled = (dd_reordering_status(dd, &method) != 0);
+  if (enabled) Cudd_AutodynDisable(dd);
+  return enabled;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Resumes automatic dynamic reordering.]
+
+  Description [Re-enables automatic dynamic reordering with the
+  previously selected method if enabled is true, that is if it was
+  enabled when dd_autodyn_suspend was called.]
+
+  SideEffects []
+
+  SeeAlso     [dd_autodyn_suspend]
+
+******************************************************************************/
+void dd_autodyn_resume(DdManager *dd, boolean enabled)
+{
+  if (enabled) Cudd_AutodynEnable(dd, CUDD_REORDER_SAME);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Reorders if automatic reordering would have been triggered.]
+
+  Description [Reorders with the selected automatic method if the number
+  of live nodes reached the threshold for the next automatic
+  reordering, and the total budget of automatic reordering is not
+  exhausted. Meant to be called at safe points while automatic
+  reordering is suspended. Returns true if reordering took place.]
+
+  SideEffects [May change the variable order and clear the cache.]
+
+  SeeAlso     [dd_autodyn_suspend dd_set_reorder_total_limit]
+
+******************************************************************************/
+boolean dd_reorder_if_due(DdManager *dd)
+{
+  long total = Cudd_ReadReorderingTotalLimit(dd);
+
+  if (Cudd_ReadKeys(dd) - Cudd_ReadDead(dd) < Cudd_ReadNextReordering(dd)) {
+    return false;
+  }
+  if (total > 0 && Cudd_ReadReorderingTime(dd) >= total) return false;
+
+  dd_reorder(dd, CUDD_REORDER_SAME, DEFAULT_MINSIZE);
+  return true;
+}
+
 
 /**Function********************************************************************
 
@@ -1053,6 +1598,155 @@ int dd_dump_davinci(
 			  (char**) inames, (char**) onames, fp));
 }
 
+/**Function********************************************************************
+
+  Synopsis           [Writes a binary snapshot of the given BDDs.]
+
+  Description        [Writes the n BDDs in f to the file filename, in
+  a binary format that can be reloaded without parsing. inames, if
+  not NULL, gives the name of each variable index, and onames, if not
+  NULL, the name of each BDD. Returns 1 in case of success, 0
+  otherwise. For a better description see the \"Cudd_SnapshotSave\"
+  documentation in the CUDD package.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_open dd_snapshot_load]
+******************************************************************************/
+int dd_snapshot_save(
+  DdManager * dd /* manager */,
+  const char * filename /* the file to be written */,
+  int  n /* number of BDDs to be saved */,
+  bdd_ptr * f /* array of BDDs to be saved */,
+  const char ** inames /* array of input names (or NULL) */,
+  const char ** onames /* array of output names (or NULL) */)
+{
+  return(Cudd_SnapshotSave(dd, filename, n, (DdNode **)f,
+			   (char**) inames, (char**) onames));
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Opens a snapshot written by dd_snapshot_save.]
+
+  Description        [Maps the snapshot in memory and checks it. Returns
+  NULL if the file cannot be read or is not a valid snapshot. The
+  snapshot must be released with dd_snapshot_close.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_save dd_snapshot_load dd_snapshot_close]
+******************************************************************************/
+dd_snapshot * dd_snapshot_open(const char * filename)
+{
+  return Cudd_SnapshotOpen(filename);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Releases a snapshot.]
+
+  Description        [The BDDs already loaded from the snapshot are not
+  affected.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_open]
+******************************************************************************/
+void dd_snapshot_close(dd_snapshot * snap)
+{
+  Cudd_SnapshotClose(snap);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Returns the number of variables of a snapshot.]
+
+  Description        [Returns the size of the manager the snapshot was
+  saved from.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_get_var_name]
+******************************************************************************/
+int dd_snapshot_get_var_count(dd_snapshot * snap)
+{
+  return Cudd_SnapshotReadVarCount(snap);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Returns the name of a saved variable.]
+
+  Description        [Returns the name of the variable of index i when
+  the snapshot was saved, or NULL if it was given no name. The string
+  belongs to the snapshot.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_get_var_count]
+******************************************************************************/
+const char * dd_snapshot_get_var_name(dd_snapshot * snap, int i)
+{
+  return Cudd_SnapshotReadVarName(snap, i);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Returns the number of BDDs of a snapshot.]
+
+  Description        []
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_get_root_name]
+******************************************************************************/
+int dd_snapshot_get_root_count(dd_snapshot * snap)
+{
+  return Cudd_SnapshotReadRootCount(snap);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Returns the name of a saved BDD.]
+
+  Description        [Returns the name of the i-th BDD of the snapshot,
+  or NULL if it was given no name. The string belongs to the
+  snapshot.]
+
+  SideEffects        []
+
+  SeeAlso            [dd_snapshot_get_root_count]
+******************************************************************************/
+const char * dd_snapshot_get_root_name(dd_snapshot * snap, int i)
+{
+  return Cudd_SnapshotReadRootName(snap, i);
+}
+
+/**Function********************************************************************
+
+  Synopsis           [Rebuilds the BDDs of a snapshot.]
+
+  Description        [Rebuilds the BDDs of snap in dd, the saved
+  variable of index i becoming the variable of index varmap[i] (the
+  identity if varmap is NULL). If restore_order is true, the mapped
+  variables are first permuted to follow the saved order, which allows
+  the nodes to be inserted directly into the unique table. Returns an
+  array of dd_snapshot_get_root_count(snap) referenced BDDs, to be
+  freed by the caller with FREE, or NULL in case of failure.]
+
+  SideEffects        [May change the variable order if restore_order is
+  true.]
+
+  SeeAlso            [dd_snapshot_open dd_snapshot_save]
+******************************************************************************/
+bdd_ptr * dd_snapshot_load(DdManager * dd, dd_snapshot * snap, int * varmap,
+                           boolean restore_order)
+{
+  return (bdd_ptr *) Cudd_SnapshotLoad(dd, snap, varmap,
+                                       restore_order ? 1 : 0);
+}
+
 /**Function********************************************************************
 
   Synopsis           [Reads the constant TRUE ADD of the manager.]
@@ -2465,6 +3159,47 @@ void bdd_or_accumulate(DdManager * dd, bdd_ptr * a, bdd_ptr b)
   return;
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Computes the conjunction of an array of BDDs.]
+
+  Description [Computes the conjunction of the n BDDs in fns, combining
+  them pairwise along a balanced tree instead of accumulating them one
+  after the other. This keeps the operands of every AND of similar size,
+  which usually makes the intermediate results smaller than the ones of
+  a linear accumulation. The computation stops as soon as an
+  intermediate result is false. The BDDs in fns are left untouched, the
+  result (true if n is 0) is referenced.]
+
+  SideEffects []
+
+  SeeAlso     [bdd_and bdd_and_accumulate bdd_or_array]
+
+******************************************************************************/
+bdd_ptr bdd_and_array(DdManager * dd, bdd_ptr * fns, int n)
+{
+  return dd_balanced_apply(dd, fns, n, true);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Computes the disjunction of an array of BDDs.]
+
+  Description [Dual of bdd_and_array: the n BDDs in fns are disjoined
+  along a balanced tree, stopping as soon as an intermediate result is
+  true. The BDDs in fns are left untouched, the result (false if n is 0)
+  is referenced.]
+
+  SideEffects []
+
+  SeeAlso     [bdd_or bdd_or_accumulate bdd_and_array]
+
+******************************************************************************/
+bdd_ptr bdd_or_array(DdManager * dd, bdd_ptr * fns, int n)
+{
+  return dd_balanced_apply(dd, fns, n, false);
+}
+
 /**Function********************************************************************
 
   Synopsis [Existentially abstracts all the variables in cube from fn.]
@@ -2673,6 +3408,35 @@ bdd_ptr bdd_between(DdManager *dd, bdd_ptr f_min, bdd_ptr f_max)
   }
 } /* end of bdd_between */
 
+/**Function********************************************************************
+
+  Synopsis    [Extracts a dense subset of f no larger than threshold.]
+
+  Description [Extracts a subset of f whose BDD has at most threshold
+  nodes, using the heavy branch heuristic: starting from the root, the
+  child contributing fewer minterms is dropped until the result is
+  small enough. If f is already small enough, a copy of f is returned.
+  The result is always contained in f and is referenced; a failure is
+  generated if CUDD runs out of memory.]
+
+  SideEffects []
+
+  SeeAlso     [bdd_between]
+
+******************************************************************************/
+bdd_ptr bdd_subset_heavy_branch(DdManager * dd, bdd_ptr f, int threshold)
+{
+  DdNode * result;
+
+  /* numVars 0 lets CUDD pick a value that cannot overflow, since
+     Cudd_SupportSize is not available in this build */
+  result = Cudd_SubsetHeavyBranch(dd, (DdNode *)f, 0, threshold);
+  common_error(result, "bdd_subset_heavy_branch: result = NULL");
+  Cudd_Ref(result);
+  return((bdd_ptr)result);
+} /* end of bdd_subset_heavy_branch */
+
+
 /**Function********************************************************************
 
   Synopsis           [Determines whether f is less than or equal to g.]
@@ -3024,6 +3788,87 @@ int bdd_pick_all_terms(
   return 0;
 }
 
+/**Function********************************************************************
+
+  Synopsis           [Writes the minterms of a BDD as rows of bits]
+
+  Description        [Enumerates the cubes of fn once and expands their
+  free variables among vars. The i-th minterm is written to
+  rows[i * vars_dim] to rows[(i + 1) * vars_dim - 1], where the j-th
+  value is the value, 0 or 1, of vars[j]. fn must depend on variables of
+  vars only. Unlike bdd_pick_all_terms, no BDD is built for the minterms.
+
+  Returns the number of minterms written, or -1 if fn has more than
+  rows_dim minterms.]
+
+  SideEffects        [rows is filled]
+
+  SeeAlso            [bdd_pick_all_terms]
+
+******************************************************************************/
+int bdd_get_minterms(
+  DdManager * dd     /* dd manager */,
+  bdd_ptr   fn       /* the BDD whose minterms are written */,
+  bdd_ptr   * vars   /* The variables of the minterms */,
+  int       vars_dim /* The size of the above array */,
+  char      * rows   /* The rows of the minterms */,
+  int       rows_dim /* The number of rows that can be written */)
+{
+  DdGen* gen;
+  int* cube;
+  CUDD_VALUE_TYPE value;
+  int* indices;
+  int* free_vars;
+  int n = 0;
+  int i;
+
+  indices = ALLOC(int, vars_dim + 1);
+  free_vars = ALLOC(int, vars_dim + 1);
+  nusmv_assert((int*) NULL != indices && (int*) NULL != free_vars);
+
+  for (i = 0; i < vars_dim; ++i) {
+    indices[i] = Cudd_NodeReadIndex((DdNode*) vars[i]);
+  }
+
+  Cudd_ForeachCube(dd, (DdNode*) fn, gen, cube, value) {
+    char* row = rows + (long) n * vars_dim;
+    long combinations, c;
+    int nfree = 0;
+
+    /* the fixed values, and the variables to expand */
+    for (i = 0; i < vars_dim; ++i) {
+      if (2 == cube[indices[i]]) {
+        row[i] = 0;
+        free_vars[nfree++] = i;
+      }
+      else row[i] = (char) cube[indices[i]];
+    }
+
+    if (nfree >= (int) (8 * sizeof(int) - 1) ||
+        (combinations = 1L << nfree) > (long) (rows_dim - n)) {
+      n = -1;
+      Cudd_GenFree(gen);
+      break;
+    }
+
+    /* the other minterms of the cube differ in the free variables only */
+    for (c = 1; c < combinations; ++c) {
+      char* next = row + vars_dim;
+
+      memcpy(next, row, vars_dim);
+      for (i = 0; i < nfree; ++i) {
+        next[free_vars[i]] = (char) ((c >> i) & 1);
+      }
+      row = next;
+    }
+    n += (int) combinations;
+  }
+
+  FREE(free_vars);
+  FREE(indices);
+  return n;
+}
+
 /**Function********************************************************************
 
   Synopsis           [Returns the BDD variable with index <code>index</code>.]
@@ -3573,6 +4418,78 @@ int calculate_bdd_value(DdManager* mgr, bdd_ptr f, int* values)
 /* Definition of static functions                                            */
 /*---------------------------------------------------------------------------*/
 
+/**Function********************************************************************
+
+  Synopsis    [Balanced AND/OR of an array of BDDs.]
+
+  Description [Combines the n BDDs in fns with AND if conj is true, with
+  OR otherwise. At each round the i-th partial result is combined with
+  the (i + half)-th one, so that every input is involved in about log(n)
+  operations. The computation stops early when the absorbing constant
+  (false for AND, true for OR) is obtained. The result is referenced.]
+
+  SideEffects []
+
+  SeeAlso     [bdd_and_array bdd_or_array]
+
+******************************************************************************/
+static bdd_ptr dd_balanced_apply(DdManager * dd, bdd_ptr * fns, int n,
+                                 boolean conj)
+{
+  DdNode * absorbing = conj ? Cudd_ReadLogicZero(dd) : Cudd_ReadOne(dd);
+  DdNode ** parts;
+  DdNode * result;
+  int i, half;
+
+  nusmv_assert(n >= 0);
+
+  if (n == 0) {
+    result = conj ? Cudd_ReadOne(dd) : Cudd_ReadLogicZero(dd);
+    Cudd_Ref(result);
+    return((bdd_ptr)result);
+  }
+
+  parts = ALLOC(DdNode *, n);
+  nusmv_assert(parts != (DdNode **) NULL);
+  for (i = 0; i < n; i++) {
+    parts[i] = (DdNode *) fns[i];
+    Cudd_Ref(parts[i]);
+  }
+
+  while (n > 1) {
+    half = (n + 1) / 2;
+    for (i = 0; i + half < n; i++) {
+      result = conj ?
+        Cudd_bddAnd(dd, parts[i], parts[i + half]) :
+        Cudd_bddOr(dd, parts[i], parts[i + half]);
+      common_error(result, conj ? "bdd_and_array: result = NULL" :
+                                  "bdd_or_array: result = NULL");
+      Cudd_Ref(result);
+      Cudd_RecursiveDeref(dd, parts[i]);
+      Cudd_RecursiveDeref(dd, parts[i + half]);
+      parts[i] = result;
+
+      if (result == absorbing) {
+        /* the result is known: release the other live partial results,
+           i.e. the first half but i, and the second half after i + half */
+        int j;
+        for (j = 0; j < n; j++) {
+          if ((j < half && j != i) || (j > i + half)) {
+            Cudd_RecursiveDeref(dd, parts[j]);
+          }
+        }
+        FREE(parts);
+        return((bdd_ptr)result);
+      }
+    }
+    n = half;
+  }
+
+  result = parts[0];
+  FREE(parts);
+  return((bdd_ptr)result);
+}
+
 /**Function********************************************************************
 
   Synopsis [Function to print a warning that an illegal value was read.]
@@ -3588,3 +4505,65 @@ static void InvalidType(FILE *file, char *field, char *expected)
     fprintf(file, "Illegal type detected. %s expected\n", expected);
 
 } /* end of InvalidType */
+
+/**Function********************************************************************
+
+  Synopsis    [Records an event of the given kind.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_start]
+
+******************************************************************************/
+static void dd_trace_record(DdManager * dd, int kind)
+{
+  DdTraceEvent* event;
+
+  if (dd_trace_count >= dd_trace_capacity) {
+    dd_trace_dropped++;
+    return;
+  }
+
+  event = &dd_trace_events[dd_trace_count++];
+  event->kind = kind;
+  event->time = (double) clock() * 1e6 / CLOCKS_PER_SEC;
+  event->nodes = (long) (Cudd_ReadKeys(dd) - Cudd_ReadDead(dd));
+}
+
+/**Function********************************************************************
+
+  Synopsis    [The hooks registered by dd_trace_start.]
+
+  Description [They always return 1, so that the traced operations are
+  carried out.]
+
+  SideEffects []
+
+  SeeAlso     [dd_trace_start]
+
+******************************************************************************/
+static int dd_trace_gc_begin(DdManager * dd, const char * str, void * data)
+{
+  dd_trace_record(dd, DD_TRACE_GC_BEGIN);
+  return 1;
+}
+
+static int dd_trace_gc_end(DdManager * dd, const char * str, void * data)
+{
+  dd_trace_record(dd, DD_TRACE_GC_END);
+  return 1;
+}
+
+static int dd_trace_reorder_begin(DdManager * dd, const char * str,
+                                  void * data)
+{
+  dd_trace_record(dd, DD_TRACE_REORDER_BEGIN);
+  return 1;
+}
+
+static int dd_trace_reorder_end(DdManager * dd, const char * str,
+                                void * data)
+{
+  dd_trace_record(dd, DD_TRACE_REORDER_END);
+  return 1;
+}
@@ -72,6 +72,7 @@ typedef add_ptr (*FP_A_DA)(DdManager*, add_ptr);
 typedef add_ptr (*FP_A_DAA)(DdManager*, add_ptr, add_ptr);
 
 typedef DdGen dd_gen;
+typedef DdSnapshot dd_snapshot;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -114,6 +115,12 @@ typedef DdGen dd_gen;
 #define DEFAULT_REORDER          REORDER_SIFT /* The default value in the CUDD package */
 #define DEFAULT_MINSIZE          10 /* 10 = whatever (Verbatim from file cuddTable.c) */
 
+/* Kinds of the events recorded by dd_trace_start */
+#define DD_TRACE_GC_BEGIN        0
+#define DD_TRACE_GC_END          1
+#define DD_TRACE_REORDER_BEGIN   2
+#define DD_TRACE_REORDER_END     3
+
 #define ADD_FOREACH_NODE(manager, f, gen, node) \
   Cudd_ForeachNode(manager, f, gen, node)
 
@@ -191,6 +198,11 @@ EXTERN void     dd_autodyn_disable      ARGS((DdManager *));
 EXTERN int      dd_reordering_status    ARGS((DdManager *, dd_reorderingtype *));
 EXTERN int      dd_reorder              ARGS((DdManager *, int, int));
 EXTERN int      dd_get_reorderings      ARGS((DdManager *));
+EXTERN void     dd_set_reorder_time_limit  ARGS((DdManager *, long));
+EXTERN void     dd_set_reorder_total_limit ARGS((DdManager *, long));
+EXTERN boolean  dd_autodyn_suspend      ARGS((DdManager *));
+EXTERN void     dd_autodyn_resume       ARGS((DdManager *, boolean));
+EXTERN boolean  dd_reorder_if_due       ARGS((DdManager *));
 EXTERN dd_reorderingtype dd_get_ordering_method  ARGS((DdManager *));
 EXTERN int      StringConvertToDynOrderType  ARGS((char *string));
 EXTERN char *   DynOrderTypeConvertToString  ARGS((int method));
@@ -211,6 +223,8 @@ EXTERN bdd_ptr  bdd_and                 ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN void     bdd_and_accumulate      ARGS((DdManager *, bdd_ptr *, bdd_ptr));
 EXTERN bdd_ptr  bdd_or                  ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN void     bdd_or_accumulate       ARGS((DdManager *, bdd_ptr *, bdd_ptr));
+EXTERN bdd_ptr  bdd_and_array           ARGS((DdManager *, bdd_ptr *, int));
+EXTERN bdd_ptr  bdd_or_array            ARGS((DdManager *, bdd_ptr *, int));
 EXTERN bdd_ptr  bdd_xor                 ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_iff                 ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_imply               ARGS((DdManager *, bdd_ptr, bdd_ptr));
@@ -222,6 +236,7 @@ EXTERN bdd_ptr  bdd_simplify_assuming   ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_minimize            ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_cofactor            ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_between             ARGS((DdManager *, bdd_ptr, bdd_ptr));
+EXTERN bdd_ptr  bdd_subset_heavy_branch ARGS((DdManager *, bdd_ptr, int));
 EXTERN int      bdd_entailed            ARGS((DdManager * dd, bdd_ptr f, bdd_ptr g));
 EXTERN int      bdd_intersected         ARGS((DdManager * dd, bdd_ptr f, bdd_ptr g));
 EXTERN bdd_ptr  bdd_then                ARGS((DdManager *, bdd_ptr));
@@ -233,6 +248,7 @@ EXTERN int      bdd_index               ARGS((DdManager *, bdd_ptr));
 EXTERN bdd_ptr  bdd_pick_one_minterm    ARGS((DdManager *, bdd_ptr, bdd_ptr *, int));
 EXTERN bdd_ptr  bdd_pick_one_minterm_rand  ARGS((DdManager *, bdd_ptr, bdd_ptr *, int));
 EXTERN int      bdd_pick_all_terms      ARGS((DdManager *, bdd_ptr,  bdd_ptr *, int, bdd_ptr *, int));
+EXTERN int      bdd_get_minterms        ARGS((DdManager *, bdd_ptr, bdd_ptr *, int, char *, int));
 EXTERN bdd_ptr  bdd_support             ARGS((DdManager *, bdd_ptr));
 EXTERN int      bdd_size                ARGS((DdManager *, bdd_ptr));
 EXTERN double   bdd_count_minterm       ARGS((DdManager *, bdd_ptr, int));
@@ -240,6 +256,27 @@ EXTERN bdd_ptr  bdd_new_var_with_index  ARGS((DdManager *, int));
 EXTERN bdd_ptr bdd_get_one_sparse_sat   ARGS((DdManager *, bdd_ptr));
 EXTERN int      dd_set_parameters       ARGS((DdManager *, OptsHandler_ptr, FILE *));
 EXTERN void     dd_print_stats          ARGS((DdManager *, FILE *));
+EXTERN int      dd_get_cache_op_count   ARGS((DdManager *));
+EXTERN const char* dd_get_cache_op_name ARGS((DdManager *, int));
+EXTERN double   dd_get_cache_op_lookups ARGS((DdManager *, int));
+EXTERN double   dd_get_cache_op_hits    ARGS((DdManager *, int));
+EXTERN double   dd_get_cache_op_inserts ARGS((DdManager *, int));
+EXTERN double   dd_get_cache_op_evictions ARGS((DdManager *, int));
+EXTERN long     dd_get_memory_in_use    ARGS((DdManager *));
+EXTERN void     dd_set_memory_budget    ARGS((DdManager *, long));
+EXTERN long     dd_get_memory_budget    ARGS((DdManager *));
+EXTERN int      dd_get_memory_budget_events ARGS((DdManager *));
+EXTERN int      dd_add_memory_budget_hook ARGS((DdManager *, DD_HFP));
+EXTERN int      dd_remove_memory_budget_hook ARGS((DdManager *, DD_HFP));
+EXTERN long     dd_release_memory       ARGS((DdManager *));
+EXTERN int      dd_trace_start          ARGS((DdManager *, int));
+EXTERN void     dd_trace_stop           ARGS((DdManager *));
+EXTERN void     dd_trace_clear          ARGS((void));
+EXTERN int      dd_trace_get_event_count ARGS((void));
+EXTERN int      dd_trace_get_dropped_count ARGS((void));
+EXTERN int      dd_trace_get_event_kind ARGS((int));
+EXTERN double   dd_trace_get_event_time ARGS((int));
+EXTERN long     dd_trace_get_event_nodes ARGS((int));
 EXTERN bdd_ptr  bdd_cube_diff           ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_cube_union          ARGS((DdManager *, bdd_ptr, bdd_ptr));
 EXTERN bdd_ptr  bdd_cube_intersection   ARGS((DdManager *, bdd_ptr, bdd_ptr));
@@ -247,6 +284,14 @@ EXTERN int      bdd_get_lowest_index    ARGS((DdManager *, bdd_ptr));
 EXTERN int      dd_printminterm         ARGS((DdManager *, dd_ptr));
 EXTERN int      dd_dump_dot             ARGS((DdManager *, int, dd_ptr *, const char **, const char **, FILE *));
 EXTERN int      dd_dump_davinci         ARGS((DdManager *, int, dd_ptr *, const char **, const char **, FILE *));
+EXTERN int      dd_snapshot_save        ARGS((DdManager *, const char *, int, bdd_ptr *, const char **, const char **));
+EXTERN dd_snapshot * dd_snapshot_open   ARGS((const char *));
+EXTERN void     dd_snapshot_close       ARGS((dd_snapshot *));
+EXTERN int      dd_snapshot_get_var_count  ARGS((dd_snapshot *));
+EXTERN const char * dd_snapshot_get_var_name ARGS((dd_snapshot *, int));
+EXTERN int      dd_snapshot_get_root_count ARGS((dd_snapshot *));
+EXTERN const char * dd_snapshot_get_root_name ARGS((dd_snapshot *, int));
+EXTERN bdd_ptr * dd_snapshot_load       ARGS((DdManager *, dd_snapshot *, int *, boolean));
 EXTERN void     dd_AddCmd               ARGS((void));
 EXTERN bdd_ptr  bdd_largest_cube        ARGS((DdManager *, bdd_ptr, int *));
 EXTERN bdd_ptr  bdd_compute_prime_low   ARGS((DdManager *, bdd_ptr, bdd_ptr));
@@ -230,6 +230,10 @@ bdd_enc_get_var_mask_recur ARGS((BddEnc_ptr self, add_ptr var_encoding,
 static AddArray_ptr
 bdd_enc_eval ARGS((BddEnc_ptr self, Expr_ptr expr, node_ptr context));
 
+static node_ptr
+bdd_enc_add_leaf_at ARGS((BddEnc_ptr self, add_ptr add,
+                          const int* positions, const char* row));
+
 static AddArray_ptr
 bdd_enc_eval_recur ARGS((BddEnc_ptr self, Expr_ptr expr, node_ptr ctx));
 
@@ -3518,6 +3522,283 @@ int BddEnc_dump_addarray_davinci(BddEnc_ptr self,
 }
 
 
+/**Function********************************************************************
+
+  Synopsis           [Saves the given BDDs to a binary snapshot]
+
+  Description [Writes the n BDDs in bdds to the file filename, with
+  the names of the encoded variables they depend on, so that they can
+  be reloaded by BddEnc_load_bdds in an encoder of the same model,
+  even with a different variable order. names is an array of n
+  strings used as names of the BDDs, or NULL.
+
+  Returns 0 in case of success, 1 otherwise]
+
+  SideEffects        []
+
+  SeeAlso            [BddEnc_load_bdds]
+******************************************************************************/
+int BddEnc_save_bdds(BddEnc_ptr self, const char* filename,
+                     int n, bdd_ptr* bdds, const char** names)
+{
+  const int dd_size = dd_get_size(self->dd);
+  const char** inames;
+  int idx, res;
+
+  BDD_ENC_CHECK_INSTANCE(self);
+
+  inames = ALLOC(const char*, dd_size);
+  nusmv_assert((const char**) NULL != inames);
+  for (idx = 0; idx < dd_size; ++idx) {
+    node_ptr name = BddEnc_has_var_at_index(self, idx) ?
+      BddEnc_get_var_name_from_index(self, idx) : Nil;
+
+    if (Nil != name) inames[idx] = (const char*) sprint_node(name);
+    else inames[idx] = (const char*) NULL;
+  }
+
+  res = dd_snapshot_save(self->dd, filename, n, bdds, inames, names);
+
+  for (idx = 0; idx < dd_size; ++idx) {
+    if ((const char*) NULL != inames[idx]) { FREE(inames[idx]); }
+  }
+  FREE(inames);
+
+  return (res == 1) ? 0 : 1;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis           [Loads the BDDs of a binary snapshot]
+
+  Description [Loads the BDDs saved by BddEnc_save_bdds in filename.
+  The saved variables are matched by name with the variables of this
+  encoder; the load fails if a BDD depends on a variable that is not
+  encoded by self. If restore_order is true, the matched variables are
+  first permuted to follow the order they had when saving, which makes
+  the load linear in the number of nodes.
+
+  The names of the BDDs (newly allocated strings, or NULL) and the
+  referenced BDDs are appended to names and bdds respectively.
+
+  Returns 0 in case of success, 1 otherwise]
+
+  SideEffects        [May change the variable order if restore_order is
+  true]
+
+  SeeAlso            [BddEnc_save_bdds]
+******************************************************************************/
+int BddEnc_load_bdds(BddEnc_ptr self, const char* filename,
+                     boolean restore_order, array_t* names, array_t* bdds)
+{
+  const int dd_size = dd_get_size(self->dd);
+  dd_snapshot* snap;
+  hash_ptr indices;
+  bdd_ptr* loaded;
+  int* varmap;
+  int nvars, nroots, idx, i;
+
+  BDD_ENC_CHECK_INSTANCE(self);
+
+  snap = dd_snapshot_open(filename);
+  if ((dd_snapshot*) NULL == snap) return 1;
+
+  /* indices of the encoded variables, by name */
+  indices = new_assoc();
+  for (idx = 0; idx < dd_size; ++idx) {
+    node_ptr name = BddEnc_has_var_at_index(self, idx) ?
+      BddEnc_get_var_name_from_index(self, idx) : Nil;
+
+    if (Nil != name) {
+      char* str = sprint_node(name);
+      insert_assoc(indices, (node_ptr) find_string(str),
+                   PTR_FROM_INT(node_ptr, idx + 1));
+      FREE(str);
+    }
+  }
+
+  nvars = dd_snapshot_get_var_count(snap);
+  varmap = ALLOC(int, nvars + 1);
+  nusmv_assert((int*) NULL != varmap);
+  for (i = 0; i < nvars; ++i) {
+    const char* name = dd_snapshot_get_var_name(snap, i);
+
+    varmap[i] = -1;
+    if ((const char*) NULL != name) {
+      node_ptr found = find_assoc(indices,
+                                  (node_ptr) find_string((char*) name));
+      if (Nil != found) varmap[i] = PTR_TO_INT(found) - 1;
+    }
+  }
+  free_assoc(indices);
+
+  loaded = dd_snapshot_load(self->dd, snap, varmap, restore_order);
+  FREE(varmap);
+
+  if ((bdd_ptr*) NULL == loaded) {
+    dd_snapshot_close(snap);
+    return 1;
+  }
+
+  nroots = dd_snapshot_get_root_count(snap);
+  for (i = 0; i < nroots; ++i) {
+    const char* name = dd_snapshot_get_root_name(snap, i);
+
+    array_insert_last(const char*, names,
+                      ((const char*) NULL != name) ?
+                      (const char*) util_strsav((char*) name) :
+                      (const char*) NULL);
+    array_insert_last(bdd_ptr, bdds, loaded[i]);
+  }
+
+  FREE(loaded);
+  dd_snapshot_close(snap);
+  return 0;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis           [Decodes all the states of a BDD at once]
+
+  Description [Writes the values of the given state and frozen
+  variables in every state of states, as a table of columns. The
+  minterms of states are enumerated once, and the value of a variable
+  in a minterm is read by following the bits of the minterm in the ADD
+  encoding the variable, without building any BDD.
+
+  codes must have room for codes_dim ints per symbol: the value of the
+  i-th symbol in the j-th state is written to codes[i * codes_dim + j],
+  as the index of the value in the i-th array appended to values. These
+  arrays contain the distinct values (node_ptr) of each symbol, in
+  order of first appearance, and must be freed by the caller. Symbols
+  that are not encodable state or frozen variables get a NULL array of
+  values and -1 codes.
+
+  states must depend on state and frozen variables only, and be
+  restricted to valid encodings (see BddEnc_apply_state_frozen_vars_mask_bdd).
+
+  Returns the number of decoded states, or -1 if states has more than
+  codes_dim states.]
+
+  SideEffects        [codes is filled, arrays are appended to values]
+
+  SeeAlso            [BddEnc_assign_symbols, bdd_get_minterms]
+******************************************************************************/
+int BddEnc_decode_states(BddEnc_ptr self, bdd_ptr states,
+                         NodeList_ptr symbols, int* codes, int codes_dim,
+                         array_t* values)
+{
+  SymbTable_ptr st;
+  const int dd_size = dd_get_size(self->dd);
+  const int bits = self->minterm_state_frozen_vars_dim;
+  hash_ptr cache;
+  ListIter_ptr iter;
+  char* rows;
+  int* positions;
+  int n, idx, sym_idx;
+
+  BDD_ENC_CHECK_INSTANCE(self);
+
+  rows = ALLOC(char, (long) codes_dim * bits + 1);
+  nusmv_assert((char*) NULL != rows);
+
+  n = bdd_get_minterms(self->dd, states,
+                       array_fetch_p(bdd_ptr,
+                                     self->minterm_state_frozen_vars, 0),
+                       bits, rows, codes_dim);
+  if (n < 0) {
+    FREE(rows);
+    return -1;
+  }
+
+  /* the position in a row of the bit of each variable index */
+  positions = ALLOC(int, dd_size + 1);
+  nusmv_assert((int*) NULL != positions);
+  for (idx = 0; idx < dd_size; ++idx) positions[idx] = -1;
+  for (idx = 0; idx < bits; ++idx) {
+    bdd_ptr var = array_fetch(bdd_ptr, self->minterm_state_frozen_vars, idx);
+    positions[bdd_index(self->dd, var)] = idx;
+  }
+
+  st = BASE_ENC(self)->symb_table;
+  cache = new_assoc();
+  sym_idx = 0;
+  NODE_LIST_FOREACH(symbols, iter) {
+    node_ptr sym = NodeList_get_elem_at(symbols, iter);
+    int* column = codes + (long) sym_idx * codes_dim;
+    AddArray_ptr sym_add;
+    SymbType_ptr type;
+    hash_ptr found;
+    array_t* sym_values;
+    int i;
+
+    ++sym_idx;
+
+    if (!SymbTable_is_symbol_var(st, sym) ||
+        SymbTable_is_symbol_input_var(st, sym) ||
+        !Compile_is_expr_booleanizable(st, sym, false, cache)) {
+      for (i = 0; i < n; ++i) column[i] = -1;
+      array_insert_last(array_t*, values, (array_t*) NULL);
+      continue;
+    }
+
+    type = SymbTable_get_var_type(st, sym);
+    sym_add = bdd_enc_eval(self, sym, Nil);
+    found = new_assoc();
+    sym_values = array_alloc(node_ptr, 0);
+
+    for (i = 0; i < n; ++i) {
+      const char* row = rows + (long) i * bits;
+      node_ptr value;
+      node_ptr code;
+
+      if (SymbType_is_word(type)) {
+        int width = AddArray_get_size(sym_add);
+        WordNumber_ptr one = WordNumber_from_integer(1, width);
+        WordNumber_ptr word = WordNumber_from_integer(0, width);
+
+        for (--width; width >= 0; --width) {
+          node_ptr bit = bdd_enc_add_leaf_at(self, AddArray_get_n(sym_add,
+                                                                  width),
+                                             positions, row);
+          /* words with width 1 cannot be shifted at all */
+          if (WordNumber_get_width(word) != 1) {
+            word = WordNumber_left_shift(word, 1);
+          }
+          if (Expr_is_true(bit)) word = WordNumber_plus(word, one);
+        }
+        value = find_node(SymbType_is_signed_word(type)
+                          ? NUMBER_SIGNED_WORD : NUMBER_UNSIGNED_WORD,
+                          (node_ptr) word, Nil);
+      }
+      else {
+        value = bdd_enc_add_leaf_at(self, AddArray_get_add(sym_add),
+                                    positions, row);
+      }
+
+      code = find_assoc(found, value);
+      if (Nil == code) {
+        array_insert_last(node_ptr, sym_values, value);
+        code = PTR_FROM_INT(node_ptr, array_n(sym_values));
+        insert_assoc(found, value, code);
+      }
+      column[i] = PTR_TO_INT(code) - 1;
+    }
+
+    array_insert_last(array_t*, values, sym_values);
+    free_assoc(found);
+    AddArray_destroy(self->dd, sym_add);
+  }
+
+  free_assoc(cache);
+  FREE(positions);
+  FREE(rows);
+  return n;
+}
+
+
 /*---------------------------------------------------------------------------*/
 /* Definition of internal functions                                          */
 /*---------------------------------------------------------------------------*/
@@ -6312,6 +6593,33 @@ bdd_enc_get_var_mask_recur(BddEnc_ptr self, add_ptr var_encoding, add_ptr cube)
 }
 
 
+/**Function********************************************************************
+
+   Synopsis           [Returns the leaf of add reached by a row of bits]
+
+   Description        [Follows add from its root, taking the then or
+   else child of each node according to the bit of its variable in
+   row. positions gives the position in row of the bit of each variable
+   index; add must depend on variables of row only.]
+
+   SideEffects        []
+
+   SeeAlso            [BddEnc_decode_states]
+
+******************************************************************************/
+static node_ptr bdd_enc_add_leaf_at(BddEnc_ptr self, add_ptr add,
+                                    const int* positions, const char* row)
+{
+  while (!add_isleaf(add)) {
+    const int position = positions[add_index(self->dd, add)];
+
+    nusmv_assert(position >= 0);
+    add = row[position] ? add_then(self->dd, add) : add_else(self->dd, add);
+  }
+  return add_get_leaf(self->dd, add);
+}
+
+
 /**Function********************************************************************
 
    Synopsis           [Given an expression the corresponding hybrid ADD is
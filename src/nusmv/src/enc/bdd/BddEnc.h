@@ -403,6 +403,23 @@ EXTERN int BddEnc_dump_addarray_dot ARGS((BddEnc_ptr self,
                                           const char** labels,
                                           FILE* outfile));
 
+EXTERN int BddEnc_save_bdds ARGS((BddEnc_ptr self,
+                                  const char* filename,
+                                  int n, bdd_ptr* bdds,
+                                  const char** names));
+
+EXTERN int BddEnc_load_bdds ARGS((BddEnc_ptr self,
+                                  const char* filename,
+                                  boolean restore_order,
+                                  array_t* names,
+                                  array_t* bdds));
+
+EXTERN int BddEnc_decode_states ARGS((BddEnc_ptr self,
+                                      bdd_ptr states,
+                                      NodeList_ptr symbols,
+                                      int* codes, int codes_dim,
+                                      array_t* values));
+
 EXTERN int BddEnc_dump_addarray_davinci ARGS((BddEnc_ptr self,
                                               AddArray_ptr addarray,
                                               const char** labels,
@@ -184,6 +184,13 @@ static enum st_retval
 be_enc_shift_hash_callback_del_entry_and_key ARGS((char* key, char* record,
                                                    char* dummy));
 
+static Be_Template_ptr
+be_enc_get_template ARGS((BeEnc_ptr self, const be_ptr exp));
+
+static enum st_retval
+be_enc_template_hash_callback_del_entry ARGS((char* key, char* record,
+                                              char* dummy));
+
 
 /*---------------------------------------------------------------------------*/
 /* Static inline function definitions                                        */
@@ -1521,6 +1528,10 @@ void be_enc_init(BeEnc_ptr self,
     st_init_table(&be_enc_shift_hash_key_cmp, &be_enc_shift_hash_key_hash);
   nusmv_assert(self->shift_hash != (st_table*) NULL);
 
+  /* allocates the hash of the expressions compiled for shifting */
+  self->template_hash = new_assoc();
+  nusmv_assert(self->template_hash != (hash_ptr) NULL);
+
   /* virtual methods settings */
   OVERRIDE(Object, finalize) = be_enc_finalize;
 
@@ -1546,6 +1557,7 @@ void be_enc_deinit(BeEnc_ptr self)
   /* members deinitialization */
   be_enc_clean_shift_hash(self);
   st_free_table(self->shift_hash);
+  free_assoc(self->template_hash);
 
   if (self->subst_array != (int*) NULL) FREE(self->subst_array);
   if (self->phy2log != (int*) NULL) FREE(self->phy2log);
@@ -2752,8 +2764,9 @@ be_enc_shift_exp_at_time(BeEnc_ptr self, const be_ptr exp, int time)
 
     if (!Be_IsConstant(self->be_mgr, exp)) {
       delta = be_enc_index_log_untimed_to_timed(self, 0, time);
-      result =  Be_LogicalShiftVar(self->be_mgr, exp, delta,
-                                   self->log2phy, self->phy2log);
+      result = Be_LogicalTemplate_ShiftVar(self->be_mgr,
+                                           be_enc_get_template(self, exp),
+                                           delta, self->log2phy);
     }
     else result = exp;
 
@@ -2912,8 +2925,9 @@ be_enc_shift_exp_at_times(BeEnc_ptr self, const be_ptr exp,
       }
 
       /* performs the substitution */
-      result = Be_LogicalVarSubst(self->be_mgr, exp, self->subst_array,
-                                  self->log2phy, self->phy2log);
+      result = Be_LogicalTemplate_VarSubst(self->be_mgr,
+                                           be_enc_get_template(self, exp),
+                                           self->subst_array, self->log2phy);
     } /* if */
 
     /* memoize */
@@ -2946,6 +2960,40 @@ static void be_enc_clean_shift_hash(BeEnc_ptr self)
 
   st_foreach(self->shift_hash, &be_enc_shift_hash_callback_del_entry_and_key,
              NULL /*unused*/);
+
+  /* compiled expressions depend on the logical indices as well */
+  clear_assoc_and_free_entries(self->template_hash,
+                               &be_enc_template_hash_callback_del_entry);
+}
+
+
+/**Function********************************************************************
+
+Synopsis           [Returns the template compiled from the given
+expression]
+
+Description        [Templates are compiled once per expression, and are
+kept until the shifting cache is cleaned. Then every time frame is
+instantiated from the template with a linear pass, instead of
+traversing and rebuilding exp through a dfs.]
+
+SideEffects        [The template is compiled and memoized if not
+already existing]
+
+SeeAlso            [be_enc_shift_exp_at_time, be_enc_shift_exp_at_times]
+
+******************************************************************************/
+static Be_Template_ptr be_enc_get_template(BeEnc_ptr self, const be_ptr exp)
+{
+  Be_Template_ptr res;
+
+  res = (Be_Template_ptr) find_assoc(self->template_hash, (node_ptr) exp);
+  if (res == (Be_Template_ptr) NULL) {
+    res = Be_LogicalTemplate_Create(self->be_mgr, exp, self->phy2log);
+    insert_assoc(self->template_hash, (node_ptr) exp, (node_ptr) res);
+  }
+
+  return res;
 }
 
 
@@ -2981,4 +3029,11 @@ be_enc_shift_hash_callback_del_entry_and_key(char* key, char* record, char* dumm
   return ST_DELETE; /* removes associated element */
 }
 
+static enum st_retval
+be_enc_template_hash_callback_del_entry(char* key, char* record, char* dummy)
+{
+  Be_LogicalTemplate_Destroy((Be_Template_ptr) record);
+  return ST_DELETE;
+}
+
 /**AutomaticEnd***************************************************************/
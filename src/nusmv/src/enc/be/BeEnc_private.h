@@ -317,6 +317,7 @@ typedef struct BeEnc_TAG
   int subst_array_size; 
 
   st_table* shift_hash; /* used to memoize shifting operations */
+  hash_ptr template_hash; /* expressions compiled for shifting */
 
   /* -------------------------------------------------- */
   /*                  Virtual methods                   */
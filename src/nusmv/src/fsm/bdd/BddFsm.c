@@ -100,6 +100,14 @@ static void bdd_fsm_deinit ARGS((BddFsm_ptr self));
 
 static void bdd_fsm_compute_reachable_states ARGS((BddFsm_ptr self));
 
+static boolean bdd_fsm_expand_reachable_layers ARGS((BddFsm_ptr self,
+                                                     int k,
+                                                     int max_seconds));
+
+static boolean bdd_fsm_guided_reachable_states ARGS((BddFsm_ptr self,
+                                                     int threshold,
+                                                     int max_seconds));
+
 static BddStatesInputs
 bdd_fsm_get_legal_state_input ARGS((BddFsm_ptr self));
 
@@ -115,6 +123,7 @@ ARGS((const BddFsm_ptr self, BddStatesInputs subspace, BddFsm_dir dir));
 static BddStatesInputs
 bdd_fsm_compute_EL_SI_subset ARGS((const BddFsm_ptr self,
                                    BddStatesInputs subspace,
+                                   BddStatesInputs over,
                                    BddFsm_dir dir));
 
 static BddStatesInputs
@@ -467,6 +476,91 @@ void BddFsm_update_cached_reachable_states(const BddFsm_ptr self,
   BddFsmCache_set_reachables(self->cache, layers_list, size, completed);
 }
 
+/**Function********************************************************************
+
+   Synopsis           [Sets the number of BDD nodes that can be held by the
+   onion rings cached in this FSM]
+
+   Description        [Fixpoint computations such as eu and eg may keep
+   their onion rings in the FSM, so that explanations can walk them
+   instead of computing them again. A budget of 0, the default, disables
+   this cache.]
+
+   SideEffects        [Internal cache could change]
+
+   SeeAlso            [BddFsm_get_cached_rings BddFsm_update_cached_rings]
+
+******************************************************************************/
+void BddFsm_set_rings_budget(BddFsm_ptr self, long budget)
+{
+  BDD_FSM_CHECK_INSTANCE(self);
+  BddFsmCache_set_rings_budget(self->cache, budget);
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Returns the number of BDD nodes that can be held by
+   the onion rings cached in this FSM]
+
+   Description        []
+
+   SideEffects        []
+
+   SeeAlso            [BddFsm_set_rings_budget]
+
+******************************************************************************/
+long BddFsm_get_rings_budget(const BddFsm_ptr self)
+{
+  BDD_FSM_CHECK_INSTANCE(self);
+  return CACHE_GET(rings_budget);
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Returns the cached onion rings of a fixpoint]
+
+   Description        [Returns true if the rings of the fixpoint of the
+   given kind over f and g are cached; layers and size are then set. The
+   layers belong to the cache and must not be freed; they stay valid
+   until the next update of the cached rings.]
+
+   SideEffects        []
+
+   SeeAlso            [BddFsm_update_cached_rings]
+
+******************************************************************************/
+boolean BddFsm_get_cached_rings(const BddFsm_ptr self, BddFsmRingsKind kind,
+                                bdd_ptr f, bdd_ptr g,
+                                BddStates** layers, int* size)
+{
+  BDD_FSM_CHECK_INSTANCE(self);
+  return BddFsmCache_get_rings(self->cache, kind, f, g, layers, size);
+}
+
+
+/**Function********************************************************************
+
+   Synopsis           [Caches the onion rings of a fixpoint]
+
+   Description        [layers_list is the reversed list of the layers,
+   it is destroyed. The rings are kept only if they fit in the budget of
+   the FSM.]
+
+   SideEffects        [Internal cache could change]
+
+   SeeAlso            [BddFsm_get_cached_rings BddFsm_set_rings_budget]
+
+******************************************************************************/
+void BddFsm_update_cached_rings(const BddFsm_ptr self, BddFsmRingsKind kind,
+                                bdd_ptr f, bdd_ptr g,
+                                node_ptr layers_list, int size)
+{
+  BDD_FSM_CHECK_INSTANCE(self);
+  BddFsmCache_set_rings(self->cache, kind, f, g, layers_list, size);
+}
+
 /**Function********************************************************************
 
    Synopsis     [Returns true if the set of reachable states has already been
@@ -532,18 +626,20 @@ BddStates BddFsm_get_reachable_states(BddFsm_ptr self)
 
   BDD_FSM_CHECK_INSTANCE(self);
 
+  /* Compute them if necessary. Onion rings are not needed here, so
+     guided reachability can be used if enabled */
+  if (!BddFsm_has_cached_reachable_states(self) &&
+      CACHE_IS_EQUAL(reachable.computed, false)) {
+    boolean completed = BddFsm_expand_cached_reachable_states(self, -1, -1);
+    nusmv_assert(completed);
+  }
+
   /* If we already have the complete set of reachable states, return
      it. */
   if (BddFsm_has_cached_reachable_states(self)) {
     res = CACHE_GET(reachable.reachable_states);
   }
-  /* Otherwise compute them, if necessary */
   else {
-
-    if ( CACHE_IS_EQUAL(reachable.computed, false) ) {
-      bdd_fsm_compute_reachable_states(self);
-    }
-
     if (CACHE_GET(reachable.diameter) > 0) {
       res = CACHE_GET(reachable.layers[CACHE_GET(reachable.diameter) - 1]);
     }
@@ -1866,6 +1962,68 @@ BddStates BddFsm_get_revfair_states(BddFsm_ptr self)
 }
 
 
+/**Function********************************************************************
+
+   Synopsis     [Returns the set of fair states of the machine restricted
+   to subspace.]
+
+   Description  [A state is fair in subspace iff it can reach, within
+   subspace, a cycle of subspace that visits all fairness constraints.
+   The result is not cached. The returned BDD must be freed by the caller.]
+
+   SideEffects  []
+
+   SeeAlso      [BddFsm_get_fair_states_inputs_subset_from]
+
+******************************************************************************/
+BddStates BddFsm_get_fair_states_subset(const BddFsm_ptr self,
+                                        BddStates subspace)
+{
+  BddStatesInputs si;
+  BddStates res;
+
+  BDD_FSM_CHECK_INSTANCE(self);
+
+  si = BddFsm_get_fair_states_inputs_subset_from(self, subspace,
+                                                 BDD_STATES_INPUTS(NULL));
+  res = BddFsm_states_inputs_to_states(self, si);
+  bdd_free(self->dd, si);
+
+  return res;
+}
+
+
+/**Function********************************************************************
+
+   Synopsis     [Returns the set of fair state-input pairs of the machine
+   restricted to subspace, warm-starting from over.]
+
+   Description  [A state-input pair is fair in subspace iff it can reach,
+   within subspace, a cycle of subspace that visits all fairness
+   constraints.
+
+   over is either NULL or a set of state-input pairs containing the result,
+   such as the fair state-input pairs of a larger subspace; the greatest
+   fixpoint is started from over instead of true. If over does not contain
+   the result, a subset of it is returned.
+
+   The result is not cached. The returned BDD must be freed by the caller.]
+
+   SideEffects  []
+
+   SeeAlso      [BddFsm_get_fair_states_inputs]
+
+******************************************************************************/
+BddStatesInputs
+BddFsm_get_fair_states_inputs_subset_from(const BddFsm_ptr self,
+                                          BddStatesInputs subspace,
+                                          BddStatesInputs over)
+{
+  BDD_FSM_CHECK_INSTANCE(self);
+  return bdd_fsm_compute_EL_SI_subset(self, subspace, over, BDD_FSM_DIR_BWD);
+}
+
+
 /**Function********************************************************************
 
    Synopsis [Given two sets of states, returns the set of inputs
@@ -2003,7 +2161,14 @@ BddStates BddFsm_states_inputs_to_states(const BddFsm_ptr self,
    the termination of the last cycle)]
 
    Description [ If k<0 the set is expanded until fixpoint, if max_seconds<0 no
-   time limit is considered ]
+   time limit is considered.
+
+   When the guided_reachability_threshold option is set and the whole
+   fixpoint is requested from scratch, the set is computed with guided
+   (high density) reachability: frontiers larger than the threshold are
+   subsetted. Only the final set is cached in that case, without onion
+   rings, since the intermediate sets are not BFS layers; see
+   bdd_fsm_guided_reachable_states. ]
 
    SideEffects  [Changes the internal cache]
 
@@ -2013,6 +2178,47 @@ BddStates BddFsm_states_inputs_to_states(const BddFsm_ptr self,
 boolean BddFsm_expand_cached_reachable_states(BddFsm_ptr self,
                                               int k,
                                               int max_seconds)
+{
+  int diameter;
+  BddStates* layers;
+
+  BDD_FSM_CHECK_INSTANCE(self);
+
+  /* Guided reachability only provides the final set of states, so it
+     is used only when neither onion rings nor a full expansion are
+     cached yet */
+  if (k < 0 && !BddFsm_get_cached_reachable_states(self, &layers, &diameter)
+      && diameter <= 0) {
+    int threshold =
+      get_guided_reachability_threshold(OptsHandler_get_instance());
+
+    if (threshold > 0) {
+      if (BddFsm_has_cached_reachable_states(self)) return true;
+      return bdd_fsm_guided_reachable_states(self, threshold, max_seconds);
+    }
+  }
+
+  return bdd_fsm_expand_reachable_layers(self, k, max_seconds);
+}
+
+
+/**Function********************************************************************
+
+   Synopsis     [Expands the onion rings of reachable states]
+
+   Description  [Exact expansion behind
+   BddFsm_expand_cached_reachable_states: makes k steps (until fixpoint
+   if k<0) within max_seconds (no limit if negative), caching every BFS
+   layer.]
+
+   SideEffects  [Changes the internal cache]
+
+   SeeAlso      [BddFsm_expand_cached_reachable_states]
+
+******************************************************************************/
+static boolean bdd_fsm_expand_reachable_layers(BddFsm_ptr self,
+                                               int k,
+                                               int max_seconds)
 {
   bdd_ptr reachable_states_bdd;
   bdd_ptr from_lower_bound;   /* the frontier */
@@ -2023,6 +2229,8 @@ boolean BddFsm_expand_cached_reachable_states(BddFsm_ptr self,
   boolean completed;
   BddStates* layers;
   boolean result;
+  boolean phased_reorder;
+  boolean autodyn;
 
   long start_time;
   long limit_time;
@@ -2107,6 +2315,13 @@ boolean BddFsm_expand_cached_reachable_states(BddFsm_ptr self,
     fprintf(nusmv_stderr, "\ncomputing reachable state space\n");
   }
 
+  /* When required, automatic reordering is suspended inside the
+     image computations and only performed between iterations, where
+     the live BDDs are just the reachable states and the frontier */
+  phased_reorder =
+    opt_reorder_between_iterations(OptsHandler_get_instance());
+  autodyn = phased_reorder ? dd_autodyn_suspend(self->dd) : false;
+
   /* Real analysis: the cycle terminates when fixpoint is reached so
      no new states can be visited */
   while ((bdd_isnot_false(self->dd, from_lower_bound)) &&
@@ -2118,6 +2333,8 @@ boolean BddFsm_expand_cached_reachable_states(BddFsm_ptr self,
     /* Decrease the remaining steps if k is not < 0*/
     if (k>0) k--;
 
+    if (autodyn) dd_reorder_if_due(self->dd);
+
     /* Save old reachables */
     from_upper_bound = bdd_dup(reachable_states_bdd);
 
@@ -2185,6 +2402,8 @@ boolean BddFsm_expand_cached_reachable_states(BddFsm_ptr self,
 
   } /* while loop */
 
+  if (phased_reorder) dd_autodyn_resume(self->dd, autodyn);
+
   result = bdd_is_false(self->dd, from_lower_bound);
 
   if (result) {
@@ -2650,13 +2869,123 @@ static void bdd_fsm_compute_reachable_states(BddFsm_ptr self)
   boolean res;
 
   /* Expand cacked reachable states until fixpoint without time limitations */
-  res = BddFsm_expand_cached_reachable_states(self, -1, -1);
+  res = bdd_fsm_expand_reachable_layers(self, -1, -1);
 
   /* Assert that we completed the reachability analysis */
   nusmv_assert(res);
 }
 
 
+/**Function********************************************************************
+
+   Synopsis     [Computes the set of reachable states with guided (high
+   density) reachability]
+
+   Description  [Forward fixpoint in which every frontier larger than
+   threshold BDD nodes is replaced by a dense subset of it before its
+   image is computed, so that the search goes deep quickly even when
+   exact frontiers blow up. When the frontier becomes empty but some
+   states have been dropped on the way, one exact image of the whole
+   reached set is computed: the search resumes from the new states it
+   contains, if any, otherwise the fixpoint is the exact set of
+   reachable states.
+
+   On success the set is cached with BddFsm_set_reachable_states and
+   true is returned. If max_seconds (when not negative) expires before
+   the fixpoint, nothing is cached and false is returned.]
+
+   SideEffects  [Changes the internal cache]
+
+   SeeAlso      [BddFsm_expand_cached_reachable_states]
+
+******************************************************************************/
+static boolean bdd_fsm_guided_reachable_states(BddFsm_ptr self,
+                                               int threshold,
+                                               int max_seconds)
+{
+  bdd_ptr reachable, frontier, invars;
+  boolean approximated, exact_step, result;
+  boolean phased_reorder, autodyn;
+  long start_time = util_cpu_time();
+  int iteration = 0;
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+    fprintf(nusmv_stderr,
+            "\ncomputing reachable state space (guided, threshold = %d)\n",
+            threshold);
+  }
+
+  reachable = BddFsm_get_init(self);
+  invars = BddFsm_get_state_constraints(self);
+  bdd_and_accumulate(self->dd, &reachable, invars);
+  bdd_free(self->dd, invars);
+
+  frontier = bdd_dup(reachable);
+  approximated = false;
+  exact_step = false;
+
+  phased_reorder =
+    opt_reorder_between_iterations(OptsHandler_get_instance());
+  autodyn = phased_reorder ? dd_autodyn_suspend(self->dd) : false;
+
+  while (bdd_isnot_false(self->dd, frontier) &&
+         ((-1 == max_seconds) ||
+          (util_cpu_time() - start_time) < max_seconds * 1000)) {
+    bdd_ptr img, not_reachable;
+
+    if (autodyn) dd_reorder_if_due(self->dd);
+
+    if (!exact_step && bdd_size(self->dd, frontier) > threshold) {
+      bdd_ptr dense = bdd_subset_heavy_branch(self->dd, frontier, threshold);
+      bdd_free(self->dd, frontier);
+      frontier = dense;
+      approximated = true;
+    }
+
+    if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+      fprintf(nusmv_stderr,
+              "  iteration %d%s: BDD size = %d, frontier size = %d\n",
+              iteration, exact_step ? " (exact)" : "",
+              bdd_size(self->dd, reachable), bdd_size(self->dd, frontier));
+    }
+
+    img = BddFsm_get_forward_image(self, BDD_STATES(frontier));
+    bdd_free(self->dd, frontier);
+
+    not_reachable = bdd_not(self->dd, reachable);
+    frontier = bdd_and(self->dd, img, not_reachable);
+    bdd_free(self->dd, not_reachable);
+    bdd_free(self->dd, img);
+
+    bdd_or_accumulate(self->dd, &reachable, frontier);
+    exact_step = false;
+    ++iteration;
+
+    /* Dropped states may lead to states not reached yet */
+    if (bdd_is_false(self->dd, frontier) && approximated) {
+      bdd_free(self->dd, frontier);
+      frontier = bdd_dup(reachable);
+      approximated = false;
+      exact_step = true;
+    }
+  }
+
+  if (phased_reorder) dd_autodyn_resume(self->dd, autodyn);
+
+  result = bdd_is_false(self->dd, frontier);
+  if (result) BddFsm_set_reachable_states(self, BDD_STATES(reachable));
+
+  bdd_free(self->dd, frontier);
+  bdd_free(self->dd, reachable);
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+    fprintf(nusmv_stderr, "done\n");
+  }
+
+  return result;
+}
+
+
 /**Function********************************************************************
 
    Synopsis     [Returns the set of states and inputs,
@@ -2828,7 +3157,12 @@ static BddStatesInputs bdd_fsm_EUorES_SI(const BddFsm_ptr self,
    Synopsis     [Executes the Emerson-Lei algorithm]
 
    Description  [Executes the Emerson-Lei algorithm in the set of states
-   given by subspace in the direction given by dir]
+   given by subspace in the direction given by dir.
+
+   The greatest fixpoint is started from over if not NULL, from true
+   otherwise. The iterates are intersected with the previous ones, so the
+   result is exact as soon as over contains it, e.g. when over is the
+   result for a larger subspace.]
 
    SeeAlso      []
 
@@ -2837,6 +3171,7 @@ static BddStatesInputs bdd_fsm_EUorES_SI(const BddFsm_ptr self,
 ******************************************************************************/
 static BddStatesInputs bdd_fsm_compute_EL_SI_subset(const BddFsm_ptr self,
                                                     BddStatesInputs subspace,
+                                                    BddStatesInputs over,
                                                     BddFsm_dir dir)
 {
   BddStatesInputs res;
@@ -2845,7 +3180,12 @@ static BddStatesInputs bdd_fsm_compute_EL_SI_subset(const BddFsm_ptr self,
 
   BDD_FSM_CHECK_INSTANCE(self);
 
-  res = bdd_true(self->dd);
+  if (over != BDD_STATES_INPUTS(NULL)) {
+    res = bdd_and(self->dd, over, subspace);
+  }
+  else {
+    res = bdd_true(self->dd);
+  }
   old = bdd_false(self->dd);
 
   /* GFP computation */
@@ -2974,7 +3314,8 @@ bdd_fsm_get_fair_or_revfair_states_inputs_in_subspace(const BddFsm_ptr self,
   BddStatesInputs fair_or_revfair_states_inputs;
 
   fair_or_revfair_states_inputs =
-    bdd_fsm_compute_EL_SI_subset(self, subspace, dir);
+    bdd_fsm_compute_EL_SI_subset(self, subspace, BDD_STATES_INPUTS(NULL),
+                                 dir);
 
   return fair_or_revfair_states_inputs;
 }
@@ -77,6 +77,21 @@ enum Bdd_Fsm_dir_TAG {BDD_FSM_DIR_BWD, BDD_FSM_DIR_FWD};
 typedef enum Bdd_Fsm_dir_TAG BddFsm_dir;
 
 
+/**Enum************************************************************************
+
+  Synopsis     [The fixpoints whose onion rings can be cached]
+
+  Description  [BDD_FSM_RINGS_EU: the layers of E\[f U g\], layer i
+  containing the states at distance i from g;
+  BDD_FSM_RINGS_EG: the single fair states-inputs layer of EG f.]
+
+  SeeAlso      [BddFsm_get_cached_rings]
+
+******************************************************************************/
+enum Bdd_Fsm_rings_kind_TAG {BDD_FSM_RINGS_EU, BDD_FSM_RINGS_EG};
+typedef enum Bdd_Fsm_rings_kind_TAG BddFsmRingsKind;
+
+
 /* ---------------------------------------------------------------------- */
 /* public interface                                                       */
 /* ---------------------------------------------------------------------- */
@@ -226,6 +241,22 @@ EXTERN void
 BddFsm_apply_synchronous_product ARGS((BddFsm_ptr self, 
                                        const BddFsm_ptr other));
 
+EXTERN void BddFsm_set_rings_budget ARGS((BddFsm_ptr self, long budget));
+
+EXTERN long BddFsm_get_rings_budget ARGS((const BddFsm_ptr self));
+
+EXTERN boolean BddFsm_get_cached_rings ARGS((const BddFsm_ptr self,
+                                             BddFsmRingsKind kind,
+                                             bdd_ptr f, bdd_ptr g,
+                                             BddStates** layers,
+                                             int* size));
+
+EXTERN void BddFsm_update_cached_rings ARGS((const BddFsm_ptr self,
+                                             BddFsmRingsKind kind,
+                                             bdd_ptr f, bdd_ptr g,
+                                             node_ptr layers_list,
+                                             int size));
+
 /* temporary per il momento */
 EXTERN boolean BddFsm_is_fair_states ARGS((const BddFsm_ptr self,
                                            BddStates states));
@@ -243,6 +274,11 @@ EXTERN BddStates
 BddFsm_get_fair_states_subset ARGS((const BddFsm_ptr self,
                                     BddStates subspace));
 
+EXTERN BddStatesInputs
+BddFsm_get_fair_states_inputs_subset_from ARGS((const BddFsm_ptr self,
+                                                BddStatesInputs subspace,
+                                                BddStatesInputs over));
+
 EXTERN BddStates BddFsm_states_inputs_to_states ARGS((const BddFsm_ptr self,
                                                       BddStatesInputs si));
 
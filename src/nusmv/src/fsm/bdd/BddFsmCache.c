@@ -72,6 +72,9 @@ static char rcsid[] UTIL_UNUSED = "$Id: BddFsmCache.c,v 1.1.2.8.4.3.4.9 2010-02-
 static void bdd_fsm_cache_init ARGS((BddFsmCache_ptr self, DdManager* dd));
 static void bdd_fsm_cache_deinit ARGS((BddFsmCache_ptr self));
 static void bdd_fsm_cache_deinit_reachables ARGS((BddFsmCache_ptr self));
+static void bdd_fsm_cache_fit_rings ARGS((BddFsmCache_ptr self, long nodes));
+static void bdd_fsm_cache_free_rings ARGS((BddFsmCache_ptr self,
+                                           BddFsmRings_ptr rings));
 
 
 /* ---------------------------------------------------------------------- */
@@ -154,6 +157,9 @@ BddFsmCache_ptr BddFsmCache_hard_copy(const BddFsmCache_ptr self)
 
   BddFsmCache_copy_reachables(copy, self);
 
+  /* onion rings are not copied, only their budget */
+  copy->rings_budget = self->rings_budget;
+
   return copy;
 }
 
@@ -187,6 +193,8 @@ void BddFsmCache_reset_not_reusable_fields_after_product(BddFsmCache_ptr self)
   CACHE_UNREF_BDD(BddStates, deadlock_states);
   CACHE_UNREF_BDD(BddStatesInputs, legal_state_input);
   CACHE_UNREF_BDD(BddStatesInputs, monolithic_trans);
+
+  bdd_fsm_cache_fit_rings(self, 0);
 }
 
 
@@ -338,6 +346,140 @@ void BddFsmCache_set_reachables(BddFsmCache_ptr self,
 }
 
 
+/**Function********************************************************************
+
+  Synopsis     [Sets the number of BDD nodes the onion rings can hold]
+
+  Description  [Least recently used rings are dropped until the cached
+  rings fit in the new budget. A budget of 0 disables the cache of onion
+  rings.]
+
+  SideEffects  [cache changes]
+
+  SeeAlso      [BddFsmCache_set_rings]
+
+******************************************************************************/
+void BddFsmCache_set_rings_budget(BddFsmCache_ptr self, long budget)
+{
+  BDD_FSM_CACHE_CHECK_INSTANCE(self);
+
+  self->rings_budget = budget > 0 ? budget : 0;
+  bdd_fsm_cache_fit_rings(self, self->rings_budget);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis     [Stores the onion rings of a fixpoint]
+
+  Description [Given list layers_list must be reversed, from the last
+  layer to the first one. The rings are stored for the given kind and
+  arguments f and g (g may be NULL), replacing any previous rings for
+  the same fixpoint. Least recently used rings are dropped to keep the
+  total within the budget; rings that alone exceed the budget are not
+  stored. Given list layers_list will be destroyed.]
+
+  SideEffects [given list layers_list will be destroyed, cache
+  changes]
+
+  SeeAlso      [BddFsmCache_get_rings]
+
+******************************************************************************/
+void BddFsmCache_set_rings(BddFsmCache_ptr self, BddFsmRingsKind kind,
+                           bdd_ptr f, bdd_ptr g,
+                           node_ptr layers_list, const int size)
+{
+  BddFsmRings_ptr rings;
+  BddFsmRings_ptr* prev;
+  long nodes = 0;
+  int i;
+
+  BDD_FSM_CACHE_CHECK_INSTANCE(self);
+
+  /* drops the previous rings of the same fixpoint */
+  for (prev = &self->rings; *prev != (BddFsmRings_ptr) NULL;
+       prev = &(*prev)->next) {
+    rings = *prev;
+    if (rings->kind == kind && rings->f == f && rings->g == g) {
+      *prev = rings->next;
+      self->rings_nodes -= rings->nodes;
+      bdd_fsm_cache_free_rings(self, rings);
+      break;
+    }
+  }
+
+  rings = ALLOC(BddFsmRings, 1);
+  nusmv_assert(rings != (BddFsmRings_ptr) NULL);
+  rings->kind = kind;
+  rings->f = bdd_dup(f);
+  rings->g = (g != (bdd_ptr) NULL) ? bdd_dup(g) : (bdd_ptr) NULL;
+  rings->size = size;
+  rings->layers = ALLOC(BddStates, size);
+  nusmv_assert(rings->layers != (BddStates*) NULL);
+
+  for (i = size-1; i >= 0; --i) {
+    node_ptr tmp;
+
+    rings->layers[i] = BDD_STATES( car(layers_list) );
+    nodes += bdd_size(self->dd, rings->layers[i]);
+    tmp = layers_list;
+    layers_list = cdr(layers_list);
+    free_node(tmp);
+  }
+  rings->nodes = nodes;
+
+  if (nodes > self->rings_budget) {
+    bdd_fsm_cache_free_rings(self, rings);
+    return;
+  }
+
+  bdd_fsm_cache_fit_rings(self, self->rings_budget - nodes);
+  rings->next = self->rings;
+  self->rings = rings;
+  self->rings_nodes += nodes;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis     [Returns the cached onion rings of a fixpoint]
+
+  Description  [Returns true and sets layers and size if rings are
+  cached for the given kind and arguments, returns false otherwise.
+  The returned layers belong to the cache and stay valid until the
+  next change of the cached rings.]
+
+  SideEffects  [The found rings become the most recently used ones]
+
+  SeeAlso      [BddFsmCache_set_rings]
+
+******************************************************************************/
+boolean BddFsmCache_get_rings(BddFsmCache_ptr self, BddFsmRingsKind kind,
+                              bdd_ptr f, bdd_ptr g,
+                              BddStates** layers, int* size)
+{
+  BddFsmRings_ptr* prev;
+
+  BDD_FSM_CACHE_CHECK_INSTANCE(self);
+
+  for (prev = &self->rings; *prev != (BddFsmRings_ptr) NULL;
+       prev = &(*prev)->next) {
+    BddFsmRings_ptr rings = *prev;
+
+    if (rings->kind == kind && rings->f == f && rings->g == g) {
+      *prev = rings->next;
+      rings->next = self->rings;
+      self->rings = rings;
+
+      *layers = rings->layers;
+      *size = rings->size;
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /**Function********************************************************************
 
   Synopsis     [private initializer]
@@ -372,6 +514,10 @@ static void bdd_fsm_cache_init(BddFsmCache_ptr self, DdManager* dd)
   self->deadlock_states       = BDD_STATES(NULL);
   self->legal_state_input   = BDD_STATES_INPUTS(NULL);
   self->monolithic_trans      = BDD_STATES_INPUTS(NULL);
+
+  self->rings = (BddFsmRings_ptr) NULL;
+  self->rings_budget = 0;
+  self->rings_nodes = 0;
 }
 
 
@@ -402,6 +548,8 @@ static void bdd_fsm_cache_deinit(BddFsmCache_ptr self)
   CACHE_UNREF_BDD(BddStatesInputs, legal_state_input);
   CACHE_UNREF_BDD(BddStatesInputs, monolithic_trans);
 
+  bdd_fsm_cache_fit_rings(self, 0);
+
   FREE(self->family_counter);
 }
 
@@ -438,3 +586,56 @@ static void bdd_fsm_cache_deinit_reachables(BddFsmCache_ptr self)
     bdd_free(self->dd, self->reachable.reachable_states);
   }
 }
+
+
+/**Function********************************************************************
+
+  Synopsis     [Drops least recently used onion rings]
+
+  Description  [Drops rings, least recently used first, until the
+  cached rings hold at most nodes BDD nodes]
+
+  SideEffects  []
+
+  SeeAlso      []
+
+******************************************************************************/
+static void bdd_fsm_cache_fit_rings(BddFsmCache_ptr self, long nodes)
+{
+  while (self->rings_nodes > nodes) {
+    BddFsmRings_ptr* last = &self->rings;
+    BddFsmRings_ptr rings;
+
+    while ((*last)->next != (BddFsmRings_ptr) NULL) last = &(*last)->next;
+
+    rings = *last;
+    *last = (BddFsmRings_ptr) NULL;
+    self->rings_nodes -= rings->nodes;
+    bdd_fsm_cache_free_rings(self, rings);
+  }
+}
+
+
+/**Function********************************************************************
+
+  Synopsis     [Frees the given onion rings]
+
+  Description  [The rings must not be linked in the cache anymore]
+
+  SideEffects  []
+
+  SeeAlso      []
+
+******************************************************************************/
+static void bdd_fsm_cache_free_rings(BddFsmCache_ptr self,
+                                     BddFsmRings_ptr rings)
+{
+  int i;
+
+  for (i = 0; i < rings->size; ++i) bdd_free(self->dd, rings->layers[i]);
+  FREE(rings->layers);
+
+  bdd_free(self->dd, rings->f);
+  if (rings->g != (bdd_ptr) NULL) bdd_free(self->dd, rings->g);
+  FREE(rings);
+}
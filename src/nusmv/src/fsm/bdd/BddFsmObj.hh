@@ -0,0 +1,190 @@
+/**CHeaderFile*****************************************************************
+
+  FileName    [BddFsmObj.hh]
+
+  PackageName [fsm.bdd]
+
+  Synopsis    [C++ adaptors of BddFsm and BddTrans over the CUDD C++
+               interface]
+
+  Description [BddFsmObj and BddTransObj wrap a BddFsm and a BddTrans
+               and return their sets of states and images as BDD
+               objects of cuddObj.hh. Results are adopted from NuSMV,
+               which already references them, so no extra reference
+               counting is done at the boundary.
+
+               The Cudd object given to the adaptors must wrap the DD
+               manager of the encoding of the FSM, e.g. built with
+               Cudd(BddEnc_get_dd_manager(enc)); it does not take
+               ownership of the manager.
+
+               The adaptors are header-only: NuSMV itself is compiled
+               as C, and C++ client code only needs to link against
+               libobj.]
+
+  SeeAlso     [BddFsm.h BddTrans.h]
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``fsm.bdd'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+
+#ifndef __FSM_BDD_BDD_FSM_OBJ_HH__
+#define __FSM_BDD_BDD_FSM_OBJ_HH__
+
+#include "cuddObj.hh"
+
+#include "fsm/bdd/BddFsm.h"
+#include "trans/bdd/BddTrans.h"
+#include "enc/bdd/BddEnc.h"
+
+
+/**Class***********************************************************************
+
+  Synopsis     [C++ view of a BddTrans]
+
+  Description  [Images are computed on current state variables: pre
+  renames its argument to next state variables before the backward
+  image, post renames the forward image back to current state
+  variables.]
+
+  SeeAlso      [BddFsmObj]
+
+******************************************************************************/
+class BddTransObj {
+    BddTrans_ptr trans;
+    BddEnc_ptr enc;
+    Cudd *mgr;
+public:
+    BddTransObj(BddTrans_ptr trans, BddEnc_ptr enc, Cudd *mgr)
+      : trans(trans), enc(enc), mgr(mgr)
+    {
+	nusmv_assert(mgr->getManager() == BddEnc_get_dd_manager(enc));
+    }
+
+    BddTrans_ptr get() const { return trans; }
+
+    BDD pre(const BDD& states) const
+    {
+	bdd_ptr next = BddEnc_state_var_to_next_state_var(enc,
+							  states.getNode());
+	bdd_ptr res = BddTrans_get_backward_image_state(trans, next);
+	bdd_free(mgr->getManager(), next);
+	return BDD::adopt(mgr, res);
+    }
+
+    BDD post(const BDD& states) const
+    {
+	bdd_ptr next = BddTrans_get_forward_image_state(trans,
+							states.getNode());
+	bdd_ptr res = BddEnc_next_state_var_to_state_var(enc, next);
+	bdd_free(mgr->getManager(), next);
+	return BDD::adopt(mgr, res);
+    }
+
+}; // BddTransObj
+
+
+/**Class***********************************************************************
+
+  Synopsis     [C++ view of a BddFsm]
+
+  Description  [All the returned BDDs are adopted from the FSM, see
+  BDD::adopt.]
+
+  SeeAlso      [BddTransObj]
+
+******************************************************************************/
+class BddFsmObj {
+    BddFsm_ptr fsm;
+    Cudd *mgr;
+public:
+    BddFsmObj(BddFsm_ptr fsm, Cudd *mgr) : fsm(fsm), mgr(mgr)
+    {
+	nusmv_assert(mgr->getManager() ==
+		     BddEnc_get_dd_manager(BddFsm_get_bdd_encoding(fsm)));
+    }
+
+    BddFsm_ptr get() const { return fsm; }
+
+    BddTransObj trans() const
+    {
+	return BddTransObj(BddFsm_get_trans(fsm),
+			   BddFsm_get_bdd_encoding(fsm), mgr);
+    }
+
+    BDD init() const { return BDD::adopt(mgr, BddFsm_get_init(fsm)); }
+
+    BDD invars() const
+    {
+	return BDD::adopt(mgr, BddFsm_get_state_constraints(fsm));
+    }
+
+    BDD reachable() const
+    {
+	return BDD::adopt(mgr, BddFsm_get_reachable_states(fsm));
+    }
+
+    BDD fair() const
+    {
+	return BDD::adopt(mgr, BddFsm_get_fair_states(fsm));
+    }
+
+    BDD pre(const BDD& states) const
+    {
+	return BDD::adopt(mgr, BddFsm_get_backward_image(fsm,
+							  states.getNode()));
+    }
+
+    BDD pre(const BDD& states, const BDD& inputs) const
+    {
+	return BDD::adopt(mgr,
+			  BddFsm_get_constrained_backward_image(
+			    fsm, states.getNode(), inputs.getNode()));
+    }
+
+    BDD weakPre(const BDD& states) const
+    {
+	return BDD::adopt(mgr, BddFsm_get_weak_backward_image(
+				 fsm, states.getNode()));
+    }
+
+    BDD post(const BDD& states) const
+    {
+	return BDD::adopt(mgr, BddFsm_get_forward_image(fsm,
+							 states.getNode()));
+    }
+
+    BDD post(const BDD& states, const BDD& inputs) const
+    {
+	return BDD::adopt(mgr,
+			  BddFsm_get_constrained_forward_image(
+			    fsm, states.getNode(), inputs.getNode()));
+    }
+
+}; // BddFsmObj
+
+#endif /* __FSM_BDD_BDD_FSM_OBJ_HH__ */
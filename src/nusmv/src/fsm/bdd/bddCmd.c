@@ -292,6 +292,11 @@ static int UsageCheckFsm()
   image and preimage computations. This can result in improved
   performances for models with sparse state spaces.
   <p>
+  When the variable <tt>guided_reachability_threshold</tt> is set and
+  no bound is given, the fixpoint is computed with guided reachability:
+  frontiers larger than the threshold are subsetted, and only the final
+  set of states is kept (the diameter is not available).
+  <p>
   Command Options:<p>
   <dl>
     <dt> <tt>-k number</tt>
@@ -308,7 +313,7 @@ static int UsageCheckFsm()
 int CommandComputeReachable(int argc, char **argv)
 {
   int c, k, t, diameter;
-  boolean used_k, used_t, completed;
+  boolean used_k, used_t, completed, reached;
   BddFsm_ptr fsm;
   BddStates* layers;
 
@@ -379,7 +384,7 @@ int CommandComputeReachable(int argc, char **argv)
   }
 
   /* Expand the cached reachable states */
-  BddFsm_expand_cached_reachable_states(fsm, k, t);
+  reached = BddFsm_expand_cached_reachable_states(fsm, k, t);
 
   completed = BddFsm_get_cached_reachable_states(fsm, &layers, &diameter);
 
@@ -390,6 +395,14 @@ int CommandComputeReachable(int argc, char **argv)
             "The diameter of the FSM is %d.\n",
             diameter);
   }
+  else if (reached) {
+    /* guided reachability does not compute the onion rings */
+    fprintf(nusmv_stderr,
+            "The computation of reachable states has been completed.\n");
+    fprintf(nusmv_stderr,
+            "The diameter of the FSM is not available "
+            "(guided reachability).\n");
+  }
   else {
     fprintf(nusmv_stderr,
             "The computation of reachable states has not been completed yet.\n");
@@ -49,6 +49,21 @@ EXTERN FILE* nusmv_stderr;
 EXTERN FILE* nusmv_stdout;
 
 
+/* onion rings of a fixpoint, as stored in the cache of the bdd fsm */
+typedef struct BddFsmRings_TAG
+{
+  BddFsmRingsKind kind;
+  bdd_ptr f;         /* the arguments of the fixpoint, g may be NULL */
+  bdd_ptr g;
+  BddStates* layers; /* array of bdds */
+  int size;
+  long nodes;        /* number of BDD nodes held by layers */
+  struct BddFsmRings_TAG* next;
+} BddFsmRings;
+
+typedef struct BddFsmRings_TAG* BddFsmRings_ptr;
+
+
 /* members are public from within the bdd fsm */
 typedef struct BddFsmCache_TAG 
 {
@@ -82,6 +97,12 @@ typedef struct BddFsmCache_TAG
   BddStatesInputs legal_state_input; 
   BddStatesInputs monolithic_trans;
 
+  /* onion rings of fixpoints, most recently used first. They are kept
+     only while they fit in rings_budget BDD nodes */
+  BddFsmRings_ptr rings;
+  long rings_budget;
+  long rings_nodes;
+
 } BddFsmCache;
 
 
@@ -133,6 +154,21 @@ EXTERN void BddFsmCache_set_reachables ARGS((BddFsmCache_ptr self,
                                              const int  diameter,
                                              boolean completed));
 
+EXTERN void BddFsmCache_set_rings_budget ARGS((BddFsmCache_ptr self,
+                                               long budget));
+
+EXTERN void BddFsmCache_set_rings ARGS((BddFsmCache_ptr self,
+                                        BddFsmRingsKind kind,
+                                        bdd_ptr f, bdd_ptr g,
+                                        node_ptr layers_list,
+                                        const int size));
+
+EXTERN boolean BddFsmCache_get_rings ARGS((BddFsmCache_ptr self,
+                                           BddFsmRingsKind kind,
+                                           bdd_ptr f, bdd_ptr g,
+                                           BddStates** layers,
+                                           int* size));
+
 EXTERN void 
 BddFsmCache_reset_not_reusable_fields_after_product
 ARGS((BddFsmCache_ptr self));
@@ -48,6 +48,20 @@
 #include "trace/Trace.h"
 #include "opt/opt.h"
 
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/* maximum number of fixpoint variables of mu-calculus formulas */
+#define MC_MU_MAX_VARS 64
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+typedef struct MuContext_TAG* MuContext_ptr;
+typedef struct MuFormula_TAG* MuFormula_ptr;
+
 /*---------------------------------------------------------------------------*/
 /* Function prototypes                                                       */
 /*---------------------------------------------------------------------------*/
@@ -107,6 +121,40 @@ Mc_trace_step_put_input_from_bdd ARGS((Trace_ptr trace, TraceIter step,
                                        BddEnc_ptr bdd_enc, bdd_ptr bdd));
 
 
+/* mcMu.c */
+EXTERN MuContext_ptr Mc_mu_context_create ARGS((BddFsm_ptr fsm));
+EXTERN void Mc_mu_context_destroy ARGS((MuContext_ptr self));
+EXTERN long Mc_mu_get_evaluations ARGS((MuContext_ptr self));
+EXTERN long Mc_mu_get_cache_hits ARGS((MuContext_ptr self));
+
+EXTERN MuFormula_ptr Mc_mu_const ARGS((MuContext_ptr ctx, bdd_ptr f));
+EXTERN MuFormula_ptr Mc_mu_var ARGS((MuContext_ptr ctx, int var));
+EXTERN MuFormula_ptr Mc_mu_not ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+EXTERN MuFormula_ptr
+Mc_mu_and ARGS((MuContext_ptr ctx, MuFormula_ptr f, MuFormula_ptr g));
+EXTERN MuFormula_ptr
+Mc_mu_or ARGS((MuContext_ptr ctx, MuFormula_ptr f, MuFormula_ptr g));
+EXTERN MuFormula_ptr Mc_mu_pre ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+EXTERN MuFormula_ptr Mc_mu_weak_pre ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+EXTERN MuFormula_ptr Mc_mu_post ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+EXTERN MuFormula_ptr
+Mc_mu_forsome ARGS((MuContext_ptr ctx, MuFormula_ptr f, bdd_ptr cube));
+EXTERN MuFormula_ptr
+Mc_mu_forall ARGS((MuContext_ptr ctx, MuFormula_ptr f, bdd_ptr cube));
+EXTERN MuFormula_ptr
+Mc_mu_pre_strat ARGS((MuContext_ptr ctx, MuFormula_ptr f,
+                      bdd_ptr gamma_cube, bdd_ptr strat));
+EXTERN MuFormula_ptr
+Mc_mu_pre_trans ARGS((MuContext_ptr ctx, MuFormula_ptr f,
+                      BddTrans_ptr trans));
+EXTERN MuFormula_ptr
+Mc_mu_lfp ARGS((MuContext_ptr ctx, int var, MuFormula_ptr body));
+EXTERN MuFormula_ptr
+Mc_mu_gfp ARGS((MuContext_ptr ctx, int var, MuFormula_ptr body));
+EXTERN bdd_ptr Mc_mu_eval ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+EXTERN boolean Mc_mu_is_closed ARGS((MuFormula_ptr f));
+
+
 EXTERN void print_spec  ARGS((FILE *file, Prop_ptr prop));
 EXTERN void print_invar ARGS((FILE *file, Prop_ptr n));
 EXTERN void print_compute ARGS((FILE *, Prop_ptr));
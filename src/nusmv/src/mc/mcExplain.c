@@ -104,6 +104,10 @@ mc_eu_explain_restrict_state_input_to_minterms ARGS((BddFsm_ptr fsm,
                                                      node_ptr path,
                                                      node_ptr initial_node));
 
+static node_ptr
+mc_eu_explain_walk_rings ARGS((BddFsm_ptr fsm, BddEnc_ptr enc,
+                               node_ptr path, BddStates* layers, int size));
+
 static void
 mc_explain_debug_check_not_empty_state ARGS((BddFsm_ptr fsm,
                                              BddEnc_ptr enc,
@@ -294,11 +298,15 @@ node_ptr eu_si_explain(BddFsm_ptr fsm, BddEnc_ptr enc,
    to minterm.
 
    If a witness is not found then Nil is return and nothing is modified.
+
+   If the onion rings of <i>E\[f U g\]</i> have been cached in fsm by
+   eu, the path is built by walking them backward from the first
+   state, without any search.
    ]
 
    SideEffects        []
 
-   SeeAlso            [explain]
+   SeeAlso            [explain eu]
 
 *****************************************************************************/
 node_ptr eu_explain(BddFsm_ptr fsm, BddEnc_ptr enc,
@@ -308,6 +316,20 @@ node_ptr eu_explain(BddFsm_ptr fsm, BddEnc_ptr enc,
 
   bdd_ptr tmp;
 
+  {
+    BddStates* layers;
+    int size;
+
+    if (BddFsm_get_cached_rings(fsm, BDD_FSM_RINGS_EU, f, g,
+                                &layers, &size)) {
+      node_ptr witness_path = mc_eu_explain_walk_rings(fsm, enc, path,
+                                                       layers, size);
+      if (witness_path != Nil) return witness_path;
+      /* the first state is not in the rings (they may have been
+         computed with other options): search for a path */
+    }
+  }
+
   /* Frontier.At the beginning it is just the initial states provided */
   bdd_ptr new = bdd_dup((bdd_ptr) car(path));
 
@@ -482,11 +504,26 @@ node_ptr eg_explain(BddFsm_ptr fsm, BddEnc_ptr enc,
   /* Duplicate arg_g */
   g = bdd_dup(arg_g);
 
-  /* Compute eg_si_g, i.e. the set of fair state inputs wrt g. */
-  eg_si_g = eg_si(fsm, g);
+  {
+    BddStates* layers;
+    int size;
+
+    if (BddFsm_get_cached_rings(fsm, BDD_FSM_RINGS_EG, g, (bdd_ptr) NULL,
+                                &layers, &size)) {
+      /* eg already computed the fair state inputs wrt g: they are the
+         same as eg_si(fsm, g), since any state input with a fair path
+         is a fair state input */
+      eg_si_g = bdd_dup(layers[0]);
+      eg_g = BddFsm_states_inputs_to_states(fsm, eg_si_g);
+    }
+    else {
+      /* Compute eg_si_g, i.e. the set of fair state inputs wrt g. */
+      eg_si_g = eg_si(fsm, g);
 
-  /* Compute eg_g, i.e. the subset of g which contains fair cycle. */
-  eg_g = eg(fsm, g);
+      /* Compute eg_g, i.e. the subset of g which contains fair cycle. */
+      eg_g = eg(fsm, g);
+    }
+  }
 
   /*
     If first state in the path is not in eg_g (that is, not a chance
@@ -1772,6 +1809,69 @@ mc_eu_explain_restrict_state_input_to_minterms(BddFsm_ptr fsm,
   } /* while iter != initial_node */
 }
 
+/**Function*******************************************************************
+
+   Synopsis           [Builds a witness for <i>E\[f U g\]</i> from its
+   onion rings]
+
+   Description        [layers\[i\] contains the states from which g can
+   be reached in i steps through f, as cached by eu. The first state of
+   path is restricted to a minterm of the lowest layer it intersects,
+   then a successor is chosen in each lower layer down to layers\[0\].
+
+   Returns the extended path, reversed as in eu_explain, or Nil if the
+   first element of path does not intersect any layer; path is then
+   left untouched.]
+
+   SideEffects        []
+
+   SeeAlso            [eu_explain eu]
+
+*****************************************************************************/
+static node_ptr
+mc_eu_explain_walk_rings(BddFsm_ptr fsm, BddEnc_ptr enc, node_ptr path,
+                         BddStates* layers, int size)
+{
+  node_ptr witness_path = path;
+  bdd_ptr tmp = (bdd_ptr) NULL;
+  int i;
+
+  for (i = 0; i < size; ++i) {
+    tmp = bdd_and(dd_manager, (bdd_ptr) car(path), layers[i]);
+    if (bdd_isnot_false(dd_manager, tmp)) break;
+    bdd_free(dd_manager, tmp);
+  }
+  if (i == size) return Nil;
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+    fprintf(nusmv_stderr, "eu_explain: walking %d onion rings\n", i);
+  }
+
+  bdd_free(dd_manager, (bdd_ptr) car(path));
+  node_bdd_setcar(path, NODE_PTR(BddEnc_pick_one_state(enc, tmp)));
+  bdd_free(dd_manager, tmp);
+
+  while (i > 0) {
+    bdd_ptr next;
+
+    i--;
+    next = BddFsm_get_forward_image(fsm, (bdd_ptr) car(witness_path));
+    bdd_and_accumulate(dd_manager, &next, layers[i]);
+    /* by construction of the rings, states of layers[i+1] have
+       successors in layers[i] */
+    nusmv_assert(bdd_isnot_false(dd_manager, next));
+
+    witness_path =
+      Extend_trace_with_state_input_pair(fsm, enc, witness_path,
+                                         (bdd_ptr) car(witness_path),
+                                         next, "eu_explain: (rings).");
+    bdd_free(dd_manager, next);
+  }
+
+  return witness_path;
+}
+
+
 /**Macro**********************************************************************
 
   Synopsis     [Debugging code for eu_explain]
@@ -112,6 +112,12 @@ static int check_invariant ARGS((BddFsm_ptr fsm,
                                  NodeList_ptr symbols,
                                  Trace_ptr* trace));
 
+static boolean check_invariant_guided ARGS((BddFsm_ptr fsm,
+                                            Prop_ptr inv_prop,
+                                            int threshold,
+                                            NodeList_ptr symbols,
+                                            Trace_ptr* trace));
+
 static Step_Direction forward_heuristic ARGS((DdManager* dd,
                                               bdd_ptr reachable_frontier,
                                               bdd_ptr bad_frontier,
@@ -1668,7 +1674,11 @@ static void mc_rewrite_cleanup(Prop_ptr rewritten_prop,
    null, then a trace is stored (and must be released by caller) in
    trace parameter location.
 
-   The result of model checking is stored in the given property.]
+   The result of model checking is stored in the given property.
+
+   When guided_reachability_threshold is set, a guided forward search
+   is tried first (see check_invariant_guided), and the given strategy
+   is used only if it does not decide the property.]
 
    SideEffects        []
 
@@ -1680,6 +1690,13 @@ static int check_invariant(BddFsm_ptr fsm,
                            Check_Strategy strategy,
                            NodeList_ptr symbols,
                            Trace_ptr* trace) {
+  int threshold =
+    get_guided_reachability_threshold(OptsHandler_get_instance());
+
+  if (threshold > 0 &&
+      check_invariant_guided(fsm, inv_prop, threshold, symbols, trace)) {
+    return (Prop_True == Prop_get_status(inv_prop)) ? 1 : 0;
+  }
 
   switch (strategy) {
   case FORWARD:
@@ -1714,6 +1731,140 @@ static int check_invariant(BddFsm_ptr fsm,
 }
 
 
+/**Function********************************************************************
+
+   Synopsis           [Guided forward search for invariant violations]
+
+   Description [Forward search in which every frontier larger than
+   threshold BDD nodes is replaced by a dense subset of it before its
+   image is computed, so that deep violations are reached even when
+   exact frontiers blow up. Each frontier is checked against the bad
+   states before being subsetted, and a subsetted frontier is always
+   contained in the image of the previous one, so the list of explored
+   frontiers yields a valid counterexample.
+
+   Returns true if the property has been decided: it is false if a bad
+   state has been found, true if the search reached its fixpoint
+   without ever subsetting a frontier. Returns false otherwise: the
+   property must then be checked exactly. Nothing is done (false is
+   returned) when onion rings are already cached, since the exact
+   check resumes from them.]
+
+   SideEffects        []
+
+   SeeAlso            [check_invariant_forward_backward_with_break]
+
+******************************************************************************/
+static boolean check_invariant_guided(BddFsm_ptr fsm,
+                                      Prop_ptr inv_prop,
+                                      int threshold,
+                                      NodeList_ptr symbols,
+                                      Trace_ptr* trace)
+{
+  BddEnc_ptr enc = BddFsm_get_bdd_encoding(fsm);
+  DdManager* dd = BddEnc_get_dd_manager(enc);
+  bdd_ptr invar_bdd, bad_states, reachable, frontier, target, tmp;
+  node_ptr frontiers;
+  boolean approximated, decided;
+  BddStates* layers;
+  int diameter, step;
+
+  (void) BddFsm_get_cached_reachable_states(fsm, &layers, &diameter);
+  if (diameter > 0) return false;
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+    fprintf(nusmv_stderr,
+            "Guided forward search (frontier threshold = %d)\n", threshold);
+  }
+
+  invar_bdd = BddFsm_get_state_constraints(fsm);
+
+  /* bad states are the ones violating the property within the invars */
+  tmp = BddEnc_expr_to_bdd(enc, Prop_get_expr_core(inv_prop), Nil);
+  bad_states = bdd_not(dd, tmp);
+  bdd_free(dd, tmp);
+  bdd_and_accumulate(dd, &bad_states, invar_bdd);
+
+  reachable = BddFsm_get_init(fsm);
+  bdd_and_accumulate(dd, &reachable, invar_bdd);
+  bdd_free(dd, invar_bdd);
+
+  frontier = bdd_dup(reachable);
+  frontiers = cons((node_ptr) bdd_dup(frontier), Nil);
+  target = bdd_and(dd, frontier, bad_states);
+  approximated = false;
+  step = 0;
+
+  while (bdd_isnot_false(dd, frontier) && bdd_is_false(dd, target)) {
+    bdd_ptr img, not_reachable;
+
+    if (bdd_size(dd, frontier) > threshold) {
+      bdd_ptr dense = bdd_subset_heavy_branch(dd, frontier, threshold);
+
+      /* the dense subset replaces the frontier in the explored list */
+      bdd_free(dd, frontier);
+      bdd_free(dd, (bdd_ptr) car(frontiers));
+      setcar(frontiers, (node_ptr) bdd_dup(dense));
+      frontier = dense;
+      approximated = true;
+    }
+
+    if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+      fprintf(nusmv_stderr, "  guided step %d: frontier size = %d\n",
+              step, bdd_size(dd, frontier));
+    }
+
+    img = BddFsm_get_forward_image(fsm, BDD_STATES(frontier));
+    bdd_free(dd, frontier);
+
+    not_reachable = bdd_not(dd, reachable);
+    frontier = bdd_and(dd, img, not_reachable);
+    bdd_free(dd, not_reachable);
+    bdd_free(dd, img);
+
+    bdd_or_accumulate(dd, &reachable, frontier);
+    frontiers = cons((node_ptr) bdd_dup(frontier), frontiers);
+
+    bdd_free(dd, target);
+    target = bdd_and(dd, frontier, bad_states);
+    ++step;
+  }
+
+  if (bdd_isnot_false(dd, target)) {
+    if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+      fprintf(nusmv_stderr, "Guided search found a bug at depth %d\n", step);
+    }
+
+    if (opt_counter_examples(OptsHandler_get_instance())) {
+      *trace = compute_path_fb(fsm, target, frontiers, Nil, symbols);
+    }
+    Prop_set_status(inv_prop, Prop_False);
+    decided = true;
+  }
+  else if (!approximated) {
+    /* no state has ever been dropped: the search was exact */
+    Prop_set_status(inv_prop, Prop_True);
+    decided = true;
+  }
+  else {
+    if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
+      fprintf(nusmv_stderr,
+              "Guided search found no bug, falling back to exact search\n");
+    }
+    decided = false;
+  }
+
+  walk_dd(dd, bdd_free, frontiers);
+  free_list(frontiers);
+  bdd_free(dd, target);
+  bdd_free(dd, frontier);
+  bdd_free(dd, reachable);
+  bdd_free(dd, bad_states);
+
+  return decided;
+}
+
+
 /**Function********************************************************************
 
    Synopsis           [Constant function to perform forward analysis]
@@ -313,11 +313,13 @@ BddStates ex(BddFsm_ptr fsm, BddStates g)
 
   Synopsis           [Set of states satisfying <i>E\[ f U g \]</i>.]
 
-  Description        [Computes the set of states satisfying <i>E\[ f U g \]</i>.]
+  Description        [Computes the set of states satisfying <i>E\[ f U g \]</i>.
+  If the FSM has a budget for onion rings, the frontiers of the
+  fixpoint are cached in the FSM, for eu_explain to use them.]
 
-  SideEffects        []
+  SideEffects        [The onion rings cache of fsm could change]
 
-  SeeAlso            [ebu]
+  SeeAlso            [ebu eu_explain BddFsm_set_rings_budget]
 
 ******************************************************************************/
 BddStates eu(BddFsm_ptr fsm, BddStates f, BddStates g)
@@ -327,6 +329,9 @@ BddStates eu(BddFsm_ptr fsm, BddStates f, BddStates g)
   bdd_ptr new, oldY;
   bdd_ptr Y = bdd_dup(g);
   int n = 1;
+  boolean keep_rings = (BddFsm_get_rings_budget(fsm) > 0);
+  node_ptr rings = Nil;
+  int rings_size = 0;
 
   /* The following simplification may be useful for efficiency since g
      may be unreachable (but they are not fundamental for correctness
@@ -355,6 +360,11 @@ BddStates eu(BddFsm_ptr fsm, BddStates f, BddStates g)
   while(bdd_isnot_false(dd, new)) {
     bdd_ptr tmp_1, tmp_2;
 
+    if (keep_rings) {
+      rings = cons((node_ptr) bdd_dup(new), rings);
+      rings_size++;
+    }
+
     if (opt_verbose_level_gt(OptsHandler_get_instance(), 1)) {
       double states = BddEnc_count_states_of_bdd(enc, Y);
       int size = bdd_size(dd, Y);
@@ -385,6 +395,11 @@ BddStates eu(BddFsm_ptr fsm, BddStates f, BddStates g)
   bdd_free(dd, new);
   bdd_free(dd, oldY);
 
+  if (keep_rings) {
+    BddFsm_update_cached_rings(fsm, BDD_FSM_RINGS_EU, f, g, rings,
+                               rings_size);
+  }
+
   return(Y);
 }
 
@@ -393,11 +408,13 @@ BddStates eu(BddFsm_ptr fsm, BddStates f, BddStates g)
 
   Synopsis           [Set of states satisfying <i>EF(g)</i>.]
 
-  Description        [Computes the set of states satisfying <i>EG(g)</i>.]
+  Description        [Computes the set of states satisfying <i>EG(g)</i>.
+  If the FSM has a budget for onion rings, the fair states-inputs of
+  <i>EG(g)</i> are cached in the FSM, for eg_explain to use them.]
 
-  SideEffects        []
+  SideEffects        [The onion rings cache of fsm could change]
 
-  SeeAlso            [eu ex]
+  SeeAlso            [eu ex eg_explain]
 
 ******************************************************************************/
 BddStates eg(BddFsm_ptr fsm, BddStates g)
@@ -418,6 +435,11 @@ BddStates eg(BddFsm_ptr fsm, BddStates g)
 
   res = BddFsm_states_inputs_to_states(fsm, res_si);
 
+  if (BddFsm_get_rings_budget(fsm) > 0) {
+    BddFsm_update_cached_rings(fsm, BDD_FSM_RINGS_EG, g, (bdd_ptr) NULL,
+                               cons((node_ptr) bdd_dup(res_si), Nil), 1);
+  }
+
   bdd_free(dd, res_si);
   bdd_free(dd, fair_transitions_g);
   bdd_free(dd, fair_transitions);
@@ -0,0 +1,1017 @@
+/**CFile***********************************************************************
+
+  FileName    [mcMu.c]
+
+  PackageName [mc]
+
+  Synopsis    [Mu-calculus evaluation]
+
+  Description [Evaluates mu-calculus formulas over a BDD FSM: boolean
+  connectives, pre and post images, quantification, strategy pre-images
+  of multi-agent systems, pre-images through arbitrary transition
+  relations, and least and greatest fixpoints.
+
+  Formulas are built inside a context, which owns them and caches the
+  value of every subterm. A cached value is reused as long as none of
+  the fixpoint variables occurring free in the subterm changed, so that
+  closed subterms are evaluated once, whatever the number of fixpoint
+  iterations.]
+
+  SeeAlso     [mcEval.c]
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``mc'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+
+#include "mc.h"
+#include "mcInt.h"
+
+#include "utils/error.h"
+#include "enc/enc.h"
+#include "st.h"
+
+static char rcsid[] UTIL_UNUSED = "$Id: mcMu.c,v 1.1 2013-06-10 10:00:00 nusmv Exp $";
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+typedef enum MuOp_TAG {
+  MU_CONST,
+  MU_VAR,
+  MU_NOT,
+  MU_AND,
+  MU_OR,
+  MU_PRE,
+  MU_WEAK_PRE,
+  MU_POST,
+  MU_FORSOME,
+  MU_FORALL,
+  MU_PRE_STRAT,
+  MU_PRE_TRANS,
+  MU_LFP,
+  MU_GFP
+} MuOp;
+
+
+/*---------------------------------------------------------------------------*/
+/* Structure declarations                                                    */
+/*---------------------------------------------------------------------------*/
+
+/**Struct**********************************************************************
+
+  Synopsis    [A mu-calculus formula]
+
+  Description [bdd is the constant of MU_CONST, the cube of MU_FORSOME
+  and MU_FORALL, and the cube of the inputs of the opponents of
+  MU_PRE_STRAT, whose strat is the allowed state-inputs pairs. deps is
+  the set of fixpoint variables occurring free in the formula. Formulas
+  are hash-consed by their context: building the same formula twice
+  returns the same one, with its cached value.]
+
+******************************************************************************/
+typedef struct MuFormula_TAG {
+  MuOp op;
+  MuFormula_ptr left;
+  MuFormula_ptr right;
+  bdd_ptr bdd;
+  bdd_ptr strat;
+  BddTrans_ptr trans;
+  int var;
+
+  unsigned long deps;
+  bdd_ptr cache;
+  unsigned long cached_at;
+
+  struct MuFormula_TAG* next; /* formulas of the same context */
+} MuFormula;
+
+/**Struct**********************************************************************
+
+  Synopsis    [A mu-calculus evaluation context]
+
+  Description [values are the current values of the fixpoint variables,
+  changed_at the clock at which they were last changed.]
+
+******************************************************************************/
+typedef struct MuContext_TAG {
+  BddFsm_ptr fsm;
+  BddEnc_ptr enc;
+  DdManager* dd;
+
+  MuFormula_ptr formulas;
+  st_table* unique;
+
+  bdd_ptr values[MC_MU_MAX_VARS];
+  unsigned long changed_at[MC_MU_MAX_VARS];
+  unsigned long clock;
+
+  long evaluations;
+  long cache_hits;
+} MuContext;
+
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+#define MU_VAR_BIT(v) (1UL << (v))
+
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static MuFormula_ptr mc_mu_new ARGS((MuContext_ptr ctx, MuOp op,
+                                     MuFormula_ptr left,
+                                     MuFormula_ptr right));
+
+static MuFormula_ptr mc_mu_fixpoint ARGS((MuContext_ptr ctx, MuOp op,
+                                          int var, MuFormula_ptr body));
+
+static void mc_mu_key ARGS((MuFormula_ptr key, MuOp op,
+                            MuFormula_ptr left, MuFormula_ptr right));
+
+static MuFormula_ptr mc_mu_find_or_add ARGS((MuContext_ptr ctx,
+                                             MuFormula_ptr key));
+
+static int mc_mu_formula_compare ARGS((const char* f1, const char* f2));
+
+static int mc_mu_formula_hash ARGS((char* f, int modulus));
+
+static boolean mc_mu_is_cached ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+
+static bdd_ptr mc_mu_eval ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+
+static bdd_ptr mc_mu_eval_fixpoint ARGS((MuContext_ptr ctx, MuFormula_ptr f));
+
+static bdd_ptr mc_mu_pre_strat ARGS((MuContext_ptr ctx, MuFormula_ptr f,
+                                     bdd_ptr states));
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of exported functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Creates a mu-calculus evaluation context for fsm]
+
+  Description [The context owns the formulas built with it and their
+  cached values; it must be destroyed with Mc_mu_context_destroy.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_context_destroy Mc_mu_eval]
+
+******************************************************************************/
+MuContext_ptr Mc_mu_context_create(BddFsm_ptr fsm)
+{
+  MuContext_ptr self = ALLOC(MuContext, 1);
+  int i;
+
+  BDD_FSM_CHECK_INSTANCE(fsm);
+  nusmv_assert(self != (MuContext_ptr) NULL);
+
+  self->fsm = fsm;
+  self->enc = BddFsm_get_bdd_encoding(fsm);
+  self->dd = BddEnc_get_dd_manager(self->enc);
+  self->formulas = (MuFormula_ptr) NULL;
+  self->unique = st_init_table(mc_mu_formula_compare, mc_mu_formula_hash);
+
+  for (i = 0; i < MC_MU_MAX_VARS; i++) {
+    self->values[i] = (bdd_ptr) NULL;
+    self->changed_at[i] = 0;
+  }
+  self->clock = 0;
+  self->evaluations = 0;
+  self->cache_hits = 0;
+
+  return self;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Destroys a mu-calculus evaluation context]
+
+  Description [Frees all the formulas of the context and their cached
+  values.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_context_create]
+
+******************************************************************************/
+void Mc_mu_context_destroy(MuContext_ptr self)
+{
+  int i;
+
+  while (self->formulas != (MuFormula_ptr) NULL) {
+    MuFormula_ptr f = self->formulas;
+
+    self->formulas = f->next;
+    if (f->bdd != (bdd_ptr) NULL) bdd_free(self->dd, f->bdd);
+    if (f->strat != (bdd_ptr) NULL) bdd_free(self->dd, f->strat);
+    if (f->cache != (bdd_ptr) NULL) bdd_free(self->dd, f->cache);
+    FREE(f);
+  }
+
+  for (i = 0; i < MC_MU_MAX_VARS; i++) {
+    if (self->values[i] != (bdd_ptr) NULL) bdd_free(self->dd, self->values[i]);
+  }
+
+  st_free_table(self->unique);
+  FREE(self);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of subterms evaluated by self]
+
+  Description [Subterms whose cached value is reused are not counted.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_get_cache_hits]
+
+******************************************************************************/
+long Mc_mu_get_evaluations(MuContext_ptr self)
+{
+  return self->evaluations;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the number of subterm values reused by self]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_get_evaluations]
+
+******************************************************************************/
+long Mc_mu_get_cache_hits(MuContext_ptr self)
+{
+  return self->cache_hits;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The formula whose value is the given BDD]
+
+  Description [f is duplicated, unless the formula already exists.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_const(MuContext_ptr ctx, bdd_ptr f)
+{
+  MuFormula key;
+
+  mc_mu_key(&key, MU_CONST, NULL, NULL);
+  key.bdd = f;
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The fixpoint variable of index var]
+
+  Description [var must be in 0 .. MC_MU_MAX_VARS - 1, and be bound by an
+  enclosing Mc_mu_lfp or Mc_mu_gfp when evaluated.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_lfp Mc_mu_gfp]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_var(MuContext_ptr ctx, int var)
+{
+  MuFormula key;
+
+  nusmv_assert(0 <= var && var < MC_MU_MAX_VARS);
+  mc_mu_key(&key, MU_VAR, NULL, NULL);
+  key.var = var;
+  key.deps = MU_VAR_BIT(var);
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The negation of f]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_not(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  return mc_mu_new(ctx, MU_NOT, f, NULL);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The conjunction of f and g]
+
+  Description [g is not evaluated if f is false.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_and(MuContext_ptr ctx, MuFormula_ptr f, MuFormula_ptr g)
+{
+  return mc_mu_new(ctx, MU_AND, f, g);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The disjunction of f and g]
+
+  Description [g is not evaluated if f is true.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_or(MuContext_ptr ctx, MuFormula_ptr f, MuFormula_ptr g)
+{
+  return mc_mu_new(ctx, MU_OR, f, g);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The pre-image of f]
+
+  Description [Computed with BddFsm_get_backward_image.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_weak_pre Mc_mu_post]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_pre(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  return mc_mu_new(ctx, MU_PRE, f, NULL);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The weak pre-image of f]
+
+  Description [The state-inputs pairs leading to f, computed with
+  BddFsm_get_weak_backward_image.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_pre]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_weak_pre(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  return mc_mu_new(ctx, MU_WEAK_PRE, f, NULL);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The post-image of f]
+
+  Description [Computed with BddFsm_get_forward_image.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_pre]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_post(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  return mc_mu_new(ctx, MU_POST, f, NULL);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The existential abstraction of the variables of cube in f]
+
+  Description [cube is duplicated, unless the formula already exists.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_forall]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_forsome(MuContext_ptr ctx, MuFormula_ptr f, bdd_ptr cube)
+{
+  MuFormula key;
+
+  mc_mu_key(&key, MU_FORSOME, f, NULL);
+  key.bdd = cube;
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The universal abstraction of the variables of cube in f]
+
+  Description [cube is duplicated, unless the formula already exists.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_forsome]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_forall(MuContext_ptr ctx, MuFormula_ptr f, bdd_ptr cube)
+{
+  MuFormula key;
+
+  mc_mu_key(&key, MU_FORALL, f, NULL);
+  key.bdd = cube;
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The strategy pre-image of f]
+
+  Description [The states s for which there exist values of the inputs
+  of gamma_cube such that, for all values of the other inputs, all
+  successors of s through these inputs are in f. If strat is not NULL,
+  the values of the inputs are restricted to the state-inputs pairs of
+  strat. Inputs of f are abstracted away. This is the pre_strat
+  operation of multi-agent systems.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_pre_strat(MuContext_ptr ctx, MuFormula_ptr f,
+                              bdd_ptr gamma_cube, bdd_ptr strat)
+{
+  MuFormula key;
+  MuFormula_ptr res;
+  bdd_ptr inputs_cube = BddEnc_get_input_vars_cube(ctx->enc);
+
+  mc_mu_key(&key, MU_PRE_STRAT, f, NULL);
+  key.bdd = bdd_cube_diff(ctx->dd, inputs_cube, gamma_cube);
+  bdd_free(ctx->dd, inputs_cube);
+
+  key.strat = BddEnc_get_state_frozen_input_vars_mask_bdd(ctx->enc);
+  if (strat != (bdd_ptr) NULL) bdd_and_accumulate(ctx->dd, &key.strat, strat);
+
+  res = mc_mu_find_or_add(ctx, &key);
+  bdd_free(ctx->dd, key.strat);
+  bdd_free(ctx->dd, key.bdd);
+  return res;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The pre-image of f through trans]
+
+  Description [Computed with BddTrans_get_backward_image_state on the
+  next-state version of f. trans is not copied and must outlive the
+  context.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_pre]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_pre_trans(MuContext_ptr ctx, MuFormula_ptr f,
+                              BddTrans_ptr trans)
+{
+  MuFormula key;
+
+  mc_mu_key(&key, MU_PRE_TRANS, f, NULL);
+  key.trans = trans;
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The least fixpoint of body on variable var]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_gfp Mc_mu_var]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_lfp(MuContext_ptr ctx, int var, MuFormula_ptr body)
+{
+  return mc_mu_fixpoint(ctx, MU_LFP, var, body);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [The greatest fixpoint of body on variable var]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_lfp Mc_mu_var]
+
+******************************************************************************/
+MuFormula_ptr Mc_mu_gfp(MuContext_ptr ctx, int var, MuFormula_ptr body)
+{
+  return mc_mu_fixpoint(ctx, MU_GFP, var, body);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Evaluates f]
+
+  Description [f must be closed, i.e. all its variables must be bound.
+  The returned BDD is referenced.]
+
+  SideEffects [Cached values of the subterms of f are updated]
+
+  SeeAlso     []
+
+******************************************************************************/
+bdd_ptr Mc_mu_eval(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  nusmv_assert(Mc_mu_is_closed(f));
+  return mc_mu_eval(ctx, f);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns true iff all the fixpoint variables of f are bound]
+
+  Description [Only closed formulas can be evaluated.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_eval]
+
+******************************************************************************/
+boolean Mc_mu_is_closed(MuFormula_ptr f)
+{
+  return f->deps == 0;
+}
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the formula of ctx with the given operator and
+  operands]
+
+  Description []
+
+  SideEffects [The formula is created if it does not exist yet]
+
+  SeeAlso     [mc_mu_find_or_add]
+
+******************************************************************************/
+static MuFormula_ptr mc_mu_new(MuContext_ptr ctx, MuOp op,
+                               MuFormula_ptr left, MuFormula_ptr right)
+{
+  MuFormula key;
+
+  mc_mu_key(&key, op, left, right);
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns a fixpoint formula]
+
+  Description []
+
+  SideEffects [The formula is created if it does not exist yet]
+
+  SeeAlso     []
+
+******************************************************************************/
+static MuFormula_ptr mc_mu_fixpoint(MuContext_ptr ctx, MuOp op,
+                                    int var, MuFormula_ptr body)
+{
+  MuFormula key;
+
+  nusmv_assert(0 <= var && var < MC_MU_MAX_VARS);
+  mc_mu_key(&key, op, body, NULL);
+  key.var = var;
+  key.deps &= ~MU_VAR_BIT(var);
+  return mc_mu_find_or_add(ctx, &key);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Initializes the key of a formula]
+
+  Description [The other fields of the formula are then set by the
+  caller, and the key is looked up with mc_mu_find_or_add.]
+
+  SideEffects []
+
+  SeeAlso     [mc_mu_find_or_add]
+
+******************************************************************************/
+static void mc_mu_key(MuFormula_ptr key, MuOp op,
+                      MuFormula_ptr left, MuFormula_ptr right)
+{
+  key->op = op;
+  key->left = left;
+  key->right = right;
+  key->bdd = (bdd_ptr) NULL;
+  key->strat = (bdd_ptr) NULL;
+  key->trans = BDD_TRANS(NULL);
+  key->var = -1;
+
+  key->deps = 0;
+  if (left != (MuFormula_ptr) NULL) key->deps |= left->deps;
+  if (right != (MuFormula_ptr) NULL) key->deps |= right->deps;
+  key->cache = (bdd_ptr) NULL;
+  key->cached_at = 0;
+  key->next = (MuFormula_ptr) NULL;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the formula of ctx equal to key]
+
+  Description [If there is none, a copy of key is created and owned by
+  ctx; the BDDs of key are then duplicated.]
+
+  SideEffects []
+
+  SeeAlso     [mc_mu_key]
+
+******************************************************************************/
+static MuFormula_ptr mc_mu_find_or_add(MuContext_ptr ctx, MuFormula_ptr key)
+{
+  MuFormula_ptr self;
+
+  if (st_lookup(ctx->unique, (char*) key, (char**) &self)) return self;
+
+  self = ALLOC(MuFormula, 1);
+  nusmv_assert(self != (MuFormula_ptr) NULL);
+
+  *self = *key;
+  if (self->bdd != (bdd_ptr) NULL) self->bdd = bdd_dup(self->bdd);
+  if (self->strat != (bdd_ptr) NULL) self->strat = bdd_dup(self->strat);
+
+  self->next = ctx->formulas;
+  ctx->formulas = self;
+  st_insert(ctx->unique, (char*) self, (char*) self);
+
+  return self;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Compares two formulas for hash-consing]
+
+  Description [Two formulas are equal if they have the same operator and
+  the same operands. BDDs are compared by pointer.]
+
+  SideEffects []
+
+  SeeAlso     [mc_mu_formula_hash]
+
+******************************************************************************/
+static int mc_mu_formula_compare(const char* f1, const char* f2)
+{
+  const MuFormula* a = (const MuFormula*) f1;
+  const MuFormula* b = (const MuFormula*) f2;
+
+  return !(a->op == b->op && a->left == b->left && a->right == b->right &&
+           a->bdd == b->bdd && a->strat == b->strat &&
+           a->trans == b->trans && a->var == b->var);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Hashes a formula for hash-consing]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [mc_mu_formula_compare]
+
+******************************************************************************/
+static int mc_mu_formula_hash(char* f, int modulus)
+{
+  const MuFormula* a = (const MuFormula*) f;
+  unsigned long h = (unsigned long) a->op;
+
+  h = h * 31 + (unsigned long) (nusmv_ptruint) a->left;
+  h = h * 31 + (unsigned long) (nusmv_ptruint) a->right;
+  h = h * 31 + (unsigned long) (nusmv_ptruint) a->bdd;
+  h = h * 31 + (unsigned long) (nusmv_ptruint) a->strat;
+  h = h * 31 + (unsigned long) (nusmv_ptruint) a->trans;
+  h = h * 31 + (unsigned long) a->var;
+  return (int) (h % (unsigned long) modulus);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Whether the cached value of f is still valid]
+
+  Description [It is, if none of the variables f depends on changed
+  since it was cached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static boolean mc_mu_is_cached(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  unsigned long deps = f->deps;
+  int v;
+
+  if (f->cache == (bdd_ptr) NULL) return false;
+
+  for (v = 0; deps != 0; v++, deps >>= 1) {
+    if ((deps & 1UL) && ctx->changed_at[v] > f->cached_at) return false;
+  }
+  return true;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Evaluates f, using and updating the cached values]
+
+  Description [The returned BDD is referenced.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static bdd_ptr mc_mu_eval(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  DdManager* dd = ctx->dd;
+  bdd_ptr res, l, r;
+
+  if (f->op == MU_VAR) {
+    nusmv_assert(ctx->values[f->var] != (bdd_ptr) NULL);
+    return bdd_dup(ctx->values[f->var]);
+  }
+
+  if (mc_mu_is_cached(ctx, f)) {
+    ctx->cache_hits++;
+    return bdd_dup(f->cache);
+  }
+  ctx->evaluations++;
+
+  switch (f->op) {
+  case MU_CONST:
+    res = bdd_dup(f->bdd);
+    break;
+
+  case MU_NOT:
+    l = mc_mu_eval(ctx, f->left);
+    res = bdd_not(dd, l);
+    bdd_free(dd, l);
+    break;
+
+  case MU_AND:
+  case MU_OR:
+    l = mc_mu_eval(ctx, f->left);
+    if ((f->op == MU_AND && bdd_is_false(dd, l)) ||
+        (f->op == MU_OR && bdd_is_true(dd, l))) {
+      res = l;
+      break;
+    }
+    r = mc_mu_eval(ctx, f->right);
+    res = (f->op == MU_AND) ? bdd_and(dd, l, r) : bdd_or(dd, l, r);
+    bdd_free(dd, l);
+    bdd_free(dd, r);
+    break;
+
+  case MU_PRE:
+    l = mc_mu_eval(ctx, f->left);
+    res = BddFsm_get_backward_image(ctx->fsm, l);
+    bdd_free(dd, l);
+    break;
+
+  case MU_WEAK_PRE:
+    l = mc_mu_eval(ctx, f->left);
+    res = BddFsm_get_weak_backward_image(ctx->fsm, l);
+    bdd_free(dd, l);
+    break;
+
+  case MU_POST:
+    l = mc_mu_eval(ctx, f->left);
+    res = BddFsm_get_forward_image(ctx->fsm, l);
+    bdd_free(dd, l);
+    break;
+
+  case MU_FORSOME:
+    l = mc_mu_eval(ctx, f->left);
+    res = bdd_forsome(dd, l, f->bdd);
+    bdd_free(dd, l);
+    break;
+
+  case MU_FORALL:
+    l = mc_mu_eval(ctx, f->left);
+    res = bdd_forall(dd, l, f->bdd);
+    bdd_free(dd, l);
+    break;
+
+  case MU_PRE_STRAT:
+    l = mc_mu_eval(ctx, f->left);
+    res = mc_mu_pre_strat(ctx, f, l);
+    bdd_free(dd, l);
+    break;
+
+  case MU_PRE_TRANS:
+    l = mc_mu_eval(ctx, f->left);
+    r = BddEnc_state_var_to_next_state_var(ctx->enc, l);
+    res = BddTrans_get_backward_image_state(f->trans, r);
+    bdd_free(dd, r);
+    bdd_free(dd, l);
+    break;
+
+  case MU_LFP:
+  case MU_GFP:
+    res = mc_mu_eval_fixpoint(ctx, f);
+    break;
+
+  default:
+    error_unreachable_code();
+  }
+
+  if (f->cache != (bdd_ptr) NULL) bdd_free(dd, f->cache);
+  f->cache = bdd_dup(res);
+  f->cached_at = ctx->clock;
+
+  return res;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Evaluates a fixpoint formula]
+
+  Description [Iterates from false (least fixpoint) or true (greatest
+  fixpoint) until stabilization. The previous value of the variable is
+  restored afterwards, so variables may be reused by nested
+  fixpoints.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static bdd_ptr mc_mu_eval_fixpoint(MuContext_ptr ctx, MuFormula_ptr f)
+{
+  DdManager* dd = ctx->dd;
+  bdd_ptr saved = ctx->values[f->var];
+  bdd_ptr z, next;
+
+  z = (f->op == MU_LFP) ? bdd_false(dd) : bdd_true(dd);
+
+  while (true) {
+    ctx->values[f->var] = z;
+    ctx->changed_at[f->var] = ++ctx->clock;
+
+    next = mc_mu_eval(ctx, f->left);
+    if (next == z) {
+      bdd_free(dd, next);
+      break;
+    }
+    bdd_free(dd, z);
+    z = next;
+  }
+
+  ctx->values[f->var] = saved;
+  ctx->changed_at[f->var] = ++ctx->clock;
+
+  return z;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Computes the strategy pre-image of states]
+
+  Description [See Mc_mu_pre_strat. The returned BDD is referenced.]
+
+  SideEffects []
+
+  SeeAlso     [Mc_mu_pre_strat]
+
+******************************************************************************/
+static bdd_ptr mc_mu_pre_strat(MuContext_ptr ctx, MuFormula_ptr f,
+                               bdd_ptr states)
+{
+  DdManager* dd = ctx->dd;
+  bdd_ptr inputs_cube, mask, s, ns, bad, good, tmp, res;
+
+  inputs_cube = BddEnc_get_input_vars_cube(ctx->enc);
+  mask = BddEnc_get_state_frozen_input_vars_mask_bdd(ctx->enc);
+
+  /* abstract away the actions of states */
+  s = bdd_forsome(dd, states, inputs_cube);
+  tmp = bdd_not(dd, s);
+  ns = bdd_and(dd, tmp, mask);
+  bdd_free(dd, tmp);
+
+  /* pairs <s, a_gamma> for which some opponent action leads out of states */
+  tmp = BddFsm_get_weak_backward_image(ctx->fsm, ns);
+  bad = bdd_forsome(dd, tmp, f->bdd);
+  bdd_free(dd, tmp);
+
+  /* pairs <s, a_gamma> for which all opponent actions lead to states */
+  good = BddFsm_get_weak_backward_image(ctx->fsm, s);
+  tmp = bdd_not(dd, bad);
+  bdd_and_accumulate(dd, &good, tmp);
+  bdd_free(dd, tmp);
+  tmp = bdd_forsome(dd, good, f->bdd);
+  bdd_free(dd, good);
+
+  bdd_and_accumulate(dd, &tmp, f->strat);
+  res = bdd_forsome(dd, tmp, inputs_cube);
+
+  bdd_free(dd, tmp);
+  bdd_free(dd, bad);
+  bdd_free(dd, ns);
+  bdd_free(dd, s);
+  bdd_free(dd, mask);
+  bdd_free(dd, inputs_cube);
+
+  return res;
+}
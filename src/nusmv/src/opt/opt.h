@@ -76,6 +76,12 @@
 #define DEFAULT_TYPE_CHECKING_WARNING_ON true
 #define DEFAULT_CONJ_PART_THRESHOLD 1000
 #define DEFAULT_IMAGE_CLUSTER_SIZE 1000
+/* Reordering budgets, in milliseconds. 0 means no limit */
+#define DEFAULT_REORDER_TIME_LIMIT 0
+#define DEFAULT_REORDER_TOTAL_LIMIT 0
+/* Frontier size (in BDD nodes) above which guided reachability subsets
+   the frontier. 0 means exact reachability */
+#define DEFAULT_GUIDED_REACHABILITY_THRESHOLD 0
 #define DEFAULT_SHOWN_STATES 25
 /* maximum number of states shown during an interactive simulation step*/
 #define MAX_SHOWN_STATES 65535
@@ -90,6 +96,10 @@
 #endif
 #endif
 
+/* Number of destroyed groups after which an incremental SAT solver
+   removes the satisfied clauses from its database */
+#define DEFAULT_SAT_SIMPLIFY_PERIOD 8
+
 #define OPT_USER_POV_NULL_STRING  "" /* user pov of the null string */
 
 #define DEFAULT_OREG_JUSTICE_EMPTINESS_BDD_ALGORITHM \
@@ -243,6 +253,15 @@ EXTERN unsigned int get_reorder_method ARGS((OptsHandler_ptr));
 EXTERN void    set_dynamic_reorder ARGS((OptsHandler_ptr));
 EXTERN void    unset_dynamic_reorder ARGS((OptsHandler_ptr));
 EXTERN boolean opt_dynamic_reorder ARGS((OptsHandler_ptr));
+EXTERN void    set_reorder_time_limit ARGS((OptsHandler_ptr, int));
+EXTERN int     get_reorder_time_limit ARGS((OptsHandler_ptr));
+EXTERN void    set_reorder_total_limit ARGS((OptsHandler_ptr, int));
+EXTERN int     get_reorder_total_limit ARGS((OptsHandler_ptr));
+EXTERN void    set_reorder_between_iterations ARGS((OptsHandler_ptr));
+EXTERN void    unset_reorder_between_iterations ARGS((OptsHandler_ptr));
+EXTERN boolean opt_reorder_between_iterations ARGS((OptsHandler_ptr));
+EXTERN void    set_guided_reachability_threshold ARGS((OptsHandler_ptr, int));
+EXTERN int     get_guided_reachability_threshold ARGS((OptsHandler_ptr));
 EXTERN void    set_enable_sexp2bdd_caching ARGS((OptsHandler_ptr));
 EXTERN void    unset_enable_sexp2bdd_caching ARGS((OptsHandler_ptr));
 EXTERN boolean opt_enable_sexp2bdd_caching ARGS((OptsHandler_ptr));
@@ -287,6 +306,8 @@ EXTERN int     get_prop_no ARGS((OptsHandler_ptr));
 EXTERN void print_partition_method  ARGS((FILE *));
 EXTERN void set_sat_solver ARGS((OptsHandler_ptr, const char*));
 EXTERN const char* get_sat_solver ARGS((OptsHandler_ptr));
+EXTERN void set_sat_simplify_period ARGS((OptsHandler_ptr, int));
+EXTERN int get_sat_simplify_period ARGS((OptsHandler_ptr));
 EXTERN boolean set_default_trace_plugin ARGS((OptsHandler_ptr opt, int plugin));
 EXTERN int get_default_trace_plugin ARGS((OptsHandler_ptr opt));
 EXTERN void set_iwls95_preorder ARGS((OptsHandler_ptr opt));
@@ -350,6 +371,14 @@ EXTERN void set_rbc_inlining_lazy ARGS((OptsHandler_ptr opt));
 EXTERN void unset_rbc_inlining_lazy ARGS((OptsHandler_ptr opt));
 EXTERN boolean opt_rbc_inlining_lazy ARGS((OptsHandler_ptr opt));
 
+EXTERN void set_rbc_balancing ARGS((OptsHandler_ptr opt));
+EXTERN void unset_rbc_balancing ARGS((OptsHandler_ptr opt));
+EXTERN boolean opt_rbc_balancing ARGS((OptsHandler_ptr opt));
+
+EXTERN void set_rbc_sweeping ARGS((OptsHandler_ptr opt));
+EXTERN void unset_rbc_sweeping ARGS((OptsHandler_ptr opt));
+EXTERN boolean opt_rbc_sweeping ARGS((OptsHandler_ptr opt));
+
 EXTERN void set_use_coi_size_sorting ARGS((OptsHandler_ptr opt));
 EXTERN void unset_use_coi_size_sorting ARGS((OptsHandler_ptr opt));
 EXTERN boolean opt_use_coi_size_sorting ARGS((OptsHandler_ptr opt));
@@ -88,6 +88,8 @@ static void* opt_get_sat_solver ARGS((OptsHandler_ptr opts,
 
 static boolean opt_check_shown_states ARGS((OptsHandler_ptr opts,
                                             const char* val));
+static boolean opt_check_sat_simplify_period ARGS((OptsHandler_ptr opts,
+                                                   const char* val));
 static boolean opt_check_word_format ARGS((OptsHandler_ptr opts,
                                            const char* val));
 /* Generic getter functions */
@@ -114,6 +116,11 @@ static boolean opt_dynamic_reorder_trigger ARGS((OptsHandler_ptr opts,
                                                  const char* value,
                                                  Trigger_Action action));
 
+static boolean opt_reorder_limit_trigger ARGS((OptsHandler_ptr opts,
+                                               const char* opt,
+                                               const char* value,
+                                               Trigger_Action action));
+
 static boolean opt_trans_order_file_trigger ARGS((OptsHandler_ptr opts,
                                                   const char* opt,
                                                   const char* value,
@@ -377,6 +384,31 @@ void init_options()
                                        opt_dynamic_reorder_trigger);
   nusmv_assert(res);
 
+  res = OptsHandler_register_int_option(opts, REORDER_TIME_LIMIT,
+                                        DEFAULT_REORDER_TIME_LIMIT, true);
+  nusmv_assert(res);
+
+  res = OptsHandler_add_option_trigger(opts, REORDER_TIME_LIMIT,
+                                       opt_reorder_limit_trigger);
+  nusmv_assert(res);
+
+  res = OptsHandler_register_int_option(opts, REORDER_TOTAL_LIMIT,
+                                        DEFAULT_REORDER_TOTAL_LIMIT, true);
+  nusmv_assert(res);
+
+  res = OptsHandler_add_option_trigger(opts, REORDER_TOTAL_LIMIT,
+                                       opt_reorder_limit_trigger);
+  nusmv_assert(res);
+
+  res = OptsHandler_register_bool_option(opts, REORDER_BETWEEN_ITERATIONS,
+                                         false, true);
+  nusmv_assert(res);
+
+  res = OptsHandler_register_int_option(opts, GUIDED_REACHABILITY_THRESHOLD,
+                                        DEFAULT_GUIDED_REACHABILITY_THRESHOLD,
+                                        true);
+  nusmv_assert(res);
+
   res = OptsHandler_register_bool_option(opts, ENABLE_SEXP2BDD_CACHING, true, true);
   nusmv_assert(res);
 
@@ -543,6 +575,14 @@ void init_options()
                                        opt_rbc_inlining_lazy_trigger);
   nusmv_assert(res);
 
+  res = OptsHandler_register_bool_option(opts, RBC_BALANCING,
+                                         false, true);
+  nusmv_assert(res);
+
+  res = OptsHandler_register_bool_option(opts, RBC_SWEEPING,
+                                         false, true);
+  nusmv_assert(res);
+
 #endif
 
   res = OptsHandler_register_option(opts, A_SAT_SOLVER,
@@ -552,6 +592,18 @@ void init_options()
                                     true, GENERIC_OPTION);
   nusmv_assert(res);
 
+  {
+    char def[20];
+    int chars = snprintf(def, 20, "%d", DEFAULT_SAT_SIMPLIFY_PERIOD);
+    SNPRINTF_CHECK(chars, 20);
+
+    res = OptsHandler_register_option(opts, SAT_SIMPLIFY_PERIOD, def,
+                               (Opts_CheckFnType)opt_check_sat_simplify_period,
+                               (Opts_ReturnFnType)opt_get_integer,
+                               true, INTEGER_OPTION);
+    nusmv_assert(res);
+  }
+
 
   res = OptsHandler_register_bool_option(opts, SHOW_DEFINES_IN_TRACES,
                                          DEFAULT_SHOW_DEFINES_IN_TRACES, true);
@@ -1133,6 +1185,61 @@ boolean opt_dynamic_reorder(OptsHandler_ptr opt)
   return OptsHandler_get_bool_option_value(opt, DYNAMIC_REORDER);
 }
 
+/* Time budgets of dynamic reordering, in milliseconds */
+void set_reorder_time_limit(OptsHandler_ptr opt, int msecs)
+{
+  boolean res = OptsHandler_set_int_option_value(opt, REORDER_TIME_LIMIT,
+                                                 msecs);
+  nusmv_assert(res);
+}
+int get_reorder_time_limit(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_int_option_value(opt, REORDER_TIME_LIMIT);
+}
+void set_reorder_total_limit(OptsHandler_ptr opt, int msecs)
+{
+  boolean res = OptsHandler_set_int_option_value(opt, REORDER_TOTAL_LIMIT,
+                                                 msecs);
+  nusmv_assert(res);
+}
+int get_reorder_total_limit(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_int_option_value(opt, REORDER_TOTAL_LIMIT);
+}
+
+/* reorders only between the iterations of reachability fixpoints */
+void set_reorder_between_iterations(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt,
+                                                  REORDER_BETWEEN_ITERATIONS,
+                                                  true);
+  nusmv_assert(res);
+}
+void unset_reorder_between_iterations(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt,
+                                                  REORDER_BETWEEN_ITERATIONS,
+                                                  false);
+  nusmv_assert(res);
+}
+boolean opt_reorder_between_iterations(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_bool_option_value(opt, REORDER_BETWEEN_ITERATIONS);
+}
+
+/* subsets reachability frontiers larger than the given number of nodes */
+void set_guided_reachability_threshold(OptsHandler_ptr opt, int nodes)
+{
+  boolean res = OptsHandler_set_int_option_value(opt,
+                                                 GUIDED_REACHABILITY_THRESHOLD,
+                                                 nodes);
+  nusmv_assert(res);
+}
+int get_guided_reachability_threshold(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_int_option_value(opt, GUIDED_REACHABILITY_THRESHOLD);
+}
+
 /* allows the memoization (caching) of computations
    in sexpr-to-bdd evaluations. */
 void set_enable_sexp2bdd_caching(OptsHandler_ptr opt)
@@ -1373,6 +1480,17 @@ const char* get_sat_solver(OptsHandler_ptr opt)
   return OptsHandler_get_string_option_value(opt, A_SAT_SOLVER);
 }
 
+void set_sat_simplify_period(OptsHandler_ptr opt, int groups)
+{
+  boolean res = OptsHandler_set_int_option_value(opt, SAT_SIMPLIFY_PERIOD,
+                                                 groups);
+  nusmv_assert(res);
+}
+int get_sat_simplify_period(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_int_option_value(opt, SAT_SIMPLIFY_PERIOD);
+}
+
 boolean set_default_trace_plugin(OptsHandler_ptr opt, int plugin)
 {
   return OptsHandler_set_int_option_value(opt,
@@ -1699,6 +1817,40 @@ boolean opt_rbc_inlining_lazy(OptsHandler_ptr opt)
   return OptsHandler_get_bool_option_value(opt, RBC_INLINING_LAZY);
 }
 
+void set_rbc_balancing(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, RBC_BALANCING, true);
+  nusmv_assert(res);
+}
+
+void unset_rbc_balancing(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, RBC_BALANCING, false);
+  nusmv_assert(res);
+}
+
+boolean opt_rbc_balancing(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_bool_option_value(opt, RBC_BALANCING);
+}
+
+void set_rbc_sweeping(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, RBC_SWEEPING, true);
+  nusmv_assert(res);
+}
+
+void unset_rbc_sweeping(OptsHandler_ptr opt)
+{
+  boolean res = OptsHandler_set_bool_option_value(opt, RBC_SWEEPING, false);
+  nusmv_assert(res);
+}
+
+boolean opt_rbc_sweeping(OptsHandler_ptr opt)
+{
+  return OptsHandler_get_bool_option_value(opt, RBC_SWEEPING);
+}
+
 void set_show_defines_in_traces (OptsHandler_ptr opt)
 {
   boolean res = OptsHandler_set_bool_option_value(opt, SHOW_DEFINES_IN_TRACES,
@@ -2746,6 +2898,34 @@ static boolean opt_check_shown_states(OptsHandler_ptr opts, const char* val)
   return false;
 }
 
+/**Function********************************************************************
+
+   Synopsis    [Check function for the sat_simplify_period option]
+
+   Description [The period must be a positive number of groups]
+
+   SideEffects []
+
+   SeeAlso     []
+
+******************************************************************************/
+static boolean opt_check_sat_simplify_period(OptsHandler_ptr opts,
+                                             const char* val)
+{
+  void * tmp = opt_get_integer(opts, val);
+
+  if (tmp != OPTS_VALUE_ERROR) {
+    if (PTR_TO_INT(tmp) < 1) {
+      fprintf(nusmv_stderr, "Number must be n >= 1\n");
+    }
+    else {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /**Function********************************************************************
 
    Synopsis    [Trigger that sets the use_reachable_states flag if needed]
@@ -2842,6 +3022,45 @@ static boolean opt_dynamic_reorder_trigger(OptsHandler_ptr opts,
   return true;
 }
 
+/**Function********************************************************************
+
+   Synopsis    [Reordering budgets trigger]
+
+   Description [Trigger of the reorder_time_limit and
+   reorder_total_limit options: forwards the new budget to the dd
+   manager. Negative budgets are rejected.]
+
+   SideEffects []
+
+   SeeAlso     [dd_set_reorder_time_limit dd_set_reorder_total_limit]
+
+******************************************************************************/
+static boolean opt_reorder_limit_trigger(OptsHandler_ptr opts,
+                                         const char* opt,
+                                         const char* value,
+                                         Trigger_Action action)
+{
+  long msecs;
+
+  switch (action) {
+  case ACTION_SET:
+    msecs = (long) opt_get_integer(opts, value);
+    if ((void*) msecs == OPTS_VALUE_ERROR || msecs < 0) return false;
+    break;
+  case ACTION_RESET:
+    msecs = 0;
+    break;
+  default: return true;
+  }
+
+  if (strcmp(opt, REORDER_TIME_LIMIT) == 0) {
+    dd_set_reorder_time_limit(dd_manager, msecs);
+  }
+  else dd_set_reorder_total_limit(dd_manager, msecs);
+
+  return true;
+}
+
 /**Function********************************************************************
 
    Synopsis    [Trigger for the default_trace_plugin option. ]
@@ -104,6 +104,10 @@
 #define ENABLE_REORDER    "enable_reorder"
 #define REORDER_METHOD    "reorder_method"
 #define DYNAMIC_REORDER   "dynamic_reorder"
+#define REORDER_TIME_LIMIT "reorder_time_limit"
+#define REORDER_TOTAL_LIMIT "reorder_total_limit"
+#define REORDER_BETWEEN_ITERATIONS "reorder_between_iterations"
+#define GUIDED_REACHABILITY_THRESHOLD "guided_reachability_threshold"
 #define ENABLE_SEXP2BDD_CACHING   "enable_sexp2bdd_caching"
 #define PARTITION_METHOD  "partition_method"
 #define CONJ_PART_THRESHOLD "conj_part_threshold"
@@ -115,6 +119,7 @@
 #define PROP_PRINT_METHOD "prop_print_method"
 #define PROP_NO         "prop_no"
 #define A_SAT_SOLVER "sat_solver"
+#define SAT_SIMPLIFY_PERIOD "sat_simplify_period"
 #define IWLS95_PREORDER  "iwls95preorder"
 #define AFFINITY_CLUSTERING  "affinity"
 #define APPEND_CLUSTERS  "append_clusters"
@@ -140,6 +145,8 @@
 #define SYMB_INLINING "sexp_inlining"
 #define RBC_INLINING "rbc_inlining"
 #define RBC_INLINING_LAZY "rbc_inlining_lazy"
+#define RBC_BALANCING "rbc_balancing"
+#define RBC_SWEEPING "rbc_sweeping"
 
 #define SHOW_DEFINES_IN_TRACES "traces_show_defines"
 #define SHOW_DEFINES_WITH_NEXT "traces_show_defines_with_next"
@@ -103,10 +103,12 @@ typedef enum Rbc_Bool {
 } Rbc_Bool_c;
 
 typedef struct RbcManager Rbc_Manager_t;
+typedef struct RbcTemplate Rbc_Template_t;
 typedef Dag_Vertex_t      Rbc_t;
 typedef Dag_DfsFunctions_t RbcDfsFunctions_t;
 typedef void (*Rbc_ProcPtr_t)();
 typedef int (*Rbc_IntPtr_t)();
+typedef boolean (*Rbc_EquivCheckPtr_t)(Rbc_Manager_t*, Rbc_t*, Rbc_t*, void*);
 
 /*---------------------------------------------------------------------------*/
 /* Structure declarations                                                     */
@@ -248,6 +250,27 @@ EXTERN void Rbc_Dfs_exported ARGS((Rbc_t* dfsRoot,
 EXTERN void Rbc_Dfs_clean_exported ARGS((Rbc_t* dfsRoot,
                                          Rbc_Manager_t* manager));
 
+EXTERN Rbc_t* Rbc_Balance ARGS((Rbc_Manager_t* rbcManager, Rbc_t* f));
+
+EXTERN Rbc_t* Rbc_Sweep ARGS((Rbc_Manager_t* rbcManager, Rbc_t* f,
+                              Rbc_EquivCheckPtr_t check, void* checkData));
+
+EXTERN Rbc_Template_t*
+Rbc_TemplateCreate ARGS((Rbc_Manager_t* rbcManager, Rbc_t* f,
+                         const int* phy2log));
+
+EXTERN void Rbc_TemplateDestroy ARGS((Rbc_Template_t* self));
+
+EXTERN Rbc_t*
+Rbc_TemplateLogicalShift ARGS((Rbc_Manager_t* rbcManager,
+                               Rbc_Template_t* self,
+                               int shift, const int* log2phy));
+
+EXTERN Rbc_t*
+Rbc_TemplateLogicalSubst ARGS((Rbc_Manager_t* rbcManager,
+                               Rbc_Template_t* self,
+                               const int* subst, const int* log2phy));
+
 /**AutomaticEnd***************************************************************/
 
 #endif /* _RBC */
@@ -0,0 +1,894 @@
+/**CFile***********************************************************************
+
+  FileName    [rbcRewrite.c]
+
+  PackageName [rbc]
+
+  Synopsis    [Functional reductions of RBCs: balancing and sweeping]
+
+  Description [External functions included in this module:
+               <ul>
+               <li> <b>Rbc_Balance()</b> rewrites the conjunctions of
+                    a formula as balanced trees of their (simplified)
+                    conjuncts
+               <li> <b>Rbc_Sweep()</b> merges the vertices of a formula
+                    that are functionally equivalent (modulo
+                    complementation), using random simulation to find
+                    the candidates and a user-provided oracle to
+                    prove them.
+               </ul>
+               Both functions return a formula that is equivalent to
+               the given one, and are meant to be applied to the
+               problems before they are converted into CNF.]
+
+  SeeAlso     [rbcFormula.c]
+
+  Author      []
+
+  Copyright   [
+  This file is part of the ``rbc'' package of NuSMV version 2.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+
+#include "rbc/rbcInt.h"
+
+#include "utils/assoc.h"
+#include "utils/heap.h"
+#include "utils/error.h"
+
+#include <string.h> /* for memcmp */
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/* Maximum number of sons of a vertex (ITE) */
+#define RBC_REWRITE_MAX_SONS 3
+
+/* Number of simulation words per vertex (i.e. number of random
+   patterns divided by the bits of an unsigned long) */
+#define RBC_SIM_WORDS 4
+
+/* Maximum number of calls to the equivalence oracle for one sweep */
+#define RBC_SWEEP_MAX_CHECKS 1000
+
+/* Class representative standing for the constant false */
+#define RBC_SWEEP_CONSTANT_CLASS -1
+
+/*---------------------------------------------------------------------------*/
+/* Stucture declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/**Struct**********************************************************************
+  Synopsis      [Vertices of a formula in topological order]
+  Description   [Vertices are stored without annotation, every son
+                 preceding its fathers. sons holds, for each vertex,
+                 RBC_REWRITE_MAX_SONS entries encoding the position of its
+                 sons (shifted left by one, the lowest bit being the
+                 complementation bit of the edge), unused entries being
+                 -1. Positions are also stored in the iRef field of the
+                 vertices, which is only valid until another dfs is
+                 performed on them.]
+  SeeAlso       []
+******************************************************************************/
+typedef struct RbcTopo_TAG {
+  Rbc_t** nodes;
+  int* sons;
+  int size;
+  int capacity;
+} RbcTopo;
+
+/**Struct**********************************************************************
+  Synopsis      [A growable array of (annotated) edges]
+  Description   []
+  SeeAlso       []
+******************************************************************************/
+typedef struct RbcEdges_TAG {
+  Rbc_t** edges;
+  int size;
+  int capacity;
+} RbcEdges;
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/* used by the hashing functions of the signatures table */
+static int rbc_sim_words = RBC_SIM_WORDS;
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/**Macro***********************************************************************
+
+  Synopsis    [Position of the vertex pointed by the given edge]
+
+  Description [Valid only after rbc_topo_init has been called on a
+               formula containing the vertex]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+#define RBC_TOPO_INDEX(e) (RbcGetRef(e)->iRef)
+
+/**Macro***********************************************************************
+
+  Synopsis    [Returns the rebuilt version of the s-th son of the i-th
+               vertex of topo]
+
+  Description [map holds the rebuilt version of the vertices. Does not
+               rely on the iRef field of the vertices.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+#define RBC_TOPO_MAPPED_SON(topo, map, i, s)                          \
+  RbcId((map)[(topo)->sons[(i) * RBC_REWRITE_MAX_SONS + (s)] >> 1],   \
+        (((topo)->sons[(i) * RBC_REWRITE_MAX_SONS + (s)] & 1) ?       \
+         RBC_FALSE : RBC_TRUE))
+
+/**Macro***********************************************************************
+
+  Synopsis    [Sign of the given edge, as a Rbc_Bool_c]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+#define RBC_EDGE_SIGN(e) ((Rbc_Bool_c) (RbcIsSet(e) ? RBC_FALSE : RBC_TRUE))
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static void rbc_topo_init ARGS((RbcTopo* self, Rbc_t* f));
+static void rbc_topo_deinit ARGS((RbcTopo* self));
+static int rbc_topo_set ARGS((Rbc_t* f, char* _data, nusmv_ptrint sign));
+static void rbc_topo_first ARGS((Rbc_t* f, char* _data, nusmv_ptrint sign));
+static void rbc_topo_back ARGS((Rbc_t* f, char* _data, nusmv_ptrint sign));
+static void rbc_topo_last ARGS((Rbc_t* f, char* _data, nusmv_ptrint sign));
+
+static void rbc_edges_init ARGS((RbcEdges* self));
+static void rbc_edges_deinit ARGS((RbcEdges* self));
+static void rbc_edges_push ARGS((RbcEdges* self, Rbc_t* e));
+
+static void rbc_collect_supergate ARGS((Rbc_t* v, const int* fanout,
+                                        RbcEdges* leaves, RbcEdges* stack));
+
+static Rbc_t* rbc_build_balanced_and ARGS((Rbc_Manager_t* rbcm,
+                                           RbcEdges* conjuncts,
+                                           hash_ptr levels));
+
+static int rbc_get_level ARGS((hash_ptr levels, Rbc_t* f));
+static int rbc_edge_compare ARGS((const void* a, const void* b));
+
+static Rbc_t* rbc_rebuild_vertex ARGS((Rbc_Manager_t* rbcm,
+                                       const RbcTopo* topo, int i,
+                                       Rbc_t** map));
+
+static unsigned long rbc_random_word ARGS((void));
+static int rbc_signature_compare ARGS((const char* s1, const char* s2));
+static int rbc_signature_hash ARGS((char* s, int modulus));
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of external functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Rewrites the conjunctions of f as balanced trees]
+
+  Description [Every maximal tree of positive AND vertices with a
+               single father (a "supergate") is collected into the set
+               of its conjuncts. The set is simplified (constants and
+               duplicated conjuncts are removed, a conjunct occurring
+               with both polarities makes the supergate false), and
+               the conjunction is rebuilt by always joining the two
+               shallowest conjuncts first. Since the conjunction is
+               rebuilt through Rbc_MakeAnd, the two-level
+               minimization rules are applied again to the new
+               vertices.
+
+               The returned formula is equivalent to f.]
+
+  SideEffects [The user fields of the vertices of f are overwritten]
+
+  SeeAlso     [Rbc_Sweep]
+
+******************************************************************************/
+Rbc_t* Rbc_Balance(Rbc_Manager_t* rbcManager, Rbc_t* f)
+{
+  RbcTopo topo;
+  RbcEdges leaves;
+  RbcEdges stack;
+  Rbc_t** map;
+  int* fanout;
+  boolean* needed;
+  hash_ptr levels;
+  Rbc_t* res;
+  int root;
+  int i;
+  unsigned s;
+
+  /* lazy evaluation */
+  if (Rbc_IsConstant(rbcManager, f)) return f;
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+    fprintf(nusmv_stderr, "Rbc: starting balancing ... \n");
+  }
+
+  rbc_topo_init(&topo, f);
+  rbc_edges_init(&leaves);
+  rbc_edges_init(&stack);
+
+  map = ALLOC(Rbc_t*, topo.size);
+  fanout = ALLOC(int, topo.size);
+  needed = ALLOC(boolean, topo.size);
+  for (i = 0; i < topo.size; ++i) {
+    map[i] = NIL(Rbc_t);
+    fanout[i] = 0;
+    needed[i] = false;
+  }
+
+  /* counts the fathers of each vertex within f */
+  root = RBC_TOPO_INDEX(f);
+  fanout[root] = 1;
+  for (i = 0; i < topo.size; ++i) {
+    Rbc_t* v = topo.nodes[i];
+    if (v->outList != (Dag_Vertex_t**) NULL) {
+      for (s = 0; s < v->numSons; ++s) ++fanout[RBC_TOPO_INDEX(v->outList[s])];
+    }
+  }
+
+  /* top down: finds the vertices that survive the collapsing of
+     supergates */
+  needed[root] = true;
+  for (i = topo.size - 1; i >= 0; --i) {
+    Rbc_t* v = topo.nodes[i];
+    if (!needed[i] || v->outList == (Dag_Vertex_t**) NULL) continue;
+
+    if (v->symbol == RBCAND) {
+      int l;
+      leaves.size = 0;
+      rbc_collect_supergate(v, fanout, &leaves, &stack);
+      for (l = 0; l < leaves.size; ++l) {
+        needed[RBC_TOPO_INDEX(leaves.edges[l])] = true;
+      }
+    }
+    else {
+      for (s = 0; s < v->numSons; ++s) {
+        needed[RBC_TOPO_INDEX(v->outList[s])] = true;
+      }
+    }
+  }
+
+  /* bottom up: rebuilds the surviving vertices */
+  levels = new_assoc();
+  for (i = 0; i < topo.size; ++i) {
+    Rbc_t* v = topo.nodes[i];
+    if (!needed[i]) continue;
+
+    if (v->symbol == RBCAND) {
+      int l;
+      leaves.size = 0;
+      rbc_collect_supergate(v, fanout, &leaves, &stack);
+      for (l = 0; l < leaves.size; ++l) {
+        Rbc_t* e = leaves.edges[l];
+        leaves.edges[l] = RbcId(map[RBC_TOPO_INDEX(e)], RBC_EDGE_SIGN(e));
+      }
+      map[i] = rbc_build_balanced_and(rbcManager, &leaves, levels);
+    }
+    else map[i] = rbc_rebuild_vertex(rbcManager, &topo, i, map);
+  }
+
+  res = RbcId(map[root], RBC_EDGE_SIGN(f));
+
+  free_assoc(levels);
+  FREE(needed);
+  FREE(fanout);
+  FREE(map);
+  rbc_edges_deinit(&stack);
+  rbc_edges_deinit(&leaves);
+  rbc_topo_deinit(&topo);
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+    fprintf(nusmv_stderr, "Rbc: end of balancing\n");
+  }
+
+  return res;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Merges the functionally equivalent vertices of f]
+
+  Description [The vertices of f are simulated on a set of random
+               patterns. Vertices with the same signature (modulo
+               complementation) are candidate to be equivalent, and
+               vertices whose signature is constant are candidate to
+               be constant. Vertices are then rebuilt in topological
+               order, and each one is replaced by the representative
+               of its class (the first vertex of the class found in
+               the topological order) when the oracle `check' proves
+               them equivalent.
+
+               `check' is called as check(rbcManager, a, b, checkData)
+               and must return true only if a and b are proved to be
+               equivalent for every assignment of the variables. At
+               most RBC_SWEEP_MAX_CHECKS calls are issued per sweep.
+
+               The returned formula is equivalent to f.]
+
+  SideEffects [The user fields of the vertices of f are overwritten]
+
+  SeeAlso     [Rbc_Balance]
+
+******************************************************************************/
+Rbc_t* Rbc_Sweep(Rbc_Manager_t* rbcManager, Rbc_t* f,
+                 Rbc_EquivCheckPtr_t check, void* checkData)
+{
+  RbcTopo topo;
+  unsigned long* sims;
+  unsigned long* norm;
+  boolean* phase;
+  int* repr;
+  Rbc_t** map;
+  st_table* classes;
+  Rbc_t* res;
+  int checks, merged;
+  int i, w;
+
+  /* lazy evaluation */
+  if (Rbc_IsConstant(rbcManager, f)) return f;
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+    fprintf(nusmv_stderr, "Rbc: starting sweeping ... \n");
+  }
+
+  rbc_topo_init(&topo, f);
+
+  sims = ALLOC(unsigned long, topo.size * RBC_SIM_WORDS);
+  norm = ALLOC(unsigned long, (topo.size + 1) * RBC_SIM_WORDS);
+  phase = ALLOC(boolean, topo.size);
+  repr = ALLOC(int, topo.size);
+  map = ALLOC(Rbc_t*, topo.size);
+
+  /* random simulation, every son preceding its fathers */
+  for (i = 0; i < topo.size; ++i) {
+    Rbc_t* v = topo.nodes[i];
+    unsigned long* sim = sims + i * RBC_SIM_WORDS;
+
+    switch (v->symbol) {
+    case RBCTOP:
+      for (w = 0; w < RBC_SIM_WORDS; ++w) sim[w] = ~0UL;
+      break;
+
+    case RBCVAR:
+      for (w = 0; w < RBC_SIM_WORDS; ++w) sim[w] = rbc_random_word();
+      break;
+
+    default:
+      {
+        unsigned long* son_sims[RBC_REWRITE_MAX_SONS];
+        unsigned long son_masks[RBC_REWRITE_MAX_SONS];
+        unsigned s;
+
+        nusmv_assert(v->numSons <= RBC_REWRITE_MAX_SONS);
+        for (s = 0; s < v->numSons; ++s) {
+          son_sims[s] = sims + RBC_TOPO_INDEX(v->outList[s]) * RBC_SIM_WORDS;
+          son_masks[s] = RbcIsSet(v->outList[s]) ? ~0UL : 0UL;
+        }
+
+        for (w = 0; w < RBC_SIM_WORDS; ++w) {
+          unsigned long a = son_sims[0][w] ^ son_masks[0];
+          unsigned long b = son_sims[1][w] ^ son_masks[1];
+
+          if (v->symbol == RBCAND) sim[w] = a & b;
+          else if (v->symbol == RBCIFF) sim[w] = ~(a ^ b);
+          else if (v->symbol == RBCITE) {
+            unsigned long c = son_sims[2][w] ^ son_masks[2];
+            sim[w] = (a & b) | (~a & c);
+          }
+          else internal_error("Rbc_Sweep: unknown RBC symbol");
+        }
+      }
+    }
+  }
+
+  /* partitions the vertices into candidate classes. Signatures are
+     normalized to have the first bit cleared, so that a vertex and
+     the complement of another one fall into the same class. */
+  classes = st_init_table(rbc_signature_compare, rbc_signature_hash);
+
+  /* the class of the constants: the last signature is all zeros */
+  for (w = 0; w < RBC_SIM_WORDS; ++w) norm[topo.size * RBC_SIM_WORDS + w] = 0;
+  st_insert(classes, (char*) (norm + topo.size * RBC_SIM_WORDS),
+            (char*) PTR_FROM_INT(char*, RBC_SWEEP_CONSTANT_CLASS));
+
+  for (i = 0; i < topo.size; ++i) {
+    Rbc_t* v = topo.nodes[i];
+    unsigned long* sim = sims + i * RBC_SIM_WORDS;
+    unsigned long* key = norm + i * RBC_SIM_WORDS;
+    char** slot;
+
+    phase[i] = (sim[0] & 1UL) != 0;
+    for (w = 0; w < RBC_SIM_WORDS; ++w) key[w] = phase[i] ? ~sim[w] : sim[w];
+
+    repr[i] = i;
+    /* variables and constants are never merged */
+    if (v->symbol == RBCVAR || v->symbol == RBCTOP) continue;
+
+    if (st_find_or_add(classes, (char*) key, &slot)) {
+      repr[i] = PTR_TO_INT(*slot);
+    }
+    else *slot = (char*) PTR_FROM_INT(char*, i);
+  }
+
+  /* rebuilds the formula merging the proved equivalences. The oracle
+     may perform dfs on the vertices, so from now on positions are
+     taken from topo only. */
+  checks = 0;
+  merged = 0;
+  for (i = 0; i < topo.size; ++i) {
+    Rbc_t* target;
+
+    map[i] = rbc_rebuild_vertex(rbcManager, &topo, i, map);
+
+    if (repr[i] == i || checks >= RBC_SWEEP_MAX_CHECKS) continue;
+
+    if (repr[i] == RBC_SWEEP_CONSTANT_CLASS) {
+      target = RbcId(rbcManager->zero,
+                     (phase[i] ? RBC_FALSE : RBC_TRUE));
+    }
+    else {
+      target = RbcId(map[repr[i]],
+                     ((phase[i] != phase[repr[i]]) ? RBC_FALSE : RBC_TRUE));
+    }
+
+    if (target == map[i]) continue;
+
+    ++checks;
+    if (check(rbcManager, map[i], target, checkData)) {
+      map[i] = target;
+      ++merged;
+    }
+  }
+
+  res = RbcId(map[topo.size - 1], RBC_EDGE_SIGN(f));
+
+  if (opt_verbose_level_gt(OptsHandler_get_instance(), 2)) {
+    fprintf(nusmv_stderr,
+            "Rbc: end of sweeping (%d vertices, %d checks, %d merged)\n",
+            topo.size, checks, merged);
+  }
+
+  st_free_table(classes);
+  FREE(map);
+  FREE(repr);
+  FREE(phase);
+  FREE(norm);
+  FREE(sims);
+  rbc_topo_deinit(&topo);
+
+  return res;
+}
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Collects the vertices of f in topological order]
+
+  Description [The iRef field of every vertex is set to its position]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void rbc_topo_init(RbcTopo* self, Rbc_t* f)
+{
+  Dag_DfsFunctions_t funcs;
+
+  self->size = 0;
+  self->capacity = 1024;
+  self->nodes = ALLOC(Rbc_t*, self->capacity);
+  self->sons = ALLOC(int, self->capacity * RBC_REWRITE_MAX_SONS);
+
+  funcs.Set        = rbc_topo_set;
+  funcs.FirstVisit = rbc_topo_first;
+  funcs.BackVisit  = rbc_topo_back;
+  funcs.LastVisit  = rbc_topo_last;
+
+  Dag_Dfs(f, &funcs, (char*) self);
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Releases the memory held by the topological order]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void rbc_topo_deinit(RbcTopo* self)
+{
+  FREE(self->sons);
+  FREE(self->nodes);
+  self->size = 0;
+  self->capacity = 0;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs functions for the topological sort]
+
+  Description [Every vertex is visited once]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int rbc_topo_set(Rbc_t* f, char* _data, nusmv_ptrint sign)
+{ return 0; }
+static void rbc_topo_first(Rbc_t* f, char* _data, nusmv_ptrint sign)
+{}
+static void rbc_topo_back(Rbc_t* f, char* _data, nusmv_ptrint sign)
+{}
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs LastVisit for the topological sort]
+
+  Description [Appends the vertex, whose sons have already been
+               appended]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void rbc_topo_last(Rbc_t* f, char* _data, nusmv_ptrint sign)
+{
+  RbcTopo* self = (RbcTopo*) _data;
+  int* sons;
+  unsigned s;
+
+  if (self->size == self->capacity) {
+    self->capacity *= 2;
+    self->nodes = REALLOC(Rbc_t*, self->nodes, self->capacity);
+    self->sons = REALLOC(int, self->sons,
+                         self->capacity * RBC_REWRITE_MAX_SONS);
+  }
+
+  sons = self->sons + self->size * RBC_REWRITE_MAX_SONS;
+  for (s = 0; s < RBC_REWRITE_MAX_SONS; ++s) sons[s] = -1;
+  if (f->outList != (Dag_Vertex_t**) NULL) {
+    nusmv_assert(f->numSons <= RBC_REWRITE_MAX_SONS);
+    for (s = 0; s < f->numSons; ++s) {
+      /* sons have already been visited */
+      sons[s] = (RBC_TOPO_INDEX(f->outList[s]) << 1) |
+        (RbcIsSet(f->outList[s]) ? 1 : 0);
+    }
+  }
+
+  f->iRef = self->size;
+  self->nodes[self->size++] = f;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Edges array private services]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void rbc_edges_init(RbcEdges* self)
+{
+  self->size = 0;
+  self->capacity = 16;
+  self->edges = ALLOC(Rbc_t*, self->capacity);
+}
+
+static void rbc_edges_deinit(RbcEdges* self)
+{
+  FREE(self->edges);
+  self->size = 0;
+  self->capacity = 0;
+}
+
+static void rbc_edges_push(RbcEdges* self, Rbc_t* e)
+{
+  if (self->size == self->capacity) {
+    self->capacity *= 2;
+    self->edges = REALLOC(Rbc_t*, self->edges, self->capacity);
+  }
+  self->edges[self->size++] = e;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Collects the conjuncts of the supergate rooted at v]
+
+  Description [The supergate is expanded through positive AND
+               vertices having a single father. The (annotated) edges
+               to the conjuncts are appended to leaves; stack is used
+               as working memory.]
+
+  SideEffects [leaves and stack are modified]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void rbc_collect_supergate(Rbc_t* v, const int* fanout,
+                                  RbcEdges* leaves, RbcEdges* stack)
+{
+  stack->size = 0;
+  rbc_edges_push(stack, v->outList[1]);
+  rbc_edges_push(stack, v->outList[0]);
+
+  while (stack->size > 0) {
+    Rbc_t* e = stack->edges[--stack->size];
+    Rbc_t* ref = RbcGetRef(e);
+
+    if (!RbcIsSet(e) && ref->symbol == RBCAND &&
+        fanout[RBC_TOPO_INDEX(ref)] == 1) {
+      rbc_edges_push(stack, ref->outList[1]);
+      rbc_edges_push(stack, ref->outList[0]);
+    }
+    else rbc_edges_push(leaves, e);
+  }
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Builds the conjunction of the given edges as a balanced
+               tree]
+
+  Description [The conjuncts are first simplified, then the two
+               shallowest ones are repeatedly joined. levels is used
+               to memoize the depth of the built vertices.]
+
+  SideEffects [conjuncts is sorted and modified]
+
+  SeeAlso     []
+
+******************************************************************************/
+static Rbc_t* rbc_build_balanced_and(Rbc_Manager_t* rbcm,
+                                     RbcEdges* conjuncts,
+                                     hash_ptr levels)
+{
+  heap h;
+  Rbc_t* res;
+  int i, n;
+
+  /* sorting puts duplicated and complemented conjuncts side by side */
+  qsort(conjuncts->edges, conjuncts->size, sizeof(Rbc_t*), rbc_edge_compare);
+
+  for (i = 0, n = 0; i < conjuncts->size; ++i) {
+    Rbc_t* e = conjuncts->edges[i];
+
+    if (e == rbcm->zero) return rbcm->zero;
+    if (e == rbcm->one) continue;
+
+    if (n > 0) {
+      Rbc_t* last = conjuncts->edges[n-1];
+      if (last == e) continue;
+      if (last == RbcId(e, RBC_FALSE)) return rbcm->zero;
+    }
+    conjuncts->edges[n++] = e;
+  }
+
+  if (n == 0) return rbcm->one;
+  if (n == 1) return conjuncts->edges[0];
+
+  /* the heap extracts the maximum, levels are thus negated */
+  h = heap_create();
+  for (i = 0; i < n; ++i) {
+    Rbc_t* e = conjuncts->edges[i];
+    heap_add(h, -(float) rbc_get_level(levels, e), (void*) e);
+  }
+
+  while (true) {
+    Rbc_t* a = (Rbc_t*) heap_getmax(h);
+    Rbc_t* b;
+
+    if (heap_isempty(h)) { res = a; break; }
+
+    b = (Rbc_t*) heap_getmax(h);
+    res = Rbc_MakeAnd(rbcm, a, b, RBC_TRUE);
+    heap_add(h, -(float) rbc_get_level(levels, res), (void*) res);
+  }
+
+  heap_destroy(h);
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the depth of the given formula]
+
+  Description [The depth of a vertex whose sons have not been
+               memoized yet is approximated by considering their depth
+               as zero.]
+
+  SideEffects [levels is updated]
+
+  SeeAlso     []
+
+******************************************************************************/
+static int rbc_get_level(hash_ptr levels, Rbc_t* f)
+{
+  Rbc_t* ref = RbcGetRef(f);
+  node_ptr lev = find_assoc(levels, (node_ptr) ref);
+  int res = 0;
+  unsigned s;
+
+  /* levels are stored shifted by one, as NULL means not found */
+  if (lev != Nil) return PTR_TO_INT(lev) - 1;
+
+  if (ref->outList != (Dag_Vertex_t**) NULL) {
+    for (s = 0; s < ref->numSons; ++s) {
+      node_ptr son_lev = find_assoc(levels,
+                                    (node_ptr) RbcGetRef(ref->outList[s]));
+      int l = (son_lev != Nil) ? PTR_TO_INT(son_lev) : 1;
+      if (l > res) res = l;
+    }
+  }
+
+  insert_assoc(levels, (node_ptr) ref, PTR_FROM_INT(node_ptr, res + 1));
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Compares two edges by address]
+
+  Description [Used to sort conjuncts]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int rbc_edge_compare(const void* a, const void* b)
+{
+  nusmv_ptrint ea = (nusmv_ptrint) *((Rbc_t* const*) a);
+  nusmv_ptrint eb = (nusmv_ptrint) *((Rbc_t* const*) b);
+
+  if (ea < eb) return -1;
+  if (ea > eb) return 1;
+  return 0;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Rebuilds a vertex from the rebuilt version of its sons]
+
+  Description [map holds the rebuilt version of the vertices that
+               precede the i-th vertex of topo]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static Rbc_t* rbc_rebuild_vertex(Rbc_Manager_t* rbcm, const RbcTopo* topo,
+                                 int i, Rbc_t** map)
+{
+  Rbc_t* v = topo->nodes[i];
+  Rbc_t* sons[RBC_REWRITE_MAX_SONS];
+  unsigned s;
+
+  if (v->outList == (Dag_Vertex_t**) NULL) return v;
+
+  for (s = 0; s < v->numSons; ++s) {
+    sons[s] = RBC_TOPO_MAPPED_SON(topo, map, i, s);
+  }
+
+  switch (v->symbol) {
+  case RBCAND: return Rbc_MakeAnd(rbcm, sons[0], sons[1], RBC_TRUE);
+  case RBCIFF: return Rbc_MakeIff(rbcm, sons[0], sons[1], RBC_TRUE);
+  case RBCITE: return Rbc_MakeIte(rbcm, sons[0], sons[1], sons[2], RBC_TRUE);
+  default: internal_error("rbc_rebuild_vertex: unknown RBC symbol");
+  }
+
+  return NIL(Rbc_t); /* unreachable */
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns a random unsigned long]
+
+  Description [All the bits of the returned word are random]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static unsigned long rbc_random_word()
+{
+  unsigned long res = 0;
+  int bits;
+
+  for (bits = 0; bits < (int) (sizeof(unsigned long) * 8); bits += 16) {
+    res = (res << 16) ^ ((unsigned long) utils_random() & 0xffffUL);
+  }
+  return res;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Signatures table private services]
+
+  Description [Signatures are arrays of rbc_sim_words unsigned longs]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int rbc_signature_compare(const char* s1, const char* s2)
+{
+  return memcmp(s1, s2, rbc_sim_words * sizeof(unsigned long));
+}
+
+static int rbc_signature_hash(char* s, int modulus)
+{
+  const unsigned long* sig = (const unsigned long*) s;
+  unsigned long h = 0;
+  int w;
+
+  for (w = 0; w < rbc_sim_words; ++w) h = h * 31 + sig[w];
+  return (int) (h % (unsigned long) modulus);
+}
@@ -0,0 +1,473 @@
+/**CFile***********************************************************************
+
+  FileName    [rbcTemplate.c]
+
+  PackageName [rbc]
+
+  Synopsis    [Precompiled templates for repeated logical substitutions]
+
+  Description [External functions included in this module:
+    <ul>
+    <li> <b>Rbc_TemplateCreate()</b> Compiles a formula into a template
+    <li> <b>Rbc_TemplateDestroy()</b> Releases a template
+    <li> <b>Rbc_TemplateLogicalShift()</b> Instantiates a template by
+         shifting its variables along an offset
+    <li> <b>Rbc_TemplateLogicalSubst()</b> Instantiates a template by
+         substituting its variables with variables
+    </ul>
+
+    A template is a compact array representation of a formula, where
+    vertices are sorted in topological order and variables are kept
+    at logical level. Instantiating a template performs a single
+    linear pass over the array, without any dfs nor memoization, and
+    is thus cheaper than Rbc_LogicalShift and Rbc_LogicalSubst when
+    the same formula has to be instantiated many times (for instance
+    at every step of an unrolling).]
+
+  SeeAlso     [rbcSubst.c]
+
+  Author      []
+
+  Copyright   [
+  This file is part of the ``rbc'' package of NuSMV version 2.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+
+#include "rbc/rbcInt.h"
+
+#include "utils/error.h"
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+static const unsigned int RBC_MAX_OUTDEGREE = 3;
+
+/*---------------------------------------------------------------------------*/
+/* Stucture declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/**Struct**********************************************************************
+
+  Synopsis    [A compiled formula]
+
+  Description [The vertices of the formula are stored in topological
+               order (every son preceding its fathers), the last one
+               being the root.
+
+               For each vertex, args holds RBC_MAX_OUTDEGREE
+               entries. For a variable, the first entry is its logical
+               index. For the other vertices, each entry encodes the
+               position of a son shifted left by one, the lowest bit
+               being the complementation bit of the edge (unused
+               entries are -1). If the whole formula is constant,
+               constant holds it and no vertex is stored.
+
+               res is working memory used by the instantiation
+               functions.]
+
+  SeeAlso     []
+
+******************************************************************************/
+struct RbcTemplate {
+  int size;
+  int capacity;
+  int* symbols;
+  int* args;
+  Rbc_t** res;
+  Rbc_t* constant; /* if not NIL, the template is the given constant */
+  int rootSign;
+};
+
+/**Struct**********************************************************************
+
+  Synopsis    [Data passed to the dfs compiling a template]
+
+  Description []
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct TemplateDfsData {
+  Rbc_Template_t* tmpl;
+  const int* phy2log;
+} TemplateDfsData_t;
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/**Macro***********************************************************************
+
+  Synopsis    [Instantiated version of the son encoded by code]
+
+  Description [Valid only when the son has already been instantiated]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+#define TEMPLATE_SON(t, code) \
+  RbcId((t)->res[(code) >> 1], (((code) & 1) ? RBC_FALSE : RBC_TRUE))
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static int TemplateSet ARGS((Rbc_t* f, char* templateData, nusmv_ptrint sign));
+static void TemplateFirst ARGS((Rbc_t* f, char* templateData,
+                                nusmv_ptrint sign));
+static void TemplateBack ARGS((Rbc_t* f, char* templateData,
+                               nusmv_ptrint sign));
+static void TemplateLast ARGS((Rbc_t* f, char* templateData,
+                               nusmv_ptrint sign));
+
+static Rbc_t* rbc_template_instantiate ARGS((Rbc_Manager_t* rbcManager,
+                                             Rbc_Template_t* self,
+                                             const int* subst, int shift,
+                                             const int* log2phy));
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of external functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Compiles the formula f into a template]
+
+  Description [phy2log maps the physical variable indices to the
+               logical ones. The returned template must be released
+               with Rbc_TemplateDestroy. It remains valid as long as
+               the logical indices of the variables of f do not
+               change.]
+
+  SideEffects [The user fields of the vertices of f are overwritten]
+
+  SeeAlso     [Rbc_TemplateDestroy, Rbc_TemplateLogicalShift,
+               Rbc_TemplateLogicalSubst]
+
+******************************************************************************/
+Rbc_Template_t* Rbc_TemplateCreate(Rbc_Manager_t* rbcManager, Rbc_t* f,
+                                   const int* phy2log)
+{
+  Dag_DfsFunctions_t templateFunctions;
+  TemplateDfsData_t templateData;
+  Rbc_Template_t* self = ALLOC(Rbc_Template_t, 1);
+  nusmv_assert(self != (Rbc_Template_t*) NULL);
+
+  self->size = 0;
+  self->capacity = 0;
+  self->symbols = (int*) NULL;
+  self->args = (int*) NULL;
+  self->res = (Rbc_t**) NULL;
+  self->constant = NIL(Rbc_t);
+  self->rootSign = RbcIsSet(f) ? 1 : 0;
+
+  /* lazy evaluation */
+  if (Rbc_IsConstant(rbcManager, f)) {
+    self->constant = f;
+    return self;
+  }
+
+  self->capacity = 64;
+  self->symbols = ALLOC(int, self->capacity);
+  self->args = ALLOC(int, self->capacity * RBC_MAX_OUTDEGREE);
+
+  /* Setting up the DFS. */
+  templateFunctions.Set        = TemplateSet;
+  templateFunctions.FirstVisit = TemplateFirst;
+  templateFunctions.BackVisit  = TemplateBack;
+  templateFunctions.LastVisit  = TemplateLast;
+
+  templateData.tmpl = self;
+  templateData.phy2log = phy2log;
+
+  /* Calling DFS on f. */
+  Dag_Dfs(f, &templateFunctions, (char*)(&templateData));
+
+  self->res = ALLOC(Rbc_t*, self->size);
+  return self;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Releases a template]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Rbc_TemplateCreate]
+
+******************************************************************************/
+void Rbc_TemplateDestroy(Rbc_Template_t* self)
+{
+  if (self->res != (Rbc_t**) NULL) FREE(self->res);
+  if (self->args != (int*) NULL) FREE(self->args);
+  if (self->symbols != (int*) NULL) FREE(self->symbols);
+  FREE(self);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Instantiates the template by shifting each variable
+               logical index of a certain amount]
+
+  Description [The result is the same as the one returned by
+               Rbc_LogicalShift on the formula the template has been
+               compiled from, i.e. every occurence of the variable
+               with logical index i is replaced with the variable with
+               physical index log2phy[i + shift].]
+
+  SideEffects [none]
+
+  SeeAlso     [Rbc_LogicalShift, Rbc_TemplateLogicalSubst]
+
+******************************************************************************/
+Rbc_t* Rbc_TemplateLogicalShift(Rbc_Manager_t* rbcManager,
+                                Rbc_Template_t* self,
+                                int shift, const int* log2phy)
+{
+  return rbc_template_instantiate(rbcManager, self, (const int*) NULL,
+                                  shift, log2phy);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Instantiates the template by substituting its variables
+               at logical level]
+
+  Description [The result is the same as the one returned by
+               Rbc_LogicalSubst on the formula the template has been
+               compiled from, i.e. every occurence of the variable
+               with logical index i is replaced with the variable with
+               physical index log2phy[subst[i]]. An internal error is
+               raised if subst[i] is RBC_INVALID_SUBST_VALUE.]
+
+  SideEffects [none]
+
+  SeeAlso     [Rbc_LogicalSubst, Rbc_TemplateLogicalShift]
+
+******************************************************************************/
+Rbc_t* Rbc_TemplateLogicalSubst(Rbc_Manager_t* rbcManager,
+                                Rbc_Template_t* self,
+                                const int* subst, const int* log2phy)
+{
+  nusmv_assert(subst != (const int*) NULL);
+  return rbc_template_instantiate(rbcManager, self, subst, 0, log2phy);
+}
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Instantiates the template]
+
+  Description [If subst is not NULL the logical index i of each
+               variable is replaced by subst[i], otherwise it is
+               replaced by i + shift.]
+
+  SideEffects [none]
+
+  SeeAlso     []
+
+******************************************************************************/
+static Rbc_t* rbc_template_instantiate(Rbc_Manager_t* rbcManager,
+                                       Rbc_Template_t* self,
+                                       const int* subst, int shift,
+                                       const int* log2phy)
+{
+  int i;
+
+  if (self->constant != NIL(Rbc_t)) return self->constant;
+
+  for (i = 0; i < self->size; ++i) {
+    const int* args = self->args + i * RBC_MAX_OUTDEGREE;
+
+    switch (self->symbols[i]) {
+    case RBCTOP:
+      self->res[i] = rbcManager->one;
+      break;
+
+    case RBCVAR:
+      {
+        int idx;
+        if (subst != (const int*) NULL) {
+          idx = subst[args[0]];
+          if (RBC_INVALID_SUBST_VALUE == idx) {
+            internal_error("%s: Tried to substitute an invalid index",
+                           __func__);
+          }
+        }
+        else idx = args[0] + shift;
+
+        self->res[i] = Rbc_GetIthVar(rbcManager, log2phy[idx]);
+        break;
+      }
+
+    case RBCAND:
+      self->res[i] = Rbc_MakeAnd(rbcManager,
+                                 TEMPLATE_SON(self, args[0]),
+                                 TEMPLATE_SON(self, args[1]), RBC_TRUE);
+      break;
+
+    case RBCIFF:
+      self->res[i] = Rbc_MakeIff(rbcManager,
+                                 TEMPLATE_SON(self, args[0]),
+                                 TEMPLATE_SON(self, args[1]), RBC_TRUE);
+      break;
+
+    case RBCITE:
+      self->res[i] = Rbc_MakeIte(rbcManager,
+                                 TEMPLATE_SON(self, args[0]),
+                                 TEMPLATE_SON(self, args[1]),
+                                 TEMPLATE_SON(self, args[2]), RBC_TRUE);
+      break;
+
+    default:
+      internal_error("rbc_template_instantiate: unknown RBC symbol");
+    }
+  }
+
+  return RbcId(self->res[self->size - 1],
+               (self->rootSign ? RBC_FALSE : RBC_TRUE));
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs Set for template compilation.]
+
+  Description [Dfs Set for template compilation.]
+
+  SideEffects [None]
+
+  SeeAlso     []
+
+******************************************************************************/
+static int TemplateSet(Rbc_t* f, char* templateData, nusmv_ptrint sign)
+{
+  /* All nodes should be visited once and only once. */
+  return (0);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs FirstVisit for template compilation.]
+
+  Description [Dfs FirstVisit for template compilation.]
+
+  SideEffects [None]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void TemplateFirst(Rbc_t* f, char* templateData, nusmv_ptrint sign)
+{
+  return;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs BackVisit for template compilation.]
+
+  Description [Dfs BackVisit for template compilation.]
+
+  SideEffects [None]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void TemplateBack(Rbc_t* f, char* templateData, nusmv_ptrint sign)
+{
+  return;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Dfs LastVisit for template compilation.]
+
+  Description [Appends the vertex to the template. As its sons have
+               already been appended, their position is found in their
+               iRef field.]
+
+  SideEffects [None]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void TemplateLast(Rbc_t* f, char* templateData, nusmv_ptrint sign)
+{
+  TemplateDfsData_t* td = (TemplateDfsData_t*) templateData;
+  Rbc_Template_t* self = td->tmpl;
+  int* args;
+  unsigned int s;
+
+  if (self->size == self->capacity) {
+    self->capacity *= 2;
+    self->symbols = REALLOC(int, self->symbols, self->capacity);
+    self->args = REALLOC(int, self->args,
+                         self->capacity * RBC_MAX_OUTDEGREE);
+  }
+
+  args = self->args + self->size * RBC_MAX_OUTDEGREE;
+  for (s = 0; s < RBC_MAX_OUTDEGREE; ++s) args[s] = -1;
+
+  if (f->symbol == RBCVAR) {
+    args[0] = td->phy2log[PTR_TO_INT(f->data)];
+  }
+  else if (f->symbol != RBCTOP) {
+    nusmv_assert(f->numSons <= RBC_MAX_OUTDEGREE);
+    for (s = 0; s < f->numSons; ++s) {
+      Rbc_t* son = f->outList[s];
+      args[s] = (RbcGetRef(son)->iRef << 1) | (RbcIsSet(son) ? 1 : 0);
+    }
+  }
+
+  self->symbols[self->size] = f->symbol;
+  f->iRef = self->size;
+  ++(self->size);
+}
@@ -22,6 +22,14 @@
    Then if a group is turn on, then just its negated ID is added temporary to
    the solver. If we want to turn the group off, the just its ID
    is added temporary to the solver.
+   Destroying a group adds its ID as a unit clause. Clauses of the group
+   and learned clauses depending on it are then satisfied at level 0, and
+   they are physically removed by simplifying the clause database every
+   sat_simplify_period destroyed groups (8 by default). Simplifying scans
+   the whole database, while a destroyed group usually holds the clauses
+   of a single problem, so the scan is paid once for several groups while
+   the number of dead clauses kept around stays bounded. Learned clauses
+   that do not depend on the destroyed groups are kept across groups.
   ]
 
   SeeAlso     []
@@ -55,6 +63,7 @@
 ******************************************************************************/
 
 #include "SatMinisat_private.h"
+#include "opt/opt.h"
 #include "utils/error.h"
 
 static char rcsid[] UTIL_UNUSED = "$Id: SatMinisat.c,v 1.1.2.5.2.1.6.12 2010-02-18 10:00:03 nusmv Exp $";
@@ -625,7 +634,10 @@ sat_minisat_create_group(const SatIncSolver_ptr solver)
   SatIncSolver_create_group) and all formulas in it. ]
 
   Description [Just adds to the solver a unit clause with positive literal
-  of a variable with index  equal to group id ]
+  of a variable with index  equal to group id. Every
+  sat_simplify_period destroyed groups the clause database is
+  simplified, so that the clauses of the destroyed groups (and the
+  learned clauses derived from them) are actually removed ]
 
   SideEffects []
 
@@ -659,6 +671,13 @@ sat_minisat_destroy_group(const SatIncSolver_ptr solver, SatSolverGroup group)
 #endif
   /* with new minisat interface it is not necessary to check
      the successfulness of adding a clause */
+
+  /* periodically get rid of the satisfied clauses */
+  if (++self->destroyedGroups >=
+      get_sat_simplify_period(OptsHandler_get_instance())) {
+    MiniSat_simplifyDB(self->minisatSolver);
+    self->destroyedGroups = 0;
+  }
 }
 
 /**Function********************************************************************
@@ -719,6 +738,7 @@ sat_minisat_move_to_permanent_and_destroy_group(const SatIncSolver_ptr solver,
   /* with new minisat interface it is not necessary to check
      the successfulness of adding a clause */
   MiniSat_simplifyDB(self->minisatSolver);
+  self->destroyedGroups = 0;
 }
 
 /**Function********************************************************************
@@ -1145,6 +1165,8 @@ void sat_minisat_init(SatMinisat_ptr self, const char* name,
   /* the exisiting (-1) permanent group is OK, since minisat always
      deals with variables greater then 0 */
 
+  self->destroyedGroups = 0;
+
   self->cnfVar2minisatVar = new_assoc();
   self->minisatVar2cnfVar = new_assoc();
 
@@ -86,6 +86,10 @@ typedef struct SatMinisat_TAG
 
   unsigned int minisatClauseSize;
   unsigned int minisat_itp_group;
+
+  /* number of groups destroyed since the clause database was last
+     simplified */
+  int destroyedGroups;
 } SatMinisat;
 
 /**AutomaticStart*************************************************************/
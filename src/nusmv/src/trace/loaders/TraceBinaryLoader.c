@@ -0,0 +1,681 @@
+/**CFile***********************************************************************
+
+  FileName    [TraceBinaryLoader.c]
+
+  PackageName [trace.loaders]
+
+  Synopsis    [Routines related to TraceBinaryLoader class]
+
+  Description [This file contains the definition of TraceBinaryLoader
+  class. The format read by this loader is described in
+  TraceBinaryDumper.c]
+
+  SeeAlso     [TraceBinaryDumper.c]
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``trace.loaders'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+#if HAVE_CONFIG_H
+# include "nusmv-config.h"
+#endif
+
+#include "utils/defs.h"
+
+#include "TraceBinaryLoader.h"
+#include "TraceBinaryLoader_private.h"
+#include "Trace_private.h"
+
+#include "parser/parser.h"
+#include "parser/symbols.h"
+
+#include <stdio.h>
+
+static char rcsid[] UTIL_UNUSED = "$Id: $";
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/* initial size of the table of strings */
+#define TRACE_BINARY_LOADER_STRINGS_SIZE 64
+
+/* maximal index of the first dumped step; the skipped steps are not
+   written in the file, so their number cannot be bounded by its size */
+#define TRACE_BINARY_LOADER_MAX_FIRST_STEP (1 << 24)
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+static void trace_binary_loader_finalize ARGS((Object_ptr object,
+                                               void* dummy));
+
+static void trace_binary_loader_prepare ARGS((TraceBinaryLoader_ptr self));
+
+static void trace_binary_loader_reset ARGS((TraceBinaryLoader_ptr self));
+
+static int trace_binary_loader_fill_trace ARGS((TraceBinaryLoader_ptr self));
+
+static boolean trace_binary_loader_read_int ARGS((TraceBinaryLoader_ptr self,
+                                                  unsigned long* value));
+
+static char* trace_binary_loader_read_string ARGS((TraceBinaryLoader_ptr self));
+
+static int trace_binary_loader_read_ref ARGS((TraceBinaryLoader_ptr self));
+
+static int trace_binary_loader_get_symbol ARGS((TraceBinaryLoader_ptr self,
+                                                int ref, node_ptr* symbol));
+
+static int trace_binary_loader_get_value ARGS((TraceBinaryLoader_ptr self,
+                                               int ref, node_ptr* value));
+
+/**Function********************************************************************
+
+  Synopsis    [Constructor]
+
+  Description [If halt_on_undefined_symbols is false, assignments to
+               symbols that are not in the language of the model are
+               reported and ignored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+TraceBinaryLoader_ptr TraceBinaryLoader_create(const char* filename,
+                                               boolean halt_on_undefined_symbols)
+{
+  TraceBinaryLoader_ptr self = ALLOC(TraceBinaryLoader, 1);
+
+  TRACE_BINARY_LOADER_CHECK_INSTANCE(self);
+
+  trace_binary_loader_init(self, filename, halt_on_undefined_symbols);
+  return self;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/*   Protected Methods                                                    */
+/* ---------------------------------------------------------------------- */
+
+/**Function********************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void trace_binary_loader_init(TraceBinaryLoader_ptr self,
+                              const char* filename,
+                              boolean halt_on_undefined_symbols)
+{
+  trace_loader_init(TRACE_LOADER(self), "TRACE BINARY LOADER");
+
+  self->filename = util_strsav((char*) filename);
+  self->halt_on_undefined_symbols = halt_on_undefined_symbols;
+
+  self->stream = NIL(FILE);
+  self->size = 0;
+  self->trace = TRACE(NULL);
+  self->strings = (char**) NULL;
+  self->symbols = (node_ptr*) NULL;
+  self->values = (node_ptr*) NULL;
+  self->strings_num = 0;
+  self->strings_size = 0;
+  self->undefined_symbols = (hash_ptr)(NULL);
+  self->loopback_states = NODE_LIST(NULL);
+
+  /* virtual methods overriding: */
+  OVERRIDE(Object, finalize) = trace_binary_loader_finalize;
+  OVERRIDE(TraceLoader, load) = trace_binary_loader_load;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Deallocates internal structures]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void trace_binary_loader_deinit(TraceBinaryLoader_ptr self)
+{
+  FREE(self->filename);
+
+  trace_loader_deinit(TRACE_LOADER(self));
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads the trace from the binary file]
+
+  Description [Returns a valid frozen trace, or NULL if the file could
+               not be read]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+Trace_ptr trace_binary_loader_load(TraceLoader_ptr loader,
+                                   const SymbTable_ptr st,
+                                   const NodeList_ptr symbols)
+{
+  const TraceBinaryLoader_ptr self = TRACE_BINARY_LOADER(loader);
+  Trace_ptr res;
+
+  nusmv_assert(TRACE(NULL) == self->trace);
+
+  self->stream = fopen(self->filename, "rb");
+  if (NIL(FILE) == self->stream) {
+    fprintf(loader->err, "Unable to open file '%s'\n", self->filename);
+    return TRACE(NULL);
+  }
+
+  if (0 != fseek(self->stream, 0L, SEEK_END) ||
+      (self->size = ftell(self->stream)) < 0 ||
+      0 != fseek(self->stream, 0L, SEEK_SET)) {
+    fprintf(loader->err, "Unable to read file '%s'\n", self->filename);
+    fclose(self->stream);
+    self->stream = NIL(FILE);
+    return TRACE(NULL);
+  }
+
+  trace_binary_loader_prepare(self);
+  self->trace = trace_create(st, "(no description available)",
+                             TRACE_TYPE_UNSPECIFIED, symbols, false);
+
+  CATCH {
+    if (0 != trace_binary_loader_fill_trace(self)) {
+      trace_destroy(self->trace); self->trace = TRACE(NULL);
+    }
+  }
+  FAIL {
+    trace_destroy(self->trace); self->trace = TRACE(NULL);
+  }
+
+  res = self->trace;
+  trace_binary_loader_reset(self);
+
+  /* traces produced by the binary trace loader are frozen */
+  nusmv_assert(TRACE(NULL) == res || trace_is_frozen(res));
+
+  return res;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/*     Private Methods                                                    */
+/* ---------------------------------------------------------------------- */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Virtual destructor]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void trace_binary_loader_finalize(Object_ptr object, void* dummy)
+{
+  TraceBinaryLoader_ptr self = TRACE_BINARY_LOADER(object);
+
+  trace_binary_loader_deinit(self);
+  FREE(self);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Allocates the structures used during a load]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [trace_binary_loader_reset]
+
+******************************************************************************/
+static void trace_binary_loader_prepare(TraceBinaryLoader_ptr self)
+{
+  self->strings_size = TRACE_BINARY_LOADER_STRINGS_SIZE;
+  self->strings_num = 0;
+  self->strings = ALLOC(char*, self->strings_size);
+  self->symbols = ALLOC(node_ptr, self->strings_size);
+  self->values = ALLOC(node_ptr, self->strings_size);
+  nusmv_assert((char**) NULL != self->strings);
+  nusmv_assert((node_ptr*) NULL != self->symbols);
+  nusmv_assert((node_ptr*) NULL != self->values);
+
+  self->undefined_symbols = new_assoc();
+  self->loopback_states = NodeList_create();
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Cleans up after a load]
+
+  Description [Closes the stream and frees the structures used during
+               the load. The loaded trace is left to the caller.]
+
+  SideEffects []
+
+  SeeAlso     [trace_binary_loader_prepare]
+
+******************************************************************************/
+static void trace_binary_loader_reset(TraceBinaryLoader_ptr self)
+{
+  int i;
+
+  for (i = 0; i < self->strings_num; ++i) FREE(self->strings[i]);
+  FREE(self->strings);
+  FREE(self->symbols);
+  FREE(self->values);
+  self->strings_num = 0;
+  self->strings_size = 0;
+
+  free_assoc(self->undefined_symbols);
+  self->undefined_symbols = (hash_ptr)(NULL);
+
+  NodeList_destroy(self->loopback_states);
+  self->loopback_states = NODE_LIST(NULL);
+
+  nusmv_assert(NIL(FILE) != self->stream);
+  fclose(self->stream);
+  self->stream = NIL(FILE);
+
+  self->trace = TRACE(NULL);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Fills self->trace with the content of the file]
+
+  Description [Returns 0 on success. On success, the trace is frozen and
+               its loopbacks are set.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int trace_binary_loader_fill_trace(TraceBinaryLoader_ptr self)
+{
+  const TraceLoader_ptr loader = TRACE_LOADER(self);
+  const size_t magic_len = strlen(TRACE_BINARY_MAGIC_STRING);
+  char magic[sizeof(TRACE_BINARY_MAGIC_STRING)];
+  unsigned long version, type, first, mark;
+  TraceIter step;
+  ListIter_ptr liter;
+  char* desc;
+  int time;
+
+  if (magic_len != fread(magic, sizeof(char), magic_len, self->stream) ||
+      0 != strncmp(magic, TRACE_BINARY_MAGIC_STRING, magic_len)) {
+    fprintf(loader->err, "File '%s' is not a binary trace\n",
+            self->filename);
+    return 1;
+  }
+
+  if (!trace_binary_loader_read_int(self, &version)) return 1;
+  if (TRACE_BINARY_VERSION != version) {
+    fprintf(loader->err, "Unsupported binary trace version %lu\n", version);
+    return 1;
+  }
+
+  if (!trace_binary_loader_read_int(self, &type)) return 1;
+  if (type < 1 || TRACE_TYPE_END < (int) type) {
+    fprintf(loader->err, "Invalid trace type %ld\n", (long) type - 1);
+    return 1;
+  }
+  trace_set_type(self->trace, (TraceType) ((int) type - 1));
+
+  desc = trace_binary_loader_read_string(self);
+  if ((char*) NULL == desc) return 1;
+  trace_set_desc(self->trace, desc);
+  FREE(desc);
+
+  /* moves to the first dumped step, leaving the previous ones empty */
+  if (!trace_binary_loader_read_int(self, &first)) return 1;
+  if (first < 1 || TRACE_BINARY_LOADER_MAX_FIRST_STEP < first) {
+    fprintf(loader->err, "Invalid first step %lu\n", first);
+    return 1;
+  }
+  step = trace_first_iter(self->trace);
+  for (time = 1; time < (int) first; ++time) {
+    step = trace_append_step(self->trace);
+  }
+
+  if (!trace_binary_loader_read_int(self, &mark)) return 1;
+  while (TRACE_BINARY_END_MARK != mark) {
+    int ref;
+
+    if (TRACE_BINARY_STEP_MARK != mark &&
+        TRACE_BINARY_LOOPBACK_MARK != mark) {
+      fprintf(loader->err, "Invalid step mark %lu at step %d\n", mark, time);
+      return 1;
+    }
+
+    if (TRACE_BINARY_LOOPBACK_MARK == mark) {
+      NodeList_append(self->loopback_states, NODE_FROM_INT(time));
+    }
+
+    /* assignments, up to the 0 reference */
+    ref = trace_binary_loader_read_ref(self);
+    while (0 < ref) {
+      node_ptr symbol, value;
+
+      if (0 != trace_binary_loader_get_symbol(self, ref, &symbol)) return 1;
+
+      ref = trace_binary_loader_read_ref(self);
+      if (ref <= 0) {
+        fprintf(loader->err, "Missing value at step %d\n", time);
+        return 1;
+      }
+      if (0 != trace_binary_loader_get_value(self, ref, &value)) return 1;
+
+      if (Nil == find_assoc(self->undefined_symbols, symbol) &&
+          !trace_step_put_value(self->trace, step, symbol, value)) {
+        return 1; /* put value reported a type error */
+      }
+
+      ref = trace_binary_loader_read_ref(self);
+    }
+    if (ref < 0) return 1;
+
+    if (!trace_binary_loader_read_int(self, &mark)) return 1;
+    if (TRACE_BINARY_END_MARK != mark) {
+      step = trace_append_step(self->trace);
+      ++ time;
+    }
+  }
+
+  /* store loopback information into the new trace and freeze it */
+  Trace_freeze(self->trace); /* loopbacks can be added only to frozen traces */
+  NODE_LIST_FOREACH(self->loopback_states, liter) {
+    TraceIter loop_iter = trace_ith_iter(self->trace,
+                NODE_TO_INT(NodeList_get_elem_at(self->loopback_states, liter)));
+
+    Trace_step_force_loopback(self->trace, loop_iter);
+  }
+
+  return 0;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads an unsigned LEB128 varint]
+
+  Description [Returns false, reporting the error, if the end of the file
+               is reached.]
+
+  SideEffects [The read integer is stored in value]
+
+  SeeAlso     [trace_binary_dumper_write_int]
+
+******************************************************************************/
+static boolean trace_binary_loader_read_int(TraceBinaryLoader_ptr self,
+                                            unsigned long* value)
+{
+  unsigned long res = 0;
+  int shift = 0;
+  int c;
+
+  do {
+    c = getc(self->stream);
+    if (EOF == c || shift >= (int) (8 * sizeof(unsigned long))) {
+      fprintf(TRACE_LOADER(self)->err,
+              "Unexpected end of binary trace file '%s'\n", self->filename);
+      return false;
+    }
+
+    res |= ((unsigned long) (c & 0x7f)) << shift;
+    shift += 7;
+  } while (c & 0x80);
+
+  *value = res;
+  return true;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads a length-prefixed string]
+
+  Description [Returns a newly allocated string, or NULL on error. The
+               length must fit in what is left of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static char* trace_binary_loader_read_string(TraceBinaryLoader_ptr self)
+{
+  unsigned long len;
+  long pos;
+  char* res;
+
+  if (!trace_binary_loader_read_int(self, &len)) return (char*) NULL;
+
+  pos = ftell(self->stream);
+  if (pos < 0 || (unsigned long) (self->size - pos) < len) {
+    fprintf(TRACE_LOADER(self)->err,
+            "Invalid string length %lu in binary trace file '%s'\n",
+            len, self->filename);
+    return (char*) NULL;
+  }
+
+  res = ALLOC(char, len + 1);
+  nusmv_assert((char*) NULL != res);
+
+  if (len != fread(res, sizeof(char), len, self->stream)) {
+    fprintf(TRACE_LOADER(self)->err,
+            "Unexpected end of binary trace file '%s'\n", self->filename);
+    FREE(res);
+    return (char*) NULL;
+  }
+
+  res[len] = '\0';
+  return res;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reads a reference to a symbol or a value]
+
+  Description [Returns the reference, 0 for the end of the assignments
+               of a step, or -1 on error. A reference to the next
+               string is followed by the string, which is added to the
+               table of strings.]
+
+  SideEffects [The table of strings may be extended]
+
+  SeeAlso     []
+
+******************************************************************************/
+static int trace_binary_loader_read_ref(TraceBinaryLoader_ptr self)
+{
+  unsigned long ref;
+
+  if (!trace_binary_loader_read_int(self, &ref)) return -1;
+
+  if ((unsigned long) self->strings_num + 1 == ref) {
+    char* str = trace_binary_loader_read_string(self);
+    if ((char*) NULL == str) return -1;
+
+    if (self->strings_num == self->strings_size) {
+      self->strings_size *= 2;
+      self->strings = REALLOC(char*, self->strings, self->strings_size);
+      self->symbols = REALLOC(node_ptr, self->symbols, self->strings_size);
+      self->values = REALLOC(node_ptr, self->values, self->strings_size);
+      nusmv_assert((char**) NULL != self->strings);
+      nusmv_assert((node_ptr*) NULL != self->symbols);
+      nusmv_assert((node_ptr*) NULL != self->values);
+    }
+
+    self->strings[self->strings_num] = str;
+    self->symbols[self->strings_num] = Nil;
+    self->values[self->strings_num] = Nil;
+    ++ self->strings_num;
+  }
+  else if ((unsigned long) self->strings_num < ref) {
+    fprintf(TRACE_LOADER(self)->err, "Invalid reference %lu\n", ref);
+    return -1;
+  }
+
+  return (int) ref;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the symbol of the string of the given reference]
+
+  Description [The string is parsed and flattened the first time only.
+               Undefined symbols are reported once; they are errors
+               if self->halt_on_undefined_symbols is set, and are
+               recorded in self->undefined_symbols otherwise. Returns
+               0 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int trace_binary_loader_get_symbol(TraceBinaryLoader_ptr self,
+                                          int ref, node_ptr* symbol)
+{
+  const TraceLoader_ptr loader = TRACE_LOADER(self);
+  const char* str = self->strings[ref - 1];
+  node_ptr parsed;
+
+  if (Nil != self->symbols[ref - 1]) {
+    *symbol = self->symbols[ref - 1];
+    return 0;
+  }
+
+  if (0 != Parser_ReadSimpExprFromString(str, &parsed)) {
+    fprintf(loader->err, "Unable to parse symbol '%s'\n", str);
+    return 1;
+  }
+  *symbol = trace_loader_flatten_symbol(cdar(parsed));
+  free_node(parsed);
+
+  if (!trace_symbol_in_language(self->trace, *symbol)) {
+    fprintf(loader->err, "%s: undefined symbol '",
+            (self->halt_on_undefined_symbols) ? "Error" : "Warning");
+    print_node(loader->err, *symbol);
+    fprintf(loader->err, "'.\n");
+
+    if (self->halt_on_undefined_symbols) return 1;
+    insert_assoc(self->undefined_symbols, *symbol, NODE_FROM_INT(true));
+  }
+
+  self->symbols[ref - 1] = *symbol;
+  return 0;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the value of the string of the given reference]
+
+  Description [The string is parsed and flattened the first time only.
+               Lists of values, written by the dumper for
+               non-deterministic assignments, are read as sets. Returns
+               0 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static int trace_binary_loader_get_value(TraceBinaryLoader_ptr self,
+                                         int ref, node_ptr* value)
+{
+  const char* str = self->strings[ref - 1];
+  node_ptr parsed;
+  int res;
+
+  if (Nil != self->values[ref - 1]) {
+    *value = self->values[ref - 1];
+    return 0;
+  }
+
+  /* see issue #1802 */
+  if (NIL(char) == strchr(str, ',')) {
+    res = Parser_ReadSimpExprFromString(str, &parsed);
+  }
+  else {
+    char* set = ALLOC(char, strlen(str) + 5);
+    nusmv_assert((char*) NULL != set);
+    sprintf(set, "{ %s }", str);
+    res = Parser_ReadSimpExprFromString(set, &parsed);
+    FREE(set);
+  }
+
+  if (0 != res) {
+    fprintf(TRACE_LOADER(self)->err, "Unable to parse value '%s'\n", str);
+    return 1;
+  }
+
+  *value = node_normalize(Compile_FlattenSexp(trace_get_symb_table(self->trace),
+                                              cdar(parsed), Nil));
+  free_node(parsed);
+
+  self->values[ref - 1] = *value;
+  return 0;
+}
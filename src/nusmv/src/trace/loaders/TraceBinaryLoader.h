@@ -0,0 +1,80 @@
+/**CHeaderFile*****************************************************************
+
+  FileName    [TraceBinaryLoader.h]
+
+  PackageName [trace.loaders]
+
+  Synopsis    [The header file for the TraceBinaryLoader class]
+
+  Description [This loader reads traces dumped by the TraceBinaryDumper
+               plugin. Unlike the XML loader, it does not need the
+               expat library.]
+
+  SeeAlso     [TraceBinaryDumper.h]
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``trace.loaders'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+#ifndef __TRACE_BINARY_LOADER_H
+#define __TRACE_BINARY_LOADER_H
+
+#if HAVE_CONFIG_H
+# include "nusmv-config.h"
+#endif
+
+#include "TraceLoader.h"
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+typedef struct TraceBinaryLoader_TAG* TraceBinaryLoader_ptr;
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+#define TRACE_BINARY_LOADER(x) \
+         ((TraceBinaryLoader_ptr) x)
+
+#define TRACE_BINARY_LOADER_CHECK_INSTANCE(x) \
+         (nusmv_assert(TRACE_BINARY_LOADER(x) != TRACE_BINARY_LOADER(NULL)))
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Function prototypes                                                       */
+/*---------------------------------------------------------------------------*/
+EXTERN TraceBinaryLoader_ptr
+TraceBinaryLoader_create ARGS((const char* filename,
+                               boolean halt_on_undefined_symbols));
+
+/**AutomaticEnd***************************************************************/
+
+#endif /* __TRACE_BINARY_LOADER_H */
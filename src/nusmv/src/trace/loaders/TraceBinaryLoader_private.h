@@ -0,0 +1,112 @@
+/**CHeaderFile*****************************************************************
+
+  FileName    [TraceBinaryLoader_private.h]
+
+  PackageName [trace.loaders]
+
+  Synopsis    [The private header file for the TraceBinaryLoader class]
+
+  Description []
+
+  SeeAlso     []
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``trace.loaders'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+#ifndef __TRACE_BINARY_LOADER_PRIVATE_H
+#define __TRACE_BINARY_LOADER_PRIVATE_H
+
+#if HAVE_CONFIG_H
+# include "nusmv-config.h"
+#endif
+
+#include "pkg_traceInt.h"
+#include "TraceLoader_private.h"
+
+#include "TraceBinaryLoader.h"
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/**Struct**********************************************************************
+
+  Synopsis    [TraceBinaryLoader Class]
+
+  Description [Each distinct symbol and value of the file is parsed
+               once, the first time it is used.]
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct TraceBinaryLoader_TAG
+{
+  INHERITS_FROM(TraceLoader);
+
+  char* filename;
+  boolean halt_on_undefined_symbols;
+
+  /* the following fields are only valid during a load */
+  FILE* stream;
+  long size; /* the size of the file, that bounds the read strings */
+  Trace_ptr trace;
+
+  /* the strings read so far, and the symbols and values they were
+     parsed into (Nil if not parsed yet) */
+  char** strings;
+  node_ptr* symbols;
+  node_ptr* values;
+  int strings_num;
+  int strings_size;
+
+  hash_ptr undefined_symbols;
+  NodeList_ptr loopback_states;
+
+} TraceBinaryLoader;
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Function prototypes                                                       */
+/*---------------------------------------------------------------------------*/
+void trace_binary_loader_init ARGS((TraceBinaryLoader_ptr self,
+                                    const char* filename,
+                                    boolean halt_on_undefined_symbols));
+
+void trace_binary_loader_deinit ARGS((TraceBinaryLoader_ptr self));
+
+Trace_ptr trace_binary_loader_load ARGS((TraceLoader_ptr self,
+                                         const SymbTable_ptr st,
+                                         const NodeList_ptr symbols));
+
+/**AutomaticEnd***************************************************************/
+
+#endif /* __TRACE_BINARY_LOADER_PRIVATE_H */
@@ -44,6 +44,7 @@
 #include "TraceLoader_private.h"
 
 #include "compile/compile.h"
+#include "fsm/sexp/Expr.h"
 #include "parser/symbols.h"
 
 static char rcsid[] UTIL_UNUSED = "$Id: $";
@@ -167,6 +168,50 @@ void trace_loader_deinit(TraceLoader_ptr self)
   object_deinit(OBJECT(self));
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Flattens a symbol read by a loader]
+
+  Description [Returns the flattened form of the given parsed
+               symbol. Compile_FlattenSexp cannot be used here, to
+               avoid the rewriting of arrays (see issue #1243, note
+               2064).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+node_ptr trace_loader_flatten_symbol(node_ptr symbol)
+{
+  int op;
+
+  op = node_get_type(symbol);
+  if (op == DOT && car(symbol) == Nil) {
+    return node_normalize(find_node(DOT, Nil, cdr(symbol)));
+  }
+
+  if (op == ATOM) {
+    return node_normalize(find_node(DOT, Nil, symbol));
+  }
+
+  if (op == ARRAY) {
+    nusmv_assert(Nil != cdr(symbol));
+
+    /* Indexes in array are not parsed correctly: The unary minus node
+       is left (e.g. UMINUS NUMBER <positive_number>) instead of
+       having NUMBER <negative_number>. Fix the tree here */
+    if (UMINUS == node_get_type(cdr(symbol))) {
+      symbol = find_node(op, car(symbol),
+                         Expr_unary_minus(car(cdr(symbol))));
+    }
+  }
+
+  return find_node(op,
+                   trace_loader_flatten_symbol(car(symbol)),
+                   node_normalize(cdr(symbol)));
+}
+
 /*---------------------------------------------------------------------------*/
 /* Static functions                                                          */
 /*---------------------------------------------------------------------------*/
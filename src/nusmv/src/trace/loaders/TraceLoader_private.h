@@ -89,6 +89,8 @@ EXTERN void trace_loader_init ARGS((TraceLoader_ptr self, char* desc));
 
 EXTERN void trace_loader_deinit ARGS((TraceLoader_ptr self));
 
+EXTERN node_ptr trace_loader_flatten_symbol ARGS((node_ptr symbol));
+
 EXTERN Trace_ptr trace_loader_load ARGS((TraceLoader_ptr self,
                                          const SymbTable_ptr st,
                                          const NodeList_ptr symbols));
@@ -118,9 +118,6 @@ trace_xml_report_invalid_assignment ARGS((TraceXmlLoader_ptr self,
 static inline int
 trace_xml_load_put_expr ARGS((TraceXmlLoader_ptr self, node_ptr eq));
 
-static inline node_ptr
-trace_xml_loader_flatten_symbol ARGS((node_ptr symbol));
-
 static void trace_xml_loader_store_loopbacks ARGS((TraceXmlLoader_ptr self));
 
 /**Function********************************************************************
@@ -695,7 +692,7 @@ static inline int trace_xml_load_put_expr(TraceXmlLoader_ptr self, node_ptr eq)
 
   /* here Compile_FlattenSexp cannot be used, because we need */
   /* to avoid rewriting for arrays (see issue #1243, note 2064) */
-  symb = trace_xml_loader_flatten_symbol(car(eq));
+  symb = trace_loader_flatten_symbol(car(eq));
   value = node_normalize(Compile_FlattenSexp(st, cdr(eq), Nil));
 
   if (trace_symbol_fwd_lookup(self->trace, symb, &section, &dummy)) {
@@ -795,49 +792,6 @@ static void trace_xml_loader_char_handler(TraceXmlLoader_ptr self,
 }
 
 
-/**Function********************************************************************
-
-  Synopsis           [Private service of trace_xml_loader_fill_trace]
-
-  Description        [Private service of trace_xml_loader_fill_trace]
-
-  SideEffects        []
-
-  SeeAlso            [trace_xml_loader_fill_trace]
-
-******************************************************************************/
-static inline node_ptr
-trace_xml_loader_flatten_symbol(node_ptr symbol)
-{
-  int op;
-
-  op = node_get_type(symbol);
-  if (op == DOT && car(symbol) == Nil) {
-    return node_normalize(find_node(DOT, Nil, cdr(symbol)));
-  }
-
-  if (op == ATOM) {
-    return node_normalize(find_node(DOT, Nil, symbol));
-  }
-
-  if (op == ARRAY) {
-    nusmv_assert(Nil != cdr(symbol));
-
-    /* Indexes in array are not parsed correctly: The unary minus node
-       is left (e.g. UMINUS NUMBER <positive_number>) instead of
-       having NUMBER <negative_number>. Fix the tree here */
-    if (UMINUS == node_get_type(cdr(symbol))) {
-      symbol = find_node(op, car(symbol),
-                         Expr_unary_minus(car(cdr(symbol))));
-    }
-  }
-
-  return find_node(op,
-                   trace_xml_loader_flatten_symbol(car(symbol)),
-                   node_normalize(cdr(symbol)));
-}
-
-
 /**Function********************************************************************
 
   Synopsis    [This function reports an error/warning message when LHS of
@@ -58,6 +58,14 @@
 /* Constant declarations                                                     */
 /*---------------------------------------------------------------------------*/
 
+/* binary trace format, see TraceBinaryDumper and TraceBinaryLoader */
+#define TRACE_BINARY_MAGIC_STRING "NuSMVTRC"
+#define TRACE_BINARY_VERSION 1
+
+#define TRACE_BINARY_END_MARK      0
+#define TRACE_BINARY_STEP_MARK     1
+#define TRACE_BINARY_LOOPBACK_MARK 2
+
 /*---------------------------------------------------------------------------*/
 /* Type declarations                                                         */
 /*---------------------------------------------------------------------------*/
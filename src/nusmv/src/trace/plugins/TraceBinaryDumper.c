@@ -0,0 +1,443 @@
+/**CFile***********************************************************************
+
+  FileName    [TraceBinaryDumper.c]
+
+  PackageName [trace.plugins]
+
+  Synopsis    [Routines related to TraceBinaryDumper class]
+
+  Description [This file contains the definition of TraceBinaryDumper
+  class.
+
+  The binary format is a compact alternative to the XML format, meant
+  for long traces. All integers are written as unsigned LEB128
+  varints, and strings as their length followed by their characters.
+  A dump is made of:
+  <ul>
+  <li> the TRACE_BINARY_MAGIC_STRING header and the
+       TRACE_BINARY_VERSION of the format;
+  <li> the type of the trace, plus one, and its description;
+  <li> the index of the first dumped step;
+  <li> for each step, TRACE_BINARY_STEP_MARK, or
+       TRACE_BINARY_LOOPBACK_MARK for loopback steps, followed by the
+       assignments of the step (combinatorials, inputs, then state) and
+       a 0;
+  <li> TRACE_BINARY_END_MARK.
+  </ul>
+  An assignment is a pair of references to a symbol and a value.
+  Symbols and values are written once, when first referred to: each
+  reference is a positive index, and the index following the last
+  written one is immediately followed by the string it defines.]
+
+  SeeAlso     [TraceBinaryLoader.c]
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``trace.plugins'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+
+#include "TraceBinaryDumper.h"
+#include "TraceBinaryDumper_private.h"
+#include "trace/Trace_private.h"
+
+#include "compile/symb_table/SymbTable.h"
+#include "parser/symbols.h"
+
+static char rcsid[] UTIL_UNUSED = "$Id: $";
+
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static void trace_binary_dumper_finalize ARGS((Object_ptr object,
+                                               void* dummy));
+
+static void trace_binary_dumper_write_int ARGS((FILE* out,
+                                                unsigned long value));
+
+static void trace_binary_dumper_write_string ARGS((FILE* out,
+                                                   const char* str));
+
+static void trace_binary_dumper_write_ref ARGS((TraceBinaryDumper_ptr self,
+                                                node_ptr expr));
+
+static char* trace_binary_dumper_sprint ARGS((TraceBinaryDumper_ptr self,
+                                              node_ptr expr));
+
+/*---------------------------------------------------------------------------*/
+/* Definition of external functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Action method associated with TraceBinaryDumper class.]
+
+  Description [Given trace is written into the file pointed by
+  given additional parameter]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int trace_binary_dumper_action(TracePlugin_ptr plugin)
+{
+  const TraceBinaryDumper_ptr self = TRACE_BINARY_DUMPER(plugin);
+  const Trace_ptr trace = plugin->trace;
+  TraceIter start_iter;
+  TraceIter stop_iter;
+  TraceIter step;
+  TraceIteratorType input_iter_type;
+  TraceIteratorType state_iter_type;
+  TraceIteratorType combo_iter_type;
+  const char* desc;
+
+  FILE* out = TraceOpt_output_stream(plugin->opt);
+
+  start_iter = (0 != TraceOpt_from_here(plugin->opt))
+    ? trace_ith_iter(trace, TraceOpt_from_here(plugin->opt))
+    : trace_first_iter(trace);
+
+  /* safe way to skip one more step */
+  stop_iter =
+    (0 != TraceOpt_to_here(plugin->opt))
+    ? trace_ith_iter(trace, 1 + TraceOpt_to_here(plugin->opt))
+    : TRACE_END_ITER;
+
+  input_iter_type = TraceOpt_show_defines(plugin->opt)
+    ? TRACE_ITER_I_SYMBOLS : TRACE_ITER_I_VARS;
+
+  state_iter_type = TraceOpt_show_defines(plugin->opt)
+    ? TRACE_ITER_SF_SYMBOLS : TRACE_ITER_SF_VARS;
+
+  combo_iter_type = TraceOpt_show_defines(plugin->opt)
+    ? TRACE_ITER_COMBINATORIAL : TRACE_ITER_NONE;
+
+  self->refs = new_assoc();
+  self->refs_num = 0;
+
+  desc = Trace_get_desc(trace);
+
+  fputs(TRACE_BINARY_MAGIC_STRING, out);
+  trace_binary_dumper_write_int(out, TRACE_BINARY_VERSION);
+  trace_binary_dumper_write_int(out, 1 + Trace_get_type(trace));
+  trace_binary_dumper_write_string(out, (const char*) NULL != desc
+                                   ? desc : "");
+  trace_binary_dumper_write_int(out, MAX(1, TraceOpt_from_here(plugin->opt)));
+
+  step = start_iter;
+  while (stop_iter != step) {
+    TraceStepIter iter;
+    node_ptr symb, val;
+
+    /* lazy defines evaluation */
+    if (TraceOpt_show_defines(plugin->opt)) {
+      trace_step_evaluate_defines(trace, step);
+    }
+
+    trace_binary_dumper_write_int(out, Trace_step_is_loopback(trace, step)
+                                  ? TRACE_BINARY_LOOPBACK_MARK
+                                  : TRACE_BINARY_STEP_MARK);
+
+    TRACE_STEP_FOREACH(trace, step, combo_iter_type, iter, symb, val) {
+      /* skip non-visible symbols */
+      if (!trace_plugin_is_visible_symbol(plugin, symb)) continue;
+
+      TracePlugin_print_assignment(plugin, symb, val);
+    } /* foreach COMBINATORIAL */
+
+    TRACE_STEP_FOREACH(trace, step, input_iter_type, iter, symb, val) {
+      /* skip non-visible symbols */
+      if (!trace_plugin_is_visible_symbol(plugin, symb)) continue;
+
+      TracePlugin_print_assignment(plugin, symb, val);
+    } /* foreach INPUT */
+
+    TRACE_STEP_FOREACH(trace, step, state_iter_type, iter, symb, val) {
+      /* skip non-visible symbols */
+      if (!trace_plugin_is_visible_symbol(plugin, symb)) continue;
+
+      TracePlugin_print_assignment(plugin, symb, val);
+    } /* foreach SF_SYMBOLS */
+
+    /* end of the assignments of the step */
+    trace_binary_dumper_write_int(out, 0);
+
+    step = TraceIter_get_next(step);
+  }
+
+  trace_binary_dumper_write_int(out, TRACE_BINARY_END_MARK);
+
+  free_assoc(self->refs);
+  self->refs = (hash_ptr)(NULL);
+
+  return ferror(out) ? 1 : 0;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Creates a binary plugin for dumping and initializes it.]
+
+  Description [Binary plugin constructor. Using this plugin, a trace can
+               be dumped to file in a compact binary format, that can
+               be read back with read_trace -b]
+
+  SideEffects []
+
+  SeeAlso     [TraceBinaryLoader_create]
+
+******************************************************************************/
+TraceBinaryDumper_ptr TraceBinaryDumper_create()
+{
+  TraceBinaryDumper_ptr self = ALLOC(TraceBinaryDumper, 1);
+
+  TRACE_BINARY_DUMPER_CHECK_INSTANCE(self);
+
+  trace_binary_dumper_init(self);
+  return self;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/*     Protected Methods                                                  */
+/* ---------------------------------------------------------------------- */
+
+void trace_binary_dumper_print_assignment(TracePlugin_ptr self,
+                                          node_ptr symb, node_ptr val)
+{
+  trace_binary_dumper_write_ref(TRACE_BINARY_DUMPER(self), symb);
+  trace_binary_dumper_write_ref(TRACE_BINARY_DUMPER(self), val);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Class initializer]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void trace_binary_dumper_init(TraceBinaryDumper_ptr self)
+{
+  trace_plugin_init(TRACE_PLUGIN(self), "TRACE BINARY DUMP PLUGIN");
+
+  self->refs = (hash_ptr)(NULL);
+  self->refs_num = 0;
+
+  /* virtual methods overriding: */
+  OVERRIDE(Object, finalize) = trace_binary_dumper_finalize;
+  OVERRIDE(TracePlugin, action) = trace_binary_dumper_action;
+  OVERRIDE(TracePlugin, print_assignment) = \
+    trace_binary_dumper_print_assignment;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Deinitializes the TraceBinaryDumper Plugin object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void trace_binary_dumper_deinit(TraceBinaryDumper_ptr self)
+{
+  trace_plugin_deinit(TRACE_PLUGIN(self));
+}
+
+
+
+/* ---------------------------------------------------------------------- */
+/*     Private Methods                                                    */
+/* ---------------------------------------------------------------------- */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Plugin finalize method.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void trace_binary_dumper_finalize(Object_ptr object, void* dummy)
+{
+  TraceBinaryDumper_ptr self = TRACE_BINARY_DUMPER(object);
+
+  trace_binary_dumper_deinit(self);
+  FREE(self);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Writes value as an unsigned LEB128 varint]
+
+  Description [Seven bits are written per byte, least significant
+               first; the high bit is set on all bytes but the last.]
+
+  SideEffects []
+
+  SeeAlso     [trace_binary_loader_read_int]
+
+******************************************************************************/
+static void trace_binary_dumper_write_int(FILE* out, unsigned long value)
+{
+  while (value >= 0x80) {
+    fputc((int) ((value & 0x7f) | 0x80), out);
+    value >>= 7;
+  }
+  fputc((int) value, out);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Writes the length of str followed by its characters]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void trace_binary_dumper_write_string(FILE* out, const char* str)
+{
+  size_t len = strlen(str);
+
+  trace_binary_dumper_write_int(out, (unsigned long) len);
+  fwrite(str, sizeof(char), len, out);
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Writes a reference to the given symbol or value]
+
+  Description [If expr was not written yet by the current action, it
+               gets the next index, and its representation is written
+               right after the reference.]
+
+  SideEffects [self->refs and self->refs_num may be updated]
+
+  SeeAlso     []
+
+******************************************************************************/
+static void trace_binary_dumper_write_ref(TraceBinaryDumper_ptr self,
+                                          node_ptr expr)
+{
+  FILE* out = TraceOpt_output_stream(TRACE_PLUGIN(self)->opt);
+  int ref;
+
+  nusmv_assert((hash_ptr)(NULL) != self->refs);
+
+  ref = NODE_TO_INT(find_assoc(self->refs, expr));
+  if (0 != ref) {
+    trace_binary_dumper_write_int(out, (unsigned long) ref);
+  }
+  else {
+    char* repr = trace_binary_dumper_sprint(self, expr);
+
+    ref = ++ self->refs_num;
+    insert_assoc(self->refs, expr, NODE_FROM_INT(ref));
+
+    trace_binary_dumper_write_int(out, (unsigned long) ref);
+    trace_binary_dumper_write_string(out, repr);
+    FREE(repr);
+  }
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the representation of the given symbol or value]
+
+  Description [The representation is obfuscated if required. Lists of
+               values (UNION) are joined with ", ", as
+               TracePlugin_print_list does. The returned string must
+               be freed by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static char* trace_binary_dumper_sprint(TraceBinaryDumper_ptr self,
+                                        node_ptr expr)
+{
+  const TracePlugin_ptr plugin = TRACE_PLUGIN(self);
+  char* res;
+
+  if (Nil != expr && UNION == node_get_type(expr)) {
+    char* head = trace_binary_dumper_sprint(self, car(expr));
+    char* tail = trace_binary_dumper_sprint(self, cdr(expr));
+
+    res = ALLOC(char, strlen(head) + strlen(tail) + 3);
+    nusmv_assert((char*) NULL != res);
+    sprintf(res, "%s, %s", head, tail);
+
+    FREE(head);
+    FREE(tail);
+  }
+  else {
+    res = sprint_node((hash_ptr)(NULL) != plugin->obfuscation_map
+                      ? Compile_obfuscate_expression(
+                                 trace_get_symb_table(plugin->trace),
+                                 expr, plugin->obfuscation_map)
+                      : expr);
+  }
+
+  return res;
+}
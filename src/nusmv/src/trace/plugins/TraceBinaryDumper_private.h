@@ -0,0 +1,99 @@
+/**CHeaderFile*****************************************************************
+
+  FileName    [TraceBinaryDumper_private.h]
+
+  PackageName [trace.plugins]
+
+  Synopsis    [The private header file for the TraceBinaryDumper class.]
+
+  Description []
+
+  SeeAlso     []
+
+  Author      [Simon Busard]
+
+  Copyright   [
+  This file is part of the ``trace.plugins'' package of NuSMV version 2.
+  Copyright (C) 2013 by Simon Busard.
+
+  NuSMV version 2 is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  NuSMV version 2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA.
+
+  For more information on NuSMV see <http://nusmv.fbk.eu>
+  or email to <nusmv-users@fbk.eu>.
+  Please report bugs to <nusmv-users@fbk.eu>.
+
+  To contact the NuSMV development board, email to <nusmv@fbk.eu>. ]
+
+******************************************************************************/
+#ifndef __TRACE_BINARY_DUMPER_PRIVATE__H
+#define __TRACE_BINARY_DUMPER_PRIVATE__H
+
+#if HAVE_CONFIG_H
+# include "nusmv-config.h"
+#endif
+
+#include "pkg_traceInt.h"
+#include "TracePlugin_private.h"
+
+#include "TraceBinaryDumper.h"
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/**Struct**********************************************************************
+
+  Synopsis    [This is a plugin that dumps a compact binary representation
+               of a trace]
+
+  Description [Symbols and values are written once, the first time they
+               appear in the trace, and are referred to by their index
+               afterwards.]
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct TraceBinaryDumper_TAG
+{
+  INHERITS_FROM(TracePlugin);
+
+  /* indexes (starting at 1) of the symbols and values already written
+     by the current action */
+  hash_ptr refs;
+  int refs_num;
+
+} TraceBinaryDumper;
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Function prototypes                                                       */
+/*---------------------------------------------------------------------------*/
+void trace_binary_dumper_init ARGS((TraceBinaryDumper_ptr self));
+
+void trace_binary_dumper_deinit ARGS((TraceBinaryDumper_ptr self));
+
+int trace_binary_dumper_action ARGS((TracePlugin_ptr plugin));
+
+void trace_binary_dumper_print_assignment ARGS((TracePlugin_ptr self,
+                                                node_ptr symb, node_ptr val));
+
+/**AutomaticEnd***************************************************************/
+
+#endif /* __TRACE_BINARY_DUMPER_PRIVATE__H */
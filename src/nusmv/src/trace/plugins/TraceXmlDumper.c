@@ -73,6 +73,12 @@ static const char* TRACE_XML_VERSION_INFO_STRING =      \
 
 static void trace_xml_dumper_finalize ARGS((Object_ptr object, void* dummy));
 
+static const char*
+trace_xml_dumper_get_repr ARGS((TraceXmlDumper_ptr self, node_ptr expr));
+
+static enum st_retval
+trace_xml_dumper_free_repr ARGS((char* key, char* data, char* arg));
+
 /*---------------------------------------------------------------------------*/
 /* Definition of external functions                                          */
 /*---------------------------------------------------------------------------*/
@@ -107,6 +113,9 @@ int trace_xml_dumper_action(TracePlugin_ptr self)
 
   boolean first_node = true;
 
+  /* symbols and values are escaped once per action */
+  TRACE_XML_DUMPER(self)->reprs = new_assoc();
+
   start_iter = (0 != TraceOpt_from_here(self->opt))
     ? trace_ith_iter(trace, TraceOpt_from_here(self->opt))
     : trace_first_iter(trace);
@@ -127,9 +136,10 @@ int trace_xml_dumper_action(TracePlugin_ptr self)
     ? TRACE_ITER_COMBINATORIAL : TRACE_ITER_NONE;
 
   fprintf(out,"%s\n", TRACE_XML_VERSION_INFO_STRING);
-  fprintf(out,"<%s type=\"%d\" desc=\"%s\" >\n",
-          TRACE_XML_CNTX_TAG_STRING, Trace_get_type(trace),
-          Trace_get_desc(trace));
+  fprintf(out,"<%s type=\"%d\" desc=\"",
+          TRACE_XML_CNTX_TAG_STRING, Trace_get_type(trace));
+  Utils_str_escape_xml_file(Trace_get_desc(trace), out);
+  fprintf(out, "\" >\n");
 
   first_node = true;
   i = MAX(1, TraceOpt_from_here(self->opt)); step = start_iter;
@@ -231,6 +241,11 @@ int trace_xml_dumper_action(TracePlugin_ptr self)
 
   NodeList_destroy(loops);
 
+  clear_assoc_and_free_entries(TRACE_XML_DUMPER(self)->reprs,
+                               trace_xml_dumper_free_repr);
+  free_assoc(TRACE_XML_DUMPER(self)->reprs);
+  TRACE_XML_DUMPER(self)->reprs = (hash_ptr)(NULL);
+
   return 0;
 }
 
@@ -264,30 +279,23 @@ TraceXmlDumper_ptr TraceXmlDumper_create()
 
 void trace_xml_dumper_print_symbol(TracePlugin_ptr self, node_ptr symb)
 {
-  const SymbTable_ptr st = trace_get_symb_table(self->trace);
   FILE* out = TraceOpt_output_stream(self->opt);
-  char* symb_repr = \
-    sprint_node((hash_ptr)(NULL) != self->obfuscation_map
-                ? Compile_obfuscate_expression(st, symb, self->obfuscation_map)
-                : symb);
-
-  /* substituting XML entities */
-  Utils_str_escape_xml_file(symb_repr, out);
-  FREE(symb_repr);
+
+  fputs(trace_xml_dumper_get_repr(TRACE_XML_DUMPER(self), symb), out);
 }
 
 void trace_xml_dumper_print_assignment(TracePlugin_ptr self,
                                        node_ptr symb, node_ptr val)
 {
+  TraceXmlDumper_ptr dumper = TRACE_XML_DUMPER(self);
   FILE* out = TraceOpt_output_stream(self->opt);
 
-  fprintf(out, "\t\t\t<%s variable=\"", TRACE_XML_VALUE_TAG_STRING);
-
-  TracePlugin_print_symbol(self, symb);
-  fprintf(out, "\">");
-
-  TracePlugin_print_list(self, val);
-  fprintf(out, "</%s>\n", TRACE_XML_VALUE_TAG_STRING);
+  /* the whole assignment is formatted at once */
+  fprintf(out, "\t\t\t<%s variable=\"%s\">%s</%s>\n",
+          TRACE_XML_VALUE_TAG_STRING,
+          trace_xml_dumper_get_repr(dumper, symb),
+          trace_xml_dumper_get_repr(dumper, val),
+          TRACE_XML_VALUE_TAG_STRING);
 }
 
 
@@ -306,6 +314,8 @@ void trace_xml_dumper_init(TraceXmlDumper_ptr self)
 {
   trace_plugin_init(TRACE_PLUGIN(self),"TRACE XML DUMP PLUGIN");
 
+  self->reprs = (hash_ptr)(NULL);
+
   /* virtual methods overriding: */
   OVERRIDE(Object, finalize) = trace_xml_dumper_finalize;
   OVERRIDE(TracePlugin, action) = trace_xml_dumper_action;
@@ -355,3 +365,75 @@ static void trace_xml_dumper_finalize(Object_ptr object, void* dummy)
   trace_xml_dumper_deinit(self);
   FREE(self);
 }
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns the escaped representation of the given symbol or
+               value]
+
+  Description [The representation is obfuscated if required, escaped
+               for XML, and cached in self->reprs for the rest of the
+               action. Lists of values (UNION) are joined with ", ",
+               as TracePlugin_print_list does. The returned string
+               belongs to self and must not be freed.]
+
+  SideEffects [self->reprs may be updated]
+
+  SeeAlso     []
+
+******************************************************************************/
+static const char*
+trace_xml_dumper_get_repr(TraceXmlDumper_ptr self, node_ptr expr)
+{
+  char* res;
+
+  nusmv_assert((hash_ptr)(NULL) != self->reprs);
+
+  res = (char*) find_assoc(self->reprs, expr);
+  if ((char*) NULL != res) return res;
+
+  if (Nil != expr && UNION == node_get_type(expr)) {
+    const char* head = trace_xml_dumper_get_repr(self, car(expr));
+    const char* tail = trace_xml_dumper_get_repr(self, cdr(expr));
+
+    res = ALLOC(char, strlen(head) + strlen(tail) + 3);
+    nusmv_assert((char*) NULL != res);
+    sprintf(res, "%s, %s", head, tail);
+  }
+  else {
+    const TracePlugin_ptr plugin = TRACE_PLUGIN(self);
+    char* repr = \
+      sprint_node((hash_ptr)(NULL) != plugin->obfuscation_map
+                  ? Compile_obfuscate_expression(
+                             trace_get_symb_table(plugin->trace),
+                             expr, plugin->obfuscation_map)
+                  : expr);
+
+    /* substituting XML entities */
+    res = Utils_str_escape_xml_string(repr);
+    FREE(repr);
+  }
+
+  insert_assoc(self->reprs, expr, (node_ptr) res);
+  return res;
+}
+
+
+/**Function********************************************************************
+
+  Synopsis    [Frees a cached representation]
+
+  Description [Callback of clear_assoc_and_free_entries]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static enum st_retval
+trace_xml_dumper_free_repr(char* key, char* data, char* arg)
+{
+  FREE(data);
+  return ST_DELETE;
+}
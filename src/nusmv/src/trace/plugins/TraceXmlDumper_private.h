@@ -66,6 +66,10 @@ typedef struct TraceXmlDumper_TAG
 {
   INHERITS_FROM(TracePlugin);
 
+  /* escaped representations of the symbols and values dumped by the
+     current action, freed at the end of the action */
+  hash_ptr reprs;
+
 } TraceXmlDumper;
 
 typedef struct XmlNodes_TAG* XmlNodes_ptr;
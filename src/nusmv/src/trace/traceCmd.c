@@ -59,6 +59,7 @@
 
 #include "trace/loaders/TraceLoader.h"
 #include "trace/loaders/TraceXmlLoader.h"
+#include "trace/loaders/TraceBinaryLoader.h"
 
 #include "trace/exec/BaseTraceExecutor.h"
 #include "trace/exec/CompleteTraceExecutor.h"
@@ -283,9 +284,9 @@ int CommandShowTraces(int argc, char** argv)
   }
   else {
     /* A trace header will be not printed when the plugin is the XML
-       dumper or dynamically registered external plugins: */
+       or binary dumper or dynamically registered external plugins: */
 
-    boolean print_header =  (plugin_index != 4) &&
+    boolean print_header =  (plugin_index != 4) && (plugin_index != 6) &&
       (TraceManager_is_plugin_internal(global_trace_manager, plugin_index));
 
     set_indent_size(2);
@@ -581,10 +582,11 @@ static int UsageShowPlugins(void)
 
   CommandSynopsis    [Reads the trace from the specified file into the memory]
 
-  CommandArguments   [ \[-h\] | \[-i filename\] | \[-u\] \[-s\] filename]
+  CommandArguments   [ \[-h\] | \[-i filename\] | \[-u\] \[-s\] \[-b\] filename]
 
   CommandDescription [
-  Reads a trace from a specified XML file into the memory.
+  Reads a trace from a specified XML file into the memory, or from a
+  binary file dumped with the binary trace plugin.
   <p>
   Command Options:<p>
   <dl>
@@ -596,6 +598,9 @@ static int UsageShowPlugins(void)
        <dd> Turns 'undefined symbol' error in a warning.
     <dt> <tt>-s</tt>
        <dd> Turns 'wrong section' error in a warning.
+    <dt> <tt>-b</tt>
+       <dd> Reads a binary trace instead of an XML one. This does not
+       require the EXPAT library.
     <dt> <tt>filename</tt>
        <dd> Specifies the name of the xml trace file to read
     </dl>
@@ -611,9 +616,10 @@ int CommandReadTrace(int argc, char** argv)
   char* filename = NIL(char);
   boolean halt_if_undef = true;
   boolean halt_if_wrong_section = true;
+  boolean binary = false;
 
   util_getopt_reset();
-  while ((c = util_getopt(argc, argv, "husi:")) != EOF) {
+  while ((c = util_getopt(argc, argv, "husbi:")) != EOF) {
     switch (c) {
     case 'h':
       res = UsageReadTrace();
@@ -632,6 +638,10 @@ int CommandReadTrace(int argc, char** argv)
       halt_if_wrong_section = false;
       break;
 
+    case 'b':
+      binary = true;
+      break;
+
     default:
       UsageReadTrace();
       res = 1;
@@ -672,29 +682,44 @@ int CommandReadTrace(int argc, char** argv)
     res = 1; goto leave;
   }
 
-#if NUSMV_HAVE_LIBEXPAT
   {
-    /* load trace using TraceXMLLoader */
+    /* load trace using a TraceLoader */
     Trace_ptr trace = TRACE(NULL);
+    TraceLoader_ptr loader;
 
     SexpFsm_ptr sexp_fsm = \
       PropDb_master_get_scalar_sexp_fsm(PropPkg_get_prop_database());
 
     SEXP_FSM_CHECK_INSTANCE(sexp_fsm);
 
-    /* use TraceXmlLoader to load a trace from xml file */
-    TraceXmlLoader_ptr loader = \
-      TraceXmlLoader_create(filename, halt_if_undef, halt_if_wrong_section);
+    if (binary) {
+      /* use TraceBinaryLoader to load a trace from a binary file */
+      loader = TRACE_LOADER(TraceBinaryLoader_create(filename, halt_if_undef));
+    }
+    else {
+#if NUSMV_HAVE_LIBEXPAT
+      /* use TraceXmlLoader to load a trace from xml file */
+      loader = TRACE_LOADER(TraceXmlLoader_create(filename, halt_if_undef,
+                                                  halt_if_wrong_section));
+#else
+      fprintf(nusmv_stderr,
+              "EXPAT library is not available on this system.\n");
+      fprintf(nusmv_stderr,
+              "Try to recompile %s with the EXPAT library, "
+              "or use a binary trace.\n", NuSMVCore_get_tool_name());
+      goto leave;
+#endif
+    }
 
-    trace = TraceLoader_load_trace(TRACE_LOADER(loader),
+    trace = TraceLoader_load_trace(loader,
                                    SexpFsm_get_symb_table(sexp_fsm),
                                    SexpFsm_get_symbols_list(sexp_fsm));
 
     Object_destroy(OBJECT(loader), NULL); /* virtual destructor */
 
     if (TRACE(NULL) == trace) {
-      fprintf(nusmv_stderr,
-              "Unable to load trace from XML File \"%s\".\n", filename);
+      fprintf(nusmv_stderr, "Unable to load trace from %s File \"%s\".\n",
+              binary ? "binary" : "XML", filename);
       res = 1;
     }
     else {
@@ -704,15 +729,6 @@ int CommandReadTrace(int argc, char** argv)
     }
   } /* load trace */
 
-#else
-
-  { /* no EXPAT */
-    fprintf(nusmv_stderr, "EXPAT library is not available on this system.\n");
-    fprintf(nusmv_stderr, "Try to recompile %s with the EXPAT library.\n",
-            NuSMVCore_get_tool_name());
-  }
-#endif
-
  leave: /* command cleanup */
   return res;
 }
@@ -730,12 +746,13 @@ int CommandReadTrace(int argc, char** argv)
 ******************************************************************************/
 static int UsageReadTrace(void)
 {
-  fprintf(nusmv_stderr, "usage: read_trace [-u] [-s] (-h | file_name | -i file_name)\n"
+  fprintf(nusmv_stderr, "usage: read_trace [-u] [-s] [-b] (-h | file_name | -i file_name)\n"
           "  -h \t Prints the command usage.\n"
           "  -u \t Output a warning instead of an error for every "
           "undefined symbol.\n"
           "  -s \t Output a warning instead of an error for every "
           "symbol placed in \n \t inappropriate trace section.\n"
+          "  -b \t Reads a binary trace instead of an XML trace.\n"
           "  -i file_name  Option -i is deprecated.\n"
           "  file-name     Trace is read from a given XML file.\n"
           );
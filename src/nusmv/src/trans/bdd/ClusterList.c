@@ -724,32 +724,43 @@ ClusterList_get_k_image_state_input(const ClusterList_ptr self, bdd_ptr s, int k
 
   Synopsis           [Returns the monolithic bdd corresponding to the "self".]
 
-  Description        [The returned bdd is referenced]
+  Description        [The returned bdd is referenced. Clusters are
+  conjoined pairwise in a balanced tree rather than accumulated one by one,
+  which keeps intermediate products small.]
 
   SideEffects        []
 
-  SeeAlso            []
+  SeeAlso            [bdd_and_array]
 
 ******************************************************************************/
 bdd_ptr ClusterList_get_monolithic_bdd(const ClusterList_ptr self)
 {
   ClusterListIterator_ptr iter;
+  bdd_ptr* trans;
   bdd_ptr result;
+  int n, i;
 
   CLUSTER_LIST_CHECK_INSTANCE(self);
 
-  result = bdd_true(self->dd);
+  n = ClusterList_length(self);
+  if (n == 0) return bdd_true(self->dd);
+
+  trans = ALLOC(bdd_ptr, n);
+  nusmv_assert(trans != (bdd_ptr*) NULL);
 
+  i = 0;
   iter = ClusterList_begin(self);
   while ( ! ClusterListIterator_is_end(iter) ) {
-
     Cluster_ptr cluster = ClusterList_get_cluster(self, iter);
-    bdd_ptr tmp = Cluster_get_trans(cluster);
-
-    bdd_and_accumulate(self->dd, &result, tmp);
-    bdd_free(self->dd, tmp);
+    trans[i++] = Cluster_get_trans(cluster);
     iter = ClusterListIterator_next(iter);
   }
+  nusmv_assert(i == n);
+
+  result = bdd_and_array(self->dd, trans, n);
+
+  for (i = 0; i < n; ++i) bdd_free(self->dd, trans[i]);
+  FREE(trans);
 
   return result;
 }
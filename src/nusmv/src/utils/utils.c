@@ -89,6 +89,71 @@ typedef void (*hash_timers_DESTROY)(TimerBench_ptr);
 
 static hash_ptr hash_timers = (hash_ptr)NULL;
 
+/* this table is used to associate a character to a string, for
+   character escaping 
+
+   IMPORTANT!! This table if changed has to be updated along with
+   escape_table_begin and escape_table_end
+*/
+static const char escape_table_begin = '\t';
+static const char escape_table_end = '>';
+static const char* escape_table[] = {
+  "&#009;",  /* '\t' */
+  "&#010;",  /* '\n' */
+  "&#011;",  /* '\v' */
+  "&#012;",  /* '\f' */
+  "&#013;",  /* '\r' */
+  "&#014;",  /* SO   */
+  "&#015;",  /* SI   */
+  "&#016;",  /* DLE  */
+  "&#017;",  /* DC1  */
+  "&#018;",  /* DC2  */
+  "&#019;",  /* DC3  */
+  "&#020;",  /* DC4  */
+  "&#021;",  /* NAK  */
+  "&#022;",  /* SYN  */
+  "&#023;",  /* ETB  */
+  "&#024;",  /* CAN  */
+  "&#025;",  /* EM   */
+  "&#026;",  /* SUB  */
+  "&#027;",  /* ESC  */
+  "&#028;",  /* FS   */
+  "&#029;",  /* GS   */
+  "&#030;",  /* RS   */
+  "&#031;",  /* US   */
+  "&#032;",  /* ' '  */
+  "&#033;",  /* '!'  */
+  "&quot;",  /* '"'  */
+  "#",       /* '#'  */
+  "$",       /* '$'  */
+  "%",       /* '%'  */
+  "&amp;",   /* '&'  */
+  "&apos;",  /* '''  */
+  "(",       /* '('  */
+  ")",       /* ')'  */
+  "*",       /* '*'  */
+  "+",       /* '+'  */
+  ",",       /* ','  */
+  "-",       /* '-'  */
+  ".",       /* '.'  */
+  "/",       /* '/'  */
+  "0",       /* '0'  */
+  "1",       /* '1'  */
+  "2",       /* '2'  */
+  "3",       /* '3'  */
+  "4",       /* '4'  */
+  "5",       /* '5'  */
+  "6",       /* '6'  */
+  "7",       /* '7'  */
+  "8",       /* '8'  */
+  "9",       /* '9'  */
+  ":",       /* ':'  */
+  ";",       /* ';'  */
+  "&lt;",    /* '<'  */
+  "=",       /* '='  */
+  "&gt;",    /* '>'  */
+};
+
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
 /*---------------------------------------------------------------------------*/
@@ -569,71 +634,6 @@ void Utils_print_timer(const char* name, const char* msg)
 ******************************************************************************/
 void Utils_str_escape_xml_file(const char* str, FILE* file)
 {
-  /* this table is used to associate a character to a string, for
-     character escaping 
-
-     IMPORTANT!! This table if changed has to be updated along with
-     escape_table_begin and escape_table_end
-  */
-  static char escape_table_begin = '\t';
-  static char escape_table_end = '>';
-  static char* escape_table[] = {
-    "&#009;",  /* '\t' */
-    "&#010;",  /* '\n' */
-    "&#011;",  /* '\v' */
-    "&#012;",  /* '\f' */
-    "&#013;",  /* '\r' */
-    "&#014;",  /* SO   */
-    "&#015;",  /* SI   */
-    "&#016;",  /* DLE  */
-    "&#017;",  /* DC1  */
-    "&#018;",  /* DC2  */
-    "&#019;",  /* DC3  */
-    "&#020;",  /* DC4  */
-    "&#021;",  /* NAK  */
-    "&#022;",  /* SYN  */
-    "&#023;",  /* ETB  */
-    "&#024;",  /* CAN  */
-    "&#025;",  /* EM   */
-    "&#026;",  /* SUB  */
-    "&#027;",  /* ESC  */
-    "&#028;",  /* FS   */
-    "&#029;",  /* GS   */
-    "&#030;",  /* RS   */
-    "&#031;",  /* US   */
-    "&#032;",  /* ' '  */
-    "&#033;",  /* '!'  */
-    "&quot;",  /* '"'  */
-    "#",       /* '#'  */
-    "$",       /* '$'  */
-    "%",       /* '%'  */
-    "&amp;",   /* '&'  */
-    "&apos;",  /* '''  */
-    "(",       /* '('  */
-    ")",       /* ')'  */
-    "*",       /* '*'  */
-    "+",       /* '+'  */
-    ",",       /* ','  */
-    "-",       /* '-'  */
-    ".",       /* '.'  */
-    "/",       /* '/'  */
-    "0",       /* '0'  */
-    "1",       /* '1'  */
-    "2",       /* '2'  */
-    "3",       /* '3'  */
-    "4",       /* '4'  */
-    "5",       /* '5'  */
-    "6",       /* '6'  */
-    "7",       /* '7'  */
-    "8",       /* '8'  */
-    "9",       /* '9'  */
-    ":",       /* ':'  */
-    ";",       /* ';'  */
-    "&lt;",    /* '<'  */
-    "=",       /* '='  */
-    "&gt;",    /* '>'  */
-  };
-
   if ((char*) NULL != str) {
     const char* iter;   
     char c;
@@ -650,6 +650,53 @@ void Utils_str_escape_xml_file(const char* str, FILE* file)
 }
 
 
+/**Function********************************************************************
+
+  Synopsis           [Returns a copy of given string with all characters
+  escaped for xml]
+
+  Description        [The returned string must be freed by the caller.
+  Escaping a string once is cheaper than escaping it each time it is
+  dumped, when it is dumped many times.]
+
+  SideEffects        []
+
+  SeeAlso            [Utils_str_escape_xml_file]
+
+******************************************************************************/
+char* Utils_str_escape_xml_string(const char* str)
+{
+  size_t len = 1;
+  const char* iter;
+  char* res;
+  char* dst;
+  char c;
+
+  if ((char*) NULL == str) return (char*) NULL;
+
+  for (iter=str, c=*iter; c != '\0'; c=*(++iter)) {
+    len += (escape_table_begin <= c && c <= escape_table_end)
+      ? strlen(escape_table[c-escape_table_begin]) : 1;
+  }
+
+  res = ALLOC(char, len);
+  nusmv_assert((char*) NULL != res);
+
+  for (iter=str, dst=res, c=*iter; c != '\0'; c=*(++iter)) {
+    if (escape_table_begin <= c && c <= escape_table_end) {
+      const char* esc = escape_table[c-escape_table_begin];
+      size_t esc_len = strlen(esc);
+      memcpy(dst, esc, esc_len);
+      dst += esc_len;
+    }
+    else *(dst++) = c;
+  }
+  *dst = '\0';
+
+  return res;
+}
+
+
 /**Function********************************************************************
 
   Synopsis           [Computes the log2 of the given unsigned argument
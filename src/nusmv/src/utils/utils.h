@@ -96,6 +96,7 @@ EXTERN void Utils_print_timer ARGS((const char* name, const char* msg));
 
 /* Characters Escaping */
 EXTERN void Utils_str_escape_xml_file ARGS((const char* str, FILE* file));
+EXTERN char* Utils_str_escape_xml_string ARGS((const char* str));
 
 #endif /* _UTILS_H */
 
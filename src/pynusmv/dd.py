@@ -11,13 +11,14 @@ The :mod:`pynusmv.dd` module provides some BDD-related structures:
 * :class:`DDManager` represents a NuSMV DD manager.
 
 It also provides global methods to work on BDD variables reordering: :func:`enable_dynamic_reordering`, :func:`disable_dynamic_reordering`,
-:func:`dynamic_reordering_enabled`, :func:`reorder`.
+:func:`dynamic_reordering_enabled`, :func:`reorder`,
+:func:`set_reordering_budget`.
 
 """
 
 
 __all__ = ['enable_dynamic_reordering', 'disable_dynamic_reordering',
-           'dynamic_reordering_enabled', 'reorder',
+           'dynamic_reordering_enabled', 'reorder', 'set_reordering_budget',
            'BDD', 'BDDList', 'State', 'Inputs', 'StateInputs', 'Cube',
            'DDManager']
 
@@ -31,6 +32,7 @@ from .nusmv.cinit import cinit as nscinit
 from .nusmv.opt import opt as nsopt
 
 from .utils import PointerWrapper
+from .init import _register_wrapper
 from .exception import MissingManagerError
 
 
@@ -167,6 +169,57 @@ def reorder(DDmanager=None, method="sift"):
         method = nsdd.CUDD_REORDER_SIFT
     nsdd.dd_reorder(DDmanager_ptr, method, nsdd.DEFAULT_MINSIZE)
 
+def set_reordering_budget(DDmanager=None, time_limit=0, total_limit=0,
+                          between_iterations=False):
+    """
+    Bound the time spent in reordering BDD variables under control of
+    `DDmanager`.
+
+    The budget is stored in the NuSMV options (`reorder_time_limit`,
+    `reorder_total_limit` and `reorder_between_iterations`), which forward it
+    to the global DD manager.
+
+    :param DDmanager: the concerned DD manager; if None, the global DD manager
+                      is used instead; it must be the global DD manager.
+    :type DDmanager: :class:`DDManager`
+    :param time_limit: the maximal number of milliseconds a single reordering
+                       can take; when exceeded, the best order found so far is
+                       kept; 0 means no limit.
+    :type time_limit: :class:`int`
+    :param total_limit: the number of milliseconds of reordering after which
+                        dynamic reordering is no longer triggered; 0 means no
+                        limit.
+    :type total_limit: :class:`int`
+    :param between_iterations: whether dynamic reordering is postponed to the
+                               end of the iterations of the reachable states
+                               computation, instead of happening in the middle
+                               of image computations.
+    :type between_iterations: :class:`bool`
+
+    :raise: a :exc:`MissingManagerError
+            <pynusmv.exception.MissingManagerError>` if the manager is missing
+    :raise: a :exc:`ValueError` if a limit is negative, or if `DDmanager` is
+            not the global DD manager
+
+    """
+    if DDmanager is None:
+        DDmanager_ptr = nscinit.cvar.dd_manager
+    else:
+        DDmanager_ptr = DDmanager._ptr
+    if DDmanager_ptr is None:
+        raise MissingManagerError("Missing manager")
+    if DDmanager_ptr != nscinit.cvar.dd_manager:
+        raise ValueError("Reordering budgets apply to the global DD manager")
+    if time_limit < 0 or total_limit < 0:
+        raise ValueError("Reordering limits must be non-negative")
+    opts = nsopt.OptsHandler_get_instance()
+    nsopt.set_reorder_time_limit(opts, time_limit)
+    nsopt.set_reorder_total_limit(opts, total_limit)
+    if between_iterations:
+        nsopt.set_reorder_between_iterations(opts)
+    else:
+        nsopt.unset_reorder_between_iterations(opts)
+
 
 class BDD(PointerWrapper):
 
@@ -193,6 +246,11 @@ class BDD(PointerWrapper):
     """
 #    All BDDs are freed by default. Every operation on BDDs that return a new
 #    BDD uses bdd_dup to ensure that the new BDD wraps a pointer to free.
+#
+#    BDDs to free are not registered to the PyNuSMV collector: their
+#    reference is kept by a handle in the C list of live handles of their
+#    manager, which is released by deinit_nusmv. This avoids the cost of a
+#    weak reference per BDD.
 
     def __init__(self, ptr, dd_manager=None, freeit=True):
         """
@@ -206,12 +264,23 @@ class BDD(PointerWrapper):
 
         """
         assert(ptr is not None)
-        super(BDD, self).__init__(ptr, freeit)
+        self._ptr = ptr
+        self._freeit = freeit
         self._manager = dd_manager
+        if freeit and dd_manager is not None:
+            self._handle = nsdd.bdd_handle_new(dd_manager._ptr, ptr)
+        else:
+            self._handle = None
+            if freeit:
+                _register_wrapper(self)
 
     def _free(self):
         if self._freeit and self._ptr is not None:
-            nsdd.bdd_free(self._manager._ptr, self._ptr)
+            if self._handle is not None:
+                nsdd.bdd_handle_free(self._handle)
+                self._handle = None
+            else:
+                nsdd.bdd_free(self._manager._ptr, self._ptr)
             self._freeit = False
     
     def __deepcopy__(self, memo):
@@ -1069,4 +1138,88 @@ class DDManager(PointerWrapper):
         Returns the number of times reordering has occurred in this manager.
 
         """
-        return nsdd.dd_get_reorderings(self._ptr)
\ No newline at end of file
+        return nsdd.dd_get_reorderings(self._ptr)
+
+    @property
+    def cache_stats(self):
+        """
+        The computed table statistics of this manager, per operator.
+
+        This is a dictionary associating to the name of each operator that
+        used the computed table a dictionary giving its number of `lookups`,
+        `hits`, `inserts` and `evictions` (results discarded by later
+        insertions).
+
+        """
+        stats = {}
+        for i in range(nsdd.dd_get_cache_op_count(self._ptr)):
+            name = nsdd.dd_get_cache_op_name(self._ptr, i)
+            stats[name] = {
+                "lookups": nsdd.dd_get_cache_op_lookups(self._ptr, i),
+                "hits": nsdd.dd_get_cache_op_hits(self._ptr, i),
+                "inserts": nsdd.dd_get_cache_op_inserts(self._ptr, i),
+                "evictions": nsdd.dd_get_cache_op_evictions(self._ptr, i)
+            }
+        return stats
+
+    @property
+    def memory_in_use(self):
+        """
+        The number of bytes of memory used by this manager.
+
+        """
+        return nsdd.dd_get_memory_in_use(self._ptr)
+
+    @property
+    def memory_budget(self):
+        """
+        The memory budget of this manager, in bytes; 0 if there is none.
+
+        """
+        return nsdd.dd_get_memory_budget(self._ptr)
+
+    @property
+    def memory_budget_events(self):
+        """
+        The number of times this manager reclaimed memory because it was
+        close to its memory budget.
+
+        """
+        return nsdd.dd_get_memory_budget_events(self._ptr)
+
+    def set_memory_budget(self, budget, callback=None):
+        """
+        Set a soft limit on the memory used by this manager.
+
+        When the manager gets close to `budget`, it collects garbage, shrinks
+        its computed table and gives unused pages of nodes back to the system.
+        If this is not enough, `callback` is called; it can free the BDDs
+        the application caches, e.g. by clearing a memoization table, but
+        must not build new BDDs. Operations never fail because of the budget:
+        if memory cannot be reclaimed, the manager goes on allocating.
+
+        :param budget: the number of bytes; 0 removes the budget.
+        :type budget: :class:`int`
+        :param callback: a function without arguments, or None.
+        :raise: a :exc:`ValueError` if `budget` is negative or `callback`
+                is not callable
+
+        """
+        if budget < 0:
+            raise ValueError("The memory budget must be non-negative")
+        if callback is not None and not callable(callback):
+            raise ValueError("The callback must be callable")
+        nsdd.set_memory_budget_callback(self._ptr, callback)
+        nsdd.dd_set_memory_budget(self._ptr, budget)
+
+    def release_memory(self):
+        """
+        Give the memory this manager does not need back to the system:
+        collect garbage, shrink the computed table to its initial size and
+        free the pages of nodes that hold no live node. Useful after
+        dropping large BDDs, e.g. between two verification tasks.
+
+        :return: the number of bytes released.
+
+        """
+        return nsdd.dd_release_memory(self._ptr)
@@ -16,7 +16,8 @@ __all__ = ['PyNuSMVError', 'MissingManagerError', 'NuSMVLexerError',
            'NuSMVModelAlreadyBuiltError', 'NuSMVNeedVariablesEncodedError',
            'NuSMVInitError', 'NuSMVParserError', 'NuSMVTypeCheckingError',
            'NuSMVFlatteningError', 'NuSMVBddPickingError',
-           'NuSMVParsingError', 'NuSMVModuleError', 'NuSMVSymbTableError']
+           'NuSMVParsingError', 'NuSMVModuleError', 'NuSMVSymbTableError',
+           'NuSMVBddSnapshotError']
 
 
 from collections import namedtuple
@@ -263,3 +264,12 @@ class NuSMVSymbTableError(PyNuSMVError):
 
     """
     pass
+
+
+class NuSMVBddSnapshotError(PyNuSMVError):
+
+    """
+    Exception raised when BDDs cannot be saved to or loaded from a snapshot.
+
+    """
+    pass
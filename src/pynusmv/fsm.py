@@ -17,6 +17,7 @@ represented and stored by NuSMV:
 __all__ = ['BddFsm', 'BddTrans', 'BddEnc', 'SymbTable']
 
 import tempfile
+import array
 
 from .nusmv.fsm.bdd import bdd as bddFsm
 from .nusmv.enc.bdd import bdd as bddEnc
@@ -37,9 +38,11 @@ from .nusmv.compile.type_checking import type_checking as nstype_checking
 from .dd import BDD, State, Inputs, StateInputs, DDManager, Cube
 from .utils import PointerWrapper, AttributeDict
 from .exception import (NuSMVBddPickingError, NuSMVFlatteningError,
-                        NuSMVTypeCheckingError, NuSMVSymbTableError)
+                        NuSMVTypeCheckingError, NuSMVSymbTableError,
+                        NuSMVBddSnapshotError)
 from .parser import parse_next_expression
 from . import node
+from . import instrument
 
 
 class BddFsm(PointerWrapper):
@@ -172,6 +175,51 @@ class BddFsm(PointerWrapper):
         self._reachable = reachable_states
         bddFsm.BddFsm_set_reachable_states(self._ptr, reachable_states._ptr)
 
+    def compute_reachable_states(self, threshold=0):
+        """
+        Compute the set of reachable states of this FSM, possibly with guided
+        reachability, and cache it.
+
+        With a positive `threshold`, every frontier of more than `threshold`
+        BDD nodes is replaced by a dense subset of it before computing its
+        image; exact images of the whole reached set are then computed until
+        the fixpoint, so the result is still the exact set of reachable
+        states. Nothing is done if the reachable states are already known.
+
+        :param int threshold: the frontier size above which frontiers are
+                              subsetted; 0 means exact reachability
+        :rtype: :class:`BDD <pynusmv.dd.BDD>`
+        :raise: a :exc:`ValueError` if `threshold` is negative
+
+        """
+        if threshold < 0:
+            raise ValueError("The threshold must be non-negative")
+        opts = nsopt.OptsHandler_get_instance()
+        previous = nsopt.get_guided_reachability_threshold(opts)
+        nsopt.set_guided_reachability_threshold(opts, threshold)
+        try:
+            bddFsm.BddFsm_expand_cached_reachable_states(self._ptr, -1, -1)
+        finally:
+            nsopt.set_guided_reachability_threshold(opts, previous)
+        return self.reachable_states
+
+    @property
+    def rings_budget(self):
+        """
+        The number of BDD nodes this FSM can use to keep the onion rings of
+        `EU` and `EG` fixpoints. When positive, :func:`pynusmv.mc.eval_ctl_spec`
+        keeps these rings, and :func:`pynusmv.mc.explainEU` and
+        :func:`pynusmv.mc.explainEG` walk them instead of searching again.
+        Least recently used rings are dropped to stay within the budget;
+        0, the default, keeps no rings.
+
+        """
+        return bddFsm.BddFsm_get_rings_budget(self._ptr)
+
+    @rings_budget.setter
+    def rings_budget(self, budget):
+        bddFsm.BddFsm_set_rings_budget(self._ptr, budget)
+
     @property
     def deadlock_states(self):
         """
@@ -194,7 +242,30 @@ class BddFsm(PointerWrapper):
             self._fair = BDD(bddFsm.BddFsm_get_fair_states(self._ptr),
                              self.bddEnc.DDmanager)
         return self._fair
+
+    def fair_states_inputs_in(self, subspace, over=None):
+        """
+        Return the set of fair state/inputs pairs of this FSM restricted to
+        `subspace`, that is, the pairs of `subspace` that can reach, within
+        `subspace`, a cycle of `subspace` visiting all fairness constraints.
+
+        The greatest fixpoint is started from `over` instead of true, if
+        given. `over` must contain the result, for example the fair pairs of
+        a larger subspace; otherwise, a subset of the result is returned.
+
+        :param subspace: the set of state/inputs pairs to restrict to
+        :type subspace: :class:`BDD <pynusmv.dd.BDD>`
+        :param over: an over-approximation of the result, or `None`
+        :type over: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`BDD <pynusmv.dd.BDD>`
+
+        """
+        return BDD(bddFsm.BddFsm_get_fair_states_inputs_subset_from(
+                       self._ptr, subspace._ptr,
+                       over._ptr if over is not None else None),
+                   self.bddEnc.DDmanager)
     
+    @instrument.traced("pre", "image")
     def pre(self, states, inputs=None):
         """
         Return the pre-image of `states` in this FSM.
@@ -218,6 +289,7 @@ class BddFsm(PointerWrapper):
                        (self._ptr, states._ptr, inputs._ptr),
                        self.bddEnc.DDmanager, freeit=True)
 
+    @instrument.traced("weak pre", "image")
     def weak_pre(self, states):
         """
         Return the weak pre-image of `states` in this FSM. This means that it
@@ -233,6 +305,7 @@ class BddFsm(PointerWrapper):
                                                          states._ptr),
                    self.bddEnc.DDmanager, freeit=True)
 
+    @instrument.traced("post", "image")
     def post(self, states, inputs=None):
         """
         Return the post-image of `states` in this FSM.
@@ -477,6 +550,90 @@ class BddFsm(PointerWrapper):
         else:
             return frozenset(State(te, self) for te in t)
 
+    def decode_states(self, bdd, layers=None):
+        """
+        Return the values of the variables in all states belonging to `bdd`,
+        as a table of columns.
+
+        Unlike :meth:`pick_all_states` followed by
+        :meth:`State.get_str_values <pynusmv.dd.State.get_str_values>`,
+        the states are decoded at once, by enumerating the minterms of `bdd`
+        and reading the encoding of the variables, and each distinct value is
+        printed once.
+
+        The result is a dictionary associating to each state variable name a
+        `(values, codes)` pair, where `values` is the tuple of the distinct
+        values of the variable, as strings, and `codes` is an
+        :class:`array.array` of ints such that the variable has value
+        `values[codes[i]]` in the i-th state. The states are in the same
+        order in all columns. `codes` supports the buffer protocol, for
+        instance with `numpy.frombuffer(codes, dtype=numpy.intc)`.
+
+        :param bdd: the concerned BDD
+        :type bdd: :class:`BDD <pynusmv.dd.BDD>`
+        :param layers: if not `None`, the set of names of the layers from which
+                       picking the variables
+        :rtype: dict(str, (tuple(str), :class:`array.array`))
+        :raise: a :exc:`NuSMVBddPickingError
+                <pynusmv.exception.NuSMVBddPickingError>`
+                if something is wrong
+
+        """
+        # Apply mask
+        bdd = bdd.forsome(self.bddEnc.inputsCube) & self.bddEnc.statesMask
+        count = self.count_states(bdd)
+
+        # Get symbols (SymbTable) for states
+        table = self.bddEnc.symbTable
+        if layers is None:
+            layers = nssymb_table.SymbTable_get_class_layer_names(table._ptr,
+                                                                  None)
+            symbols = nssymb_table.SymbTable_get_layers_sf_vars(table._ptr,
+                                                                layers)
+            layers_array = None
+        else:
+            layers_array = nsutils.array_alloc_strings(len(layers))
+            for i, layer in enumerate(layers):
+                nsutils.array_insert_strings(layers_array, i, layer)
+            symbols = nssymb_table.SymbTable_get_layers_sf_vars(
+                table._ptr, layers_array)
+
+        values = bddEnc._new_arrays()
+        result = bddEnc._decode_states(self.bddEnc._ptr, bdd._ptr, symbols,
+                                       count, values)
+
+        columns = {}
+        if result is not None:
+            n, data = result
+            data = memoryview(data)
+            width = array.array("i").itemsize
+            iterator = nsutils.NodeList_get_first_iter(symbols)
+            i = 0
+            while not nsutils.ListIter_is_end(iterator):
+                symbol = nsutils.NodeList_get_elem_at(symbols, iterator)
+                symbol_values = bddEnc._array_fetch_array(values, i)
+                if symbol_values is not None:
+                    codes = array.array("i")
+                    codes.frombytes(data[i * count * width:
+                                         (i * count + n) * width])
+                    columns[nsnode.sprint_node(symbol)] = (
+                        tuple(nsnode.sprint_node(
+                              bddEnc._array_fetch_node(symbol_values, j))
+                              for j in range(
+                                  bddEnc._array_size(symbol_values))),
+                        codes)
+                iterator = nsutils.ListIter_get_next(iterator)
+                i += 1
+
+        bddEnc._free_arrays(values)
+        nsutils.NodeList_destroy(symbols)
+        if layers_array:
+            nsutils.array_free(layers_array)
+
+        if result is None:
+            raise NuSMVBddPickingError("Cannot decode states.")
+        return columns
+
     def pick_all_inputs(self, bdd):
         """
         Return a tuple of all inputs belonging to `bdd`.
@@ -626,6 +783,7 @@ class BddTrans(PointerWrapper):
         ptr = nsbddtrans.BddTrans_get_monolithic_bdd(self._ptr)
         return BDD(ptr, self._manager, freeit=True)
 
+    @instrument.traced("pre", "image")
     def pre(self, states, inputs=None):
         """
         Compute the pre-image of `states`, through `inputs` if not `None`.
@@ -648,6 +806,7 @@ class BddTrans(PointerWrapper):
             self._ptr, nexts._ptr)
         return BDD(img, self._manager, freeit=True)
 
+    @instrument.traced("post", "image")
     def post(self, states, inputs=None):
         """
         Compute the post-image of `states`, through `inputs` if not `None`.
@@ -666,6 +825,47 @@ class BddTrans(PointerWrapper):
         img = bddEnc.BddEnc_next_state_var_to_state_var(self._enc._ptr, img)
         return BDD(img, self._manager, freeit=True)
 
+    def restrict(self, bdd):
+        """
+        Return a new transition relation, keeping the transitions of this one
+        that start from a state/inputs pair of `bdd`.
+
+        The relation is restricted by adding `bdd` as a new cluster of a copy
+        of this relation, without building any new variable or symbol.
+
+        :param bdd: the allowed states/inputs pairs; it can also depend on
+                    state variables or on some input variables only
+        :type bdd: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`BddTrans`
+
+        """
+        dd = self._manager._ptr
+        clusters = nsbddtrans.ClusterList_create(dd)
+        cluster = nsbddtrans.Cluster_create(dd)
+        nsbddtrans.Cluster_set_trans(cluster, dd, bdd._ptr)
+        nsbddtrans.ClusterList_append_cluster(clusters, cluster)
+        cluster_options = nsbddtrans.ClusterOptions_create(
+            nsopt.OptsHandler_get_instance())
+
+        restriction = nsbddtrans.BddTrans_create(
+            dd,
+            clusters,
+            bddEnc.BddEnc_get_state_vars_cube(self._enc._ptr),
+            bddEnc.BddEnc_get_input_vars_cube(self._enc._ptr),
+            bddEnc.BddEnc_get_next_state_vars_cube(self._enc._ptr),
+            nsopt.get_partition_method(nsopt.OptsHandler_get_instance()),
+            cluster_options)
+
+        nsbddtrans.ClusterOptions_destroy(cluster_options)
+        nsbddtrans.ClusterList_destroy(clusters)
+
+        newtransptr = nsbddtrans.BddTrans_copy(self._ptr)
+        nsbddtrans.BddTrans_apply_synchronous_product(newtransptr,
+                                                      restriction)
+        nsbddtrans.BddTrans_free(restriction)
+
+        return BddTrans(newtransptr, self._enc, self._manager, freeit=True)
+
     # =========================================================================
     # ===== Static methods ====================================================
     # =========================================================================
@@ -1054,6 +1254,70 @@ class BddEnc(PointerWrapper):
             tmp.write("\n".join(str(var) for var in order).encode("UTF-8"))
             tmp.flush()
             bddEnc.BddEnc_force_order_from_filename(self._ptr, tmp.name)
+
+    def save_bdds(self, filepath, bdds):
+        """
+        Save the given BDDs to a binary snapshot.
+
+        The snapshot records the names of the variables the BDDs depend on,
+        so it can be reloaded with :meth:`load_bdds` by an encoding of the
+        same model, possibly in another session.
+
+        :param filepath: the path of the snapshot file
+        :param bdds: a dictionary of BDDs of this encoding, indexed by name
+        :type bdds: dict(str, :class:`BDD <pynusmv.dd.BDD>`)
+
+        :raise: a :exc:`NuSMVBddSnapshotError
+                <pynusmv.exception.NuSMVBddSnapshotError>`
+                if the snapshot cannot be written
+
+        """
+        items = list(bdds.items())
+        array = bddEnc.new_bddArray(len(items))
+        names = nsutils.array_alloc_strings(len(items))
+        for i, (name, bdd) in enumerate(items):
+            bddEnc.bddArray_setitem(array, i, bdd._ptr)
+            nsutils.array_insert_strings(names, i, str(name))
+        err = bddEnc._save_bdds(self._ptr, filepath, len(items), array,
+                                names)
+        bddEnc._free_strings(names)
+        bddEnc.delete_bddArray(array)
+        if err:
+            raise NuSMVBddSnapshotError("Cannot save BDDs to " + filepath)
+
+    def load_bdds(self, filepath, restore_order=True):
+        """
+        Load the BDDs of a snapshot written by :meth:`save_bdds`.
+
+        The variables of the snapshot are matched by name with the variables
+        of this encoding.
+
+        :param filepath: the path of the snapshot file
+        :param bool restore_order: whether the variables are first reordered
+                                   as they were when the snapshot was saved;
+                                   this makes loading linear in the size of
+                                   the BDDs
+        :rtype: dict(str, :class:`BDD <pynusmv.dd.BDD>`)
+
+        :raise: a :exc:`NuSMVBddSnapshotError
+                <pynusmv.exception.NuSMVBddSnapshotError>`
+                if the file is not a valid snapshot, or if a BDD depends on
+                variables that are not part of this encoding
+
+        """
+        names = nsutils.array_alloc_strings(0)
+        array = bddEnc._load_bdds(self._ptr, filepath, restore_order, names)
+        if array is None:
+            bddEnc._free_strings(names)
+            raise NuSMVBddSnapshotError("Cannot load BDDs from " + filepath)
+        bdds = {}
+        for i in range(bddEnc._array_size(array)):
+            name = nsutils.array_fetch_strings(names, i)
+            bdds[name] = BDD(bddEnc._array_fetch_bdd(array, i),
+                             self.DDmanager, freeit=True)
+        bddEnc._free_strings(names)
+        nsutils.array_free(array)
+        return bdds
         
 
 class SymbTable(PointerWrapper):
@@ -25,6 +25,8 @@ from .nusmv.opt import opt as nsopt
 from .nusmv.cmd import cmd as nscmd
 from .nusmv.dd import dd as nsdd
 
+from . import instrument
+
 from .exception import NuSMVInitError, PyNuSMVError
 
 
@@ -32,6 +34,9 @@ from .exception import NuSMVInitError, PyNuSMVError
 __collecting = True
 __collector = None
 
+# Functions called when deiniting NuSMV, before collecting pointer wrappers
+__deinit_hooks = []
+
 
 class _PyNuSMVContext(object):
 
@@ -55,7 +60,9 @@ def init_nusmv(collecting=True):
     :func:`deinit_nusmv`.
     
     :param collecting: Whether or not collecting pointer wrappers to free them
-                       before deiniting nusmv.
+                       before deiniting nusmv. BDDs are not concerned: their
+                       references are always released by
+                       :func:`deinit_nusmv`.
     
     .. warning: Deactivating the collection of pointer wrappers may provoke
                 segmentation faults when deiniting nusmv without correctly
@@ -81,6 +88,9 @@ def init_nusmv(collecting=True):
         nsopt.init_options_cmd()
         nscmd.Cmd_SecureCommandExecute("set parser_is_lax")
 
+        # Record the events of the new DD manager if instrumentation is on
+        instrument._attach()
+
         return _PyNuSMVContext()
 
 
@@ -110,12 +120,19 @@ def deinit_nusmv(ddinfo=False):
         raise NuSMVInitError(
             "Cannot deinitialize NuSMV before initialization.")
     else:
+        # Drop the BDDs and FSMs kept by caches of PyNuSMV-based modules
+        for hook in __deinit_hooks:
+            hook()
         # First garbage collect with Python
         gc.collect()
         # Then garbage collect with PyNuSMV
         for elem in __collector:
             elem._free()
         __collector = None
+        # BDDs still alive keep their handle, but lose their reference
+        nsdd.bdd_handle_release_all()
+        nsdd.memory_budget_callbacks_clear()
+        instrument._detach()
         nscinit.NuSMVCore_quit()
 
 
@@ -153,6 +170,19 @@ class _WeakWrapper():
             o._free()
 
 
+def _register_deinit_hook(hook):
+    """
+    Register `hook` to be called when deiniting NuSMV, before collecting
+    pointer wrappers. Modules keeping BDDs or FSMs across calls use it to
+    drop them. A hook registered several times is called once.
+
+    :param hook: a function without arguments
+
+    """
+    if hook not in __deinit_hooks:
+        __deinit_hooks.append(hook)
+
+
 def _register_wrapper(wrapper):
     """
     Register pointer wrapper to PyNuSMV garbage collector. `wrapper` is
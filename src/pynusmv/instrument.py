@@ -0,0 +1,362 @@
+"""
+The :mod:`pynusmv.instrument` module records where time goes in
+PyNuSMV-based checkers, without native profilers.
+
+When enabled with :func:`enable`, it records
+
+* spans of image computations, fixpoints and fixpoint iterations, with the
+  size of the resulting BDDs;
+* spans of garbage collections and reorderings of the global DD manager, with
+  its number of live nodes before and after;
+* spans of the functions decorated with :func:`traced` and of the blocks
+  opened with :func:`span`;
+* the number of calls to each NuSMV function, through SWIG.
+
+The recorded spans can be exported in the Chrome trace event format with
+:func:`write_chrome_trace`, and loaded in `chrome://tracing` or Perfetto::
+
+    from pynusmv import instrument
+    instrument.enable()
+    ...
+    instrument.disable()
+    with open("trace.json", "w") as out:
+        instrument.write_chrome_trace(out)
+
+Times are processor times of the process, in microseconds.
+
+"""
+
+
+__all__ = ['enable', 'disable', 'is_enabled', 'clear', 'span', 'traced',
+           'events', 'swig_calls', 'chrome_trace', 'write_chrome_trace']
+
+
+import functools
+import json
+import os
+import sys
+import time
+
+from .nusmv.dd import dd as nsdd
+from .nusmv.cinit import cinit as nscinit
+
+
+# Whether spans are recorded
+_enabled = False
+# The recorded spans, as (name, category, begin, end, args) tuples
+_spans = []
+# The number of calls to each wrapped NuSMV function
+_calls = {}
+# The wrapped NuSMV functions, as (module, name, function) tuples
+_wrapped = []
+# The capacity of the DD events buffer, or 0 if DD events are not recorded
+_dd_capacity = 0
+# The traced DD manager pointer, or None
+_dd_traced = None
+# The number of DD events dropped since the last clear
+_dd_dropped = 0
+
+_DD_SPANS = {nsdd.DD_TRACE_GC_BEGIN: "gc",
+             nsdd.DD_TRACE_REORDER_BEGIN: "reorder"}
+
+
+def _now():
+    return time.process_time() * 1e6
+
+
+class _Span(object):
+
+    """
+    A recorded span, used as a context manager.
+
+    """
+
+    __slots__ = ['name', 'category', 'args', 'begin']
+
+    def __init__(self, name, category, args):
+        self.name = name
+        self.category = category
+        self.args = args
+        self.begin = None
+
+    def __enter__(self):
+        self.begin = _now()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        _spans.append((self.name, self.category, self.begin, _now(),
+                       self.args))
+        return False
+
+    def set(self, **args):
+        """
+        Add `args` to the arguments of this span.
+
+        """
+        self.args.update(args)
+
+
+class _NoSpan(object):
+
+    """
+    The span returned when recording is disabled; it is false.
+
+    """
+
+    __slots__ = []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        return False
+
+    def __bool__(self):
+        return False
+
+    def set(self, **args):
+        pass
+
+
+_NO_SPAN = _NoSpan()
+
+
+def is_enabled():
+    """
+    Return whether spans are recorded.
+
+    :rtype: :class:`bool`
+
+    """
+    return _enabled
+
+
+def enable(swig_calls=True, dd_events=True, dd_capacity=65536):
+    """
+    Start recording spans.
+
+    :param swig_calls: whether the calls to NuSMV functions are counted; only
+                       the functions of the NuSMV modules imported so far are
+                       counted
+    :type swig_calls: :class:`bool`
+    :param dd_events: whether the garbage collections and reorderings of the
+                      global DD manager are recorded, while NuSMV is
+                      initialized
+    :type dd_events: :class:`bool`
+    :param dd_capacity: the number of DD events kept between two calls to
+                        :func:`events`, :func:`chrome_trace` or
+                        :func:`disable`; the next ones are dropped
+    :type dd_capacity: :class:`int`
+
+    """
+    global _enabled, _dd_capacity
+    if _enabled:
+        disable()
+    _enabled = True
+    if swig_calls:
+        _wrap_swig_functions()
+    if dd_events:
+        _dd_capacity = dd_capacity
+        _attach()
+
+
+def disable():
+    """
+    Stop recording spans. The recorded spans are kept until :func:`clear`.
+
+    """
+    global _enabled, _dd_capacity
+    _detach()
+    _dd_capacity = 0
+    for module, name, function in _wrapped:
+        setattr(module, name, function)
+    del _wrapped[:]
+    _enabled = False
+
+
+def clear():
+    """
+    Forget the recorded spans and calls.
+
+    """
+    global _dd_dropped
+    _collect_dd_events()
+    del _spans[:]
+    _calls.clear()
+    _dd_dropped = 0
+
+
+def span(name, category="pynusmv", **args):
+    """
+    Return a context manager recording a span of the given `name` and
+    `category`, with the given arguments::
+
+        with instrument.span("split", "atlkPO", strategies=n) as s:
+            ...
+            if s:
+                s.set(size=result.size)
+
+    The returned span is false when recording is disabled, so that costly
+    arguments are only computed when needed.
+
+    """
+    if not _enabled:
+        return _NO_SPAN
+    return _Span(name, category, args)
+
+
+def traced(name=None, category="pynusmv", sized=True):
+    """
+    Return a decorator recording a span for each call of the decorated
+    function.
+
+    :param name: the name of the spans; the name of the function by default
+    :param category: the category of the spans
+    :param sized: whether the size of the result, a BDD, is recorded
+
+    """
+    def decorator(function):
+        spanname = name if name is not None else function.__name__
+
+        @functools.wraps(function)
+        def wrapper(*args, **kwargs):
+            if not _enabled:
+                return function(*args, **kwargs)
+            begin = _now()
+            result = function(*args, **kwargs)
+            end = _now()
+            _spans.append((spanname, category, begin, end,
+                           {"size": result.size} if sized else {}))
+            return result
+        return wrapper
+    return decorator
+
+
+def events():
+    """
+    Return the recorded spans, as Chrome trace complete events: dictionaries
+    with `name`, `cat`, `ph`, `ts`, `dur`, `pid`, `tid` and `args` keys.
+
+    :rtype: :class:`list`
+
+    """
+    _collect_dd_events()
+    pid = os.getpid()
+    return [{"name": name, "cat": category, "ph": "X",
+             "ts": begin, "dur": end - begin,
+             "pid": pid, "tid": 0, "args": args}
+            for name, category, begin, end, args in sorted(_spans,
+                                                  key=lambda s: s[2])]
+
+
+def swig_calls():
+    """
+    Return the number of calls to each NuSMV function, as a dictionary
+    associating the number of calls to the qualified name of the functions.
+
+    :rtype: :class:`dict`
+
+    """
+    return dict(_calls)
+
+
+def chrome_trace():
+    """
+    Return the recorded spans and calls in the Chrome trace event format.
+
+    :rtype: :class:`dict`
+
+    """
+    return {"traceEvents": events(),
+            "displayTimeUnit": "ms",
+            "otherData": {"swig_calls": swig_calls(),
+                          "dd_dropped_events": _dd_dropped}}
+
+
+def write_chrome_trace(out):
+    """
+    Write the recorded spans and calls to the `out` text file, in the Chrome
+    trace event format.
+
+    """
+    json.dump(chrome_trace(), out)
+
+
+def _wrap_swig_functions():
+    """
+    Replace the functions of the imported NuSMV modules by functions counting
+    their calls.
+
+    """
+    for modname, module in list(sys.modules.items()):
+        if (module is None or not modname.startswith("pynusmv.nusmv.") or
+                modname.split(".")[-1].startswith("_")):
+            continue
+        for name, function in list(vars(module).items()):
+            # The functions of this module are not counted
+            if (name.startswith("_") or name.startswith("dd_trace_") or
+                    isinstance(function, type) or not callable(function)):
+                continue
+            setattr(module, name, _counting(modname[len("pynusmv.nusmv."):] +
+                                            "." + name, function))
+            _wrapped.append((module, name, function))
+
+
+def _counting(name, function):
+    @functools.wraps(function)
+    def counted(*args, **kwargs):
+        _calls[name] = _calls.get(name, 0) + 1
+        return function(*args, **kwargs)
+    return counted
+
+
+def _attach():
+    """
+    Start recording the events of the global DD manager, if any and if DD
+    events are recorded. Called when NuSMV is initialized.
+
+    """
+    global _dd_traced
+    if not _enabled or _dd_capacity <= 0 or _dd_traced is not None:
+        return
+    manager = nscinit.cvar.dd_manager
+    if manager is not None and nsdd.dd_trace_start(manager, _dd_capacity):
+        _dd_traced = manager
+
+
+def _detach():
+    """
+    Stop recording the events of the global DD manager and collect them.
+    Called before NuSMV is deinitialized.
+
+    """
+    global _dd_traced
+    if _dd_traced is None:
+        return
+    _collect_dd_events()
+    nsdd.dd_trace_stop(_dd_traced)
+    nsdd.dd_trace_clear()
+    _dd_traced = None
+
+
+def _collect_dd_events():
+    """
+    Turn the recorded DD events into spans, and start recording anew.
+
+    """
+    global _dd_dropped
+    if _dd_traced is None:
+        return
+    opened = {}
+    for i in range(nsdd.dd_trace_get_event_count()):
+        kind = nsdd.dd_trace_get_event_kind(i)
+        when = nsdd.dd_trace_get_event_time(i)
+        nodes = nsdd.dd_trace_get_event_nodes(i)
+        if kind in _DD_SPANS:
+            opened[kind] = (when, nodes)
+        elif kind - 1 in opened:
+            begin, before = opened.pop(kind - 1)
+            _spans.append((_DD_SPANS[kind - 1], "dd", begin, when,
+                           {"nodes_before": before, "nodes_after": nodes}))
+    _dd_dropped += nsdd.dd_trace_get_dropped_count()
+    nsdd.dd_trace_start(_dd_traced, _dd_capacity)
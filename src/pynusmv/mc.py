@@ -5,7 +5,8 @@ model checking, like CTL model checking.
 
 __all__ = ['check_ctl_spec', 'eval_simple_expression', 'eval_ctl_spec',
            'ef', 'eg', 'ex', 'eu', 'au',
-           'explain', 'explainEX', 'explainEU', 'explainEG']
+           'explain', 'explainEX', 'explainEU', 'explainEG',
+           'MuEvaluator', 'MuFormula']
 
 
 from .nusmv.node import node as nsnode
@@ -14,6 +15,7 @@ from .nusmv.mc import mc as nsmc
 
 from .dd import BDD, State, Inputs, BDDList
 from .prop import atom
+from .utils import PointerWrapper
 
 
 def check_ctl_spec(fsm, spec, context=None):
@@ -139,6 +141,231 @@ def au(fsm, s1, s2):
     return BDD(nsmc.au(fsm._ptr, s1._ptr, s1._ptr),
                fsm.bddEnc.DDmanager, freeit=True)
 
+class MuEvaluator(PointerWrapper):
+
+    """
+    Native evaluator of mu-calculus formulas over a BDD FSM.
+
+    Formulas are built with the methods of the evaluator, combined with
+    `&`, `|` and `~`, and evaluated with :meth:`eval`. Fixpoint iterations run
+    in NuSMV, and the value of every subterm is cached as long as the
+    fixpoint variables it depends on do not change; the same formula can be
+    evaluated several times at low cost. Formulas are hash-consed: building
+    the same formula again reuses its cached value.
+
+    The formulas and their cached values are kept until the evaluator is
+    freed, so an evaluator should not outlive the computation it serves;
+    results shared between computations should rather be kept in caches
+    bounding the number of BDD nodes they use.
+
+    Fixpoint variables are integers between 0 and `MuEvaluator.MAX_VARS` - 1.
+
+    """
+
+    MAX_VARS = nsmc.MC_MU_MAX_VARS
+
+    def __init__(self, fsm):
+        """
+        Create a new evaluator for `fsm`.
+
+        :param fsm: the concerned FSM
+        :type fsm: :class:`BddFsm <pynusmv.fsm.BddFsm>`
+
+        """
+        super(MuEvaluator, self).__init__(nsmc.Mc_mu_context_create(fsm._ptr),
+                                          freeit=True)
+        self._fsm = fsm
+        # Transition relations must outlive their formulas
+        self._trans = {}
+
+    def _free(self):
+        if self._freeit and self._ptr is not None:
+            nsmc.Mc_mu_context_destroy(self._ptr)
+            self._freeit = False
+            self._ptr = None
+
+    def _formula(self, ptr):
+        return MuFormula(ptr, self)
+
+    def _check_var(self, var):
+        if not 0 <= var < MuEvaluator.MAX_VARS:
+            raise ValueError("fixpoint variable must be in 0.." +
+                             str(MuEvaluator.MAX_VARS - 1))
+
+    @property
+    def evaluations(self):
+        """The number of subterms evaluated by this evaluator."""
+        return nsmc.Mc_mu_get_evaluations(self._ptr)
+
+    @property
+    def cache_hits(self):
+        """The number of subterm values reused by this evaluator."""
+        return nsmc.Mc_mu_get_cache_hits(self._ptr)
+
+    def const(self, bdd):
+        """
+        The formula whose value is `bdd`.
+
+        :type bdd: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_const(self._ptr, bdd._ptr))
+
+    def var(self, var):
+        """
+        The fixpoint variable `var`.
+
+        :param var: the index of the variable
+        :type var: int
+        :rtype: :class:`MuFormula`
+
+        """
+        self._check_var(var)
+        return self._formula(nsmc.Mc_mu_var(self._ptr, var))
+
+    def lfp(self, var, body):
+        """
+        The least fixpoint of `body` on `var`.
+
+        :rtype: :class:`MuFormula`
+
+        """
+        self._check_var(var)
+        return self._formula(nsmc.Mc_mu_lfp(self._ptr, var, body._ptr))
+
+    def gfp(self, var, body):
+        """
+        The greatest fixpoint of `body` on `var`.
+
+        :rtype: :class:`MuFormula`
+
+        """
+        self._check_var(var)
+        return self._formula(nsmc.Mc_mu_gfp(self._ptr, var, body._ptr))
+
+    def pre(self, f):
+        """
+        The pre-image of `f` through the FSM.
+
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_pre(self._ptr, f._ptr))
+
+    def weak_pre(self, f):
+        """
+        The weak pre-image of `f` through the FSM, i.e. the state-inputs pairs
+        leading to `f`.
+
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_weak_pre(self._ptr, f._ptr))
+
+    def post(self, f):
+        """
+        The post-image of `f` through the FSM.
+
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_post(self._ptr, f._ptr))
+
+    def forsome(self, f, cube):
+        """
+        The existential abstraction of the variables of `cube` in `f`.
+
+        :type cube: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_forsome(self._ptr, f._ptr, cube._ptr))
+
+    def forall(self, f, cube):
+        """
+        The universal abstraction of the variables of `cube` in `f`.
+
+        :type cube: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_forall(self._ptr, f._ptr, cube._ptr))
+
+    def pre_strat(self, f, gamma_cube, strat=None):
+        """
+        The states for which there exist values of the inputs of
+        `gamma_cube` such that, for all values of the other inputs, all
+        successors belong to `f`, restricted to `strat` if not `None`.
+        This is the strategy pre-image of multi-agent systems.
+
+        :param gamma_cube: the cube of the inputs of the agents
+        :type gamma_cube: :class:`BDD <pynusmv.dd.BDD>`
+        :param strat: the allowed state-inputs pairs, or `None`
+        :type strat: :class:`BDD <pynusmv.dd.BDD>`
+        :rtype: :class:`MuFormula`
+
+        """
+        return self._formula(nsmc.Mc_mu_pre_strat(self._ptr, f._ptr,
+                                                  gamma_cube._ptr,
+                                                  strat and strat._ptr
+                                                  or None))
+
+    def pre_trans(self, f, trans):
+        """
+        The pre-image of `f` through `trans`.
+
+        :type trans: :class:`BddTrans <pynusmv.fsm.BddTrans>`
+        :rtype: :class:`MuFormula`
+
+        """
+        self._trans[id(trans)] = trans
+        return self._formula(nsmc.Mc_mu_pre_trans(self._ptr, f._ptr,
+                                                  trans._ptr))
+
+    def eval(self, f):
+        """
+        Evaluate `f`. All fixpoint variables of `f` must be bound.
+
+        :rtype: :class:`BDD <pynusmv.dd.BDD>`
+        :raise: a :exc:`ValueError` if `f` is not closed
+
+        """
+        if not f.closed:
+            raise ValueError("the formula has unbound fixpoint variables")
+        return BDD(nsmc.Mc_mu_eval(self._ptr, f._ptr),
+                   self._fsm.bddEnc.DDmanager, freeit=True)
+
+
+class MuFormula(object):
+
+    """
+    A mu-calculus formula built by a :class:`MuEvaluator`, and owned by it.
+
+    """
+
+    def __init__(self, ptr, evaluator):
+        self._ptr = ptr
+        self._evaluator = evaluator
+
+    @property
+    def closed(self):
+        """Whether all the fixpoint variables of this formula are bound."""
+        return bool(nsmc.Mc_mu_is_closed(self._ptr))
+
+    def __and__(self, other):
+        return self._evaluator._formula(
+            nsmc.Mc_mu_and(self._evaluator._ptr, self._ptr, other._ptr))
+
+    def __or__(self, other):
+        return self._evaluator._formula(
+            nsmc.Mc_mu_or(self._evaluator._ptr, self._ptr, other._ptr))
+
+    def __invert__(self):
+        return self._evaluator._formula(
+            nsmc.Mc_mu_not(self._evaluator._ptr, self._ptr))
+
+
 def explain(fsm, state, spec, context=None):
     """
     Explain why `state` of `fsm` satisfies `spec` in `context`.
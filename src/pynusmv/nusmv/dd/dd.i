@@ -81,6 +81,225 @@ int bdd_equal (bdd_ptr a, bdd_ptr b) {
 }
 %}
 
+// Handles of the BDDs owned by Python objects. Every DD manager keeps the
+// list of its live handles, so that they are all released at once before
+// quitting NuSMV, and a free list of handles to recycle.
+%{
+typedef struct BddHandleRegistry_TAG BddHandleRegistry;
+
+typedef struct BddHandle_TAG {
+    BddHandleRegistry* registry; /* NULL once released */
+    bdd_ptr node;
+    struct BddHandle_TAG* prev;
+    struct BddHandle_TAG* next;
+} BddHandle;
+
+struct BddHandleRegistry_TAG {
+    DdManager* dd;
+    BddHandle live; /* sentinel of the circular list of live handles */
+    BddHandle* free_list;
+    int count;
+    BddHandleRegistry* next;
+};
+
+static BddHandleRegistry* bdd_handle_registries = NULL;
+
+static BddHandleRegistry* bdd_handle_get_registry(DdManager* dd, int create)
+{
+    BddHandleRegistry* reg;
+
+    for (reg = bdd_handle_registries; reg != NULL; reg = reg->next) {
+        if (reg->dd == dd) return reg;
+    }
+    if (!create) return NULL;
+
+    reg = (BddHandleRegistry*) malloc(sizeof(BddHandleRegistry));
+    if (reg == NULL) return NULL;
+    reg->dd = dd;
+    reg->live.prev = reg->live.next = &reg->live;
+    reg->free_list = NULL;
+    reg->count = 0;
+    reg->next = bdd_handle_registries;
+    bdd_handle_registries = reg;
+    return reg;
+}
+%}
+
+typedef struct BddHandle_TAG* bdd_handle_ptr;
+
+%inline %{
+/* Wraps node, whose reference is transferred to the returned handle. */
+bdd_handle_ptr bdd_handle_new(DdManager* dd, bdd_ptr node)
+{
+    BddHandleRegistry* reg = bdd_handle_get_registry(dd, 1);
+    BddHandle* h;
+
+    if (reg == NULL) return NULL;
+    if (reg->free_list != NULL) {
+        h = reg->free_list;
+        reg->free_list = h->next;
+    }
+    else {
+        h = (BddHandle*) malloc(sizeof(BddHandle));
+        if (h == NULL) return NULL;
+    }
+
+    h->registry = reg;
+    h->node = node;
+    h->prev = &reg->live;
+    h->next = reg->live.next;
+    reg->live.next->prev = h;
+    reg->live.next = h;
+    reg->count++;
+    return h;
+}
+
+/* Frees the node of h, unless released by bdd_handle_release_all, and h. */
+void bdd_handle_free(bdd_handle_ptr h)
+{
+    BddHandleRegistry* reg = h->registry;
+
+    if (reg == NULL) {
+        free(h);
+        return;
+    }
+
+    bdd_free(reg->dd, h->node);
+    h->prev->next = h->next;
+    h->next->prev = h->prev;
+    reg->count--;
+
+    h->registry = NULL;
+    h->node = NULL;
+    h->next = reg->free_list;
+    reg->free_list = h;
+}
+
+/* Number of live handles of dd. */
+int bdd_handle_count(DdManager* dd)
+{
+    BddHandleRegistry* reg = bdd_handle_get_registry(dd, 0);
+    return reg == NULL ? 0 : reg->count;
+}
+
+/* Frees the nodes of all live handles, of all managers, and forgets the
+   registries. Live handles stay allocated, as they are still owned by
+   Python objects, and are only freed by bdd_handle_free. Returns the
+   number of released handles. */
+int bdd_handle_release_all(void)
+{
+    int released = 0;
+
+    while (bdd_handle_registries != NULL) {
+        BddHandleRegistry* reg = bdd_handle_registries;
+        BddHandle* h = reg->live.next;
+
+        while (h != &reg->live) {
+            BddHandle* next = h->next;
+            bdd_free(reg->dd, h->node);
+            h->registry = NULL;
+            h->node = NULL;
+            h->prev = h->next = NULL;
+            released++;
+            h = next;
+        }
+
+        while (reg->free_list != NULL) {
+            h = reg->free_list;
+            reg->free_list = h->next;
+            free(h);
+        }
+
+        bdd_handle_registries = reg->next;
+        free(reg);
+    }
+    return released;
+}
+%}
+
+// Python callables called by DD managers close to their memory budget.
+%{
+typedef struct MemoryBudgetCallback_TAG {
+    DdManager* dd;
+    PyObject* callable;
+    struct MemoryBudgetCallback_TAG* next;
+} MemoryBudgetCallback;
+
+static MemoryBudgetCallback* memory_budget_callbacks = NULL;
+
+static int memory_budget_hook(DdManager* dd, const char* str, void* data)
+{
+    MemoryBudgetCallback* cb;
+
+    for (cb = memory_budget_callbacks; cb != NULL; cb = cb->next) {
+        if (cb->dd == dd) {
+            /* The callable may unregister itself. */
+            PyObject* callable = cb->callable;
+            PyObject* res;
+
+            Py_INCREF(callable);
+            res = PyObject_CallObject(callable, NULL);
+            if (res == NULL) PyErr_WriteUnraisable(callable);
+            else Py_DECREF(res);
+            Py_DECREF(callable);
+            break;
+        }
+    }
+    return 1;
+}
+%}
+
+%inline %{
+/* Makes callable, a Python callable or None, the function called when dd
+   is close to its memory budget, replacing the previous one. It may free
+   BDDs, but must not build new ones. Returns 0 on failure. */
+int set_memory_budget_callback(DdManager* dd, PyObject* callable)
+{
+    MemoryBudgetCallback** prev = &memory_budget_callbacks;
+    MemoryBudgetCallback* cb;
+
+    while (*prev != NULL && (*prev)->dd != dd) prev = &(*prev)->next;
+    cb = *prev;
+
+    if (callable == Py_None) {
+        if (cb != NULL) {
+            *prev = cb->next;
+            Py_DECREF(cb->callable);
+            free(cb);
+            dd_remove_memory_budget_hook(dd, memory_budget_hook);
+        }
+        return 1;
+    }
+
+    if (cb == NULL) {
+        cb = (MemoryBudgetCallback*) malloc(sizeof(MemoryBudgetCallback));
+        if (cb == NULL) return 0;
+        if (dd_add_memory_budget_hook(dd, memory_budget_hook) == 0) {
+            free(cb);
+            return 0;
+        }
+        cb->dd = dd;
+        cb->next = memory_budget_callbacks;
+        memory_budget_callbacks = cb;
+    }
+    else Py_DECREF(cb->callable);
+    Py_INCREF(callable);
+    cb->callable = callable;
+    return 1;
+}
+
+/* Forgets the callables of all managers, before quitting NuSMV. */
+void memory_budget_callbacks_clear(void)
+{
+    while (memory_budget_callbacks != NULL) {
+        MemoryBudgetCallback* cb = memory_budget_callbacks;
+        memory_budget_callbacks = cb->next;
+        Py_DECREF(cb->callable);
+        free(cb);
+    }
+}
+%}
+
 %include ../../../nusmv/src/utils/defs.h
 %include ../../../nusmv/src/dd/dd.h
 %include ../../../nusmv/src/dd/VarsHandler.h
\ No newline at end of file
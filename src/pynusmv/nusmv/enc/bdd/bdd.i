@@ -282,6 +282,91 @@ int BddEnc_force_order_from_filename(const BddEnc_ptr self,
     return 0;
 }
 
+
+// Snapshots: names are passed as arrays of strings (see utils),
+// BDDs as bddArray for saving and as array_t for loading.
+int _save_bdds(BddEnc_ptr self, const char* filename, int n,
+               bdd_ptr* bdds, array_t* names) {
+    // array_data returns a copy of the array contents
+    const char** data = array_data(const char*, names);
+    int result = BddEnc_save_bdds(self, filename, n, bdds, data);
+    FREE(data);
+    return result;
+}
+
+// Result is NULL if an error occured, the array of loaded BDDs otherwise
+array_t* _load_bdds(BddEnc_ptr self, const char* filename,
+                    boolean restore_order, array_t* names) {
+    array_t* bdds = array_alloc(bdd_ptr, 0);
+    if (BddEnc_load_bdds(self, filename, restore_order, names, bdds) != 0) {
+        array_free(bdds);
+        return NULL;
+    }
+    return bdds;
+}
+
+int _array_size(array_t* array) {
+    return array_n(array);
+}
+
+bdd_ptr _array_fetch_bdd(array_t* array, int i) {
+    return array_fetch(bdd_ptr, array, i);
+}
+
+void _free_strings(array_t* array) {
+    int i;
+    for (i = 0; i < array_n(array); ++i) {
+        char* str = array_fetch(char*, array, i);
+        if (str != (char*) NULL) { FREE(str); }
+    }
+    array_free(array);
+}
+
+
+// Bulk decoding: the codes are returned as a (n, bytes) pair where bytes
+// holds count C ints per symbol and n is the number of decoded states, the
+// values of each symbol are appended to values (see BddEnc_decode_states).
+// Result is None if states has more than count states.
+PyObject* _decode_states(BddEnc_ptr self, bdd_ptr states,
+                         NodeList_ptr symbols, int count, array_t* values) {
+    const long len = (long) count * NodeList_get_length(symbols);
+    int* codes = ALLOC(int, len + 1);
+    PyObject* result;
+    int n;
+
+    n = BddEnc_decode_states(self, states, symbols, codes, count, values);
+    if (n < 0) {
+        FREE(codes);
+        Py_RETURN_NONE;
+    }
+    result = Py_BuildValue("(iN)", n,
+                           PyBytes_FromStringAndSize((const char*) codes,
+                                                     sizeof(int) * len));
+    FREE(codes);
+    return result;
+}
+
+array_t* _new_arrays(void) {
+    return array_alloc(array_t*, 0);
+}
+
+array_t* _array_fetch_array(array_t* array, int i) {
+    return array_fetch(array_t*, array, i);
+}
+
+node_ptr _array_fetch_node(array_t* array, int i) {
+    return array_fetch(node_ptr, array, i);
+}
+
+void _free_arrays(array_t* array) {
+    int i;
+    for (i = 0; i < array_n(array); ++i) {
+        array_t* inner = array_fetch(array_t*, array, i);
+        if (inner != (array_t*) NULL) { array_free(inner); }
+    }
+    array_free(array);
+}
+
 %}
 
 
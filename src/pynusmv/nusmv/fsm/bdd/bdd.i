@@ -13,9 +13,6 @@
 #include "../../../../nusmv/src/fsm/bdd/bddInt.h"
 %}
 
-// Ignoring unimplemented functions
-%ignore BddFsm_get_fair_states_subset;
-
 %feature("autodoc", 1);
 
 %include ../../typedefs.tpl
@@ -15,6 +15,12 @@
 
 %include ../typedefs.tpl
 
+%inline %{
+SatSolver_ptr incsolver2solver(SatIncSolver_ptr solver) {
+    return (SatSolver_ptr) solver;
+}
+%}
+
 %include ../../../nusmv/src/utils/defs.h
 %include ../../../nusmv/src/utils/object.h
 %include ../../../nusmv/src/sat/sat.h
@@ -8,6 +8,7 @@
 #include "../../../../nusmv/src/utils/object.h"
 #include "../../../../nusmv/src/trace/loaders/TraceLoader.h" 
 #include "../../../../nusmv/src/trace/loaders/TraceXmlLoader.h" 
+#include "../../../../nusmv/src/trace/loaders/TraceBinaryLoader.h" 
 %}
 
 %feature("autodoc", 1);
@@ -17,4 +18,5 @@
 %include ../../../../nusmv/src/utils/defs.h
 %include ../../../../nusmv/src/utils/object.h
 %include ../../../../nusmv/src/trace/loaders/TraceLoader.h
-%include ../../../../nusmv/src/trace/loaders/TraceXmlLoader.h
\ No newline at end of file
+%include ../../../../nusmv/src/trace/loaders/TraceXmlLoader.h
+%include ../../../../nusmv/src/trace/loaders/TraceBinaryLoader.h
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "../../../../nusmv/src/trace/plugins/TracePlugin.h" 
 #include "../../../../nusmv/src/trace/plugins/TraceTable.h" 
 #include "../../../../nusmv/src/trace/plugins/TraceXmlDumper.h" 
+#include "../../../../nusmv/src/trace/plugins/TraceBinaryDumper.h" 
 %}
 
 %feature("autodoc", 1);
@@ -23,4 +24,5 @@
 %include ../../../../nusmv/src/trace/plugins/TraceExplainer.h
 %include ../../../../nusmv/src/trace/plugins/TracePlugin.h
 %include ../../../../nusmv/src/trace/plugins/TraceTable.h
-%include ../../../../nusmv/src/trace/plugins/TraceXmlDumper.h
\ No newline at end of file
+%include ../../../../nusmv/src/trace/plugins/TraceXmlDumper.h
+%include ../../../../nusmv/src/trace/plugins/TraceBinaryDumper.h
\ No newline at end of file
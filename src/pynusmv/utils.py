@@ -5,10 +5,11 @@ used by PyNuSMV internals.
 """
 
 
-__all__ = ['PointerWrapper', 'fixpoint', 'update']
+__all__ = ['PointerWrapper', 'fixpoint', 'greatest_fixpoint', 'update']
 
 
 from pynusmv.init import _register_wrapper
+from pynusmv import instrument
 
 
 class PointerWrapper(object):
@@ -82,12 +83,51 @@ def fixpoint(funct, start):
 
     """
 
-    old = start
-    new = funct(start)
-    while old != new:
-        old = new
-        new = funct(old)
-    return old
+    with instrument.span("fixpoint", "fixpoint"):
+        old = start
+        new = _iterate(funct, start)
+        while old != new:
+            old = new
+            new = _iterate(funct, old)
+        return old
+
+
+def greatest_fixpoint(funct, over):
+    """
+    Return the greatest fixpoint of `funct`, as a BDD, warm-started from the
+    `over` BDD.
+
+    `funct` must be monotone and `over` must contain its greatest fixpoint,
+    for example the greatest fixpoint of a less constrained function. Each
+    iterate is intersected with the previous one, so the iterates decrease
+    from `over` down to the greatest fixpoint. If `over` does not contain the
+    greatest fixpoint, a subset of it is returned.
+
+    :rtype: :class:`BDD <pynusmv.dd.BDD>`
+
+    .. note:: `greatest_fixpoint(funct, true)` is `fixpoint(funct, true)`.
+
+    """
+    with instrument.span("greatest fixpoint", "fixpoint"):
+        old = over
+        new = over & _iterate(funct, over)
+        while old != new:
+            old = new
+            new = old & _iterate(funct, old)
+        return old
+
+
+def _iterate(funct, bdd):
+    """
+    Return `funct(bdd)`, recording the iteration if instrumentation is
+    enabled.
+
+    """
+    with instrument.span("iteration", "fixpoint") as iteration:
+        new = funct(bdd)
+        if iteration:
+            iteration.set(size=new.size)
+        return new
 
 
 def update(old, new):
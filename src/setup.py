@@ -958,6 +958,7 @@ extensions.append(
                             'nusmv/src/utils/object.h',
                             'nusmv/src/trace/loaders/TraceLoader.h',
                             'nusmv/src/trace/loaders/TraceXmlLoader.h',
+                            'nusmv/src/trace/loaders/TraceBinaryLoader.h',
                             'lib/libnusmv.so',
                             
                             'pynusmv/nusmv/typedefs.tpl',
@@ -979,6 +980,7 @@ extensions.append(
                             'nusmv/src/trace/plugins/TracePlugin.h',
                             'nusmv/src/trace/plugins/TraceTable.h',
                             'nusmv/src/trace/plugins/TraceXmlDumper.h',
+                            'nusmv/src/trace/plugins/TraceBinaryDumper.h',
                             'lib/libnusmv.so',
                             
                             'pynusmv/nusmv/typedefs.tpl',
@@ -2,11 +2,13 @@ import unittest
 import sys
 
 from pynusmv.nusmv.cmd import cmd
+from pynusmv.nusmv.dd import dd as nsdd
+from pynusmv.nusmv.opt import opt as nsopt
 
 from pynusmv.prop import PropDb
 from pynusmv.dd import (BDD, enable_dynamic_reordering,
                         disable_dynamic_reordering, dynamic_reordering_enabled,
-                        reorder)
+                        reorder, set_reordering_budget)
 from pynusmv.fsm import BddFsm
 from pynusmv.mc import eval_simple_expression
 from pynusmv.exception import MissingManagerError
@@ -47,6 +49,106 @@ class TestBDD(unittest.TestCase):
         self.assertTupleEqual(("state", "admin"),
                               fsm.bddEnc.get_variables_ordering())
     
+    def test_reordering_budget(self):
+        fsm, enc, manager = self.init_model()
+        opts = nsopt.OptsHandler_get_instance()
+        
+        with self.assertRaises(ValueError):
+            set_reordering_budget(manager, time_limit=-1)
+        
+        set_reordering_budget(manager, time_limit=100, total_limit=1000,
+                              between_iterations=True)
+        self.assertEqual(nsopt.get_reorder_time_limit(opts), 100)
+        self.assertEqual(nsopt.get_reorder_total_limit(opts), 1000)
+        self.assertTrue(nsopt.opt_reorder_between_iterations(opts))
+        
+        # Reordering is suspended during the computation, then resumed
+        enable_dynamic_reordering(manager)
+        reachable = fsm.reachable_states
+        self.assertTrue(dynamic_reordering_enabled(manager))
+        init = fsm.init
+        self.assertTrue(init <= reachable)
+        
+        set_reordering_budget(manager)
+        self.assertEqual(nsopt.get_reorder_time_limit(opts), 0)
+        self.assertEqual(nsopt.get_reorder_total_limit(opts), 0)
+        self.assertFalse(nsopt.opt_reorder_between_iterations(opts))
+    
+    def test_reorder_if_due(self):
+        fsm = BddFsm.from_filename("tests/pynusmv/models/comparator.smv")
+        manager = fsm.bddEnc.DDmanager
+        enable_dynamic_reordering(manager)
+        reorderings = nsdd.dd_get_reorderings(manager._ptr)
+        
+        # No reordering happens while it is suspended, even though the
+        # comparator goes well beyond the first reordering threshold
+        suspended = nsdd.dd_autodyn_suspend(manager._ptr)
+        self.assertTrue(suspended)
+        self.assertIsNone(dynamic_reordering_enabled(manager))
+        equal = eval_simple_expression(fsm, "equal")
+        size = equal.size
+        self.assertTrue(size > 4096)
+        self.assertEqual(nsdd.dd_get_reorderings(manager._ptr), reorderings)
+        
+        # The postponed reordering takes place, and is no longer due once
+        # done
+        self.assertTrue(nsdd.dd_reorder_if_due(manager._ptr))
+        self.assertEqual(nsdd.dd_get_reorderings(manager._ptr),
+                         reorderings + 1)
+        self.assertTrue(equal.size < size)
+        self.assertFalse(nsdd.dd_reorder_if_due(manager._ptr))
+        
+        nsdd.dd_autodyn_resume(manager._ptr, suspended)
+        self.assertTrue(dynamic_reordering_enabled(manager))
+    
+    def test_memory_budget(self):
+        fsm, enc, manager = self.init_model()
+        
+        with self.assertRaises(ValueError):
+            manager.set_memory_budget(-1)
+        with self.assertRaises(ValueError):
+            manager.set_memory_budget(1, callback=42)
+        
+        cache = [fsm.pre(fsm.init)]
+        def drop():
+            del cache[:]
+        
+        reachable = fsm.reachable_states
+        states = fsm.pick_all_states(enc.statesMask)
+        
+        # A budget below the current usage reclaims memory at every page
+        manager.set_memory_budget(manager.memory_in_use // 2, callback=drop)
+        self.assertEqual(manager.memory_in_use // 2, manager.memory_budget)
+        # Keep all sets of states alive, to fill new pages of nodes
+        subsets = []
+        for i in range(2 ** len(states)):
+            subset = BDD.false(manager)
+            for j, state in enumerate(states):
+                if i & (1 << j):
+                    subset = subset | state
+            subsets.append(subset)
+        self.assertGreater(manager.memory_budget_events, 0)
+        self.assertEqual(cache, [])
+        self.assertTrue(fsm.init <= reachable)
+        
+        manager.set_memory_budget(0)
+        self.assertEqual(0, manager.memory_budget)
+        del subset, subsets
+        before = manager.memory_in_use
+        self.assertGreater(manager.release_memory(), 0)
+        self.assertLess(manager.memory_in_use, before)
+        self.assertTrue(fsm.init <= reachable)
+    
+    def test_cache_stats(self):
+        fsm, enc, manager = self.init_model()
+        
+        reachable = fsm.reachable_states
+        stats = manager.cache_stats
+        self.assertIn("bddAnd", stats)
+        for op in stats.values():
+            self.assertLessEqual(op["hits"], op["lookups"])
+            self.assertLessEqual(op["evictions"], op["inserts"])
+    
     
     def test_get_true(self):
         (fsm, enc, manager) = self.init_model()
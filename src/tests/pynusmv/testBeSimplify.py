@@ -0,0 +1,115 @@
+import unittest
+
+from pynusmv.init import init_nusmv, deinit_nusmv
+
+from pynusmv.nusmv.be import be as nsbe
+from pynusmv.nusmv.bmc import bmc as nsbmc
+from pynusmv.nusmv.sat import sat as nssat
+from pynusmv.nusmv.opt import opt as nsopt
+
+class TestBeSimplify(unittest.TestCase):
+
+    def setUp(self):
+        init_nusmv()
+        self.mgr = nsbe.Be_RbcManager_Create(8)
+        self.vars = [nsbe.Be_Index2Var(self.mgr, i) for i in range(6)]
+
+    def tearDown(self):
+        nsbe.Be_RbcManager_Delete(self.mgr)
+        deinit_nusmv()
+
+    def equivalent(self, f, g):
+        """
+        Return whether f and g are equivalent, i.e. whether their exclusive
+        or is unsatisfiable.
+
+        """
+        diff = nsbe.Be_Xor(self.mgr, f, g)
+        if nsbe.Be_IsFalse(self.mgr, diff):
+            return True
+        if nsbe.Be_IsTrue(self.mgr, diff):
+            return False
+
+        solver = nssat.Sat_CreateNonIncSolver(
+                            nsopt.get_sat_solver(nsopt.OptsHandler_get_instance()))
+        self.assertIsNotNone(solver)
+        cnf = nsbe.Be_ConvertToCnf(self.mgr, diff, 1)
+        group = nssat.SatSolver_get_permanent_group(solver)
+        nssat.SatSolver_add(solver, cnf, group)
+        nssat.SatSolver_set_polarity(solver, cnf, 1, group)
+        result = nssat.SatSolver_solve_all_groups(solver)
+        nssat.SatSolver_destroy(solver)
+        nsbe.Be_Cnf_Delete(cnf)
+        return result == nssat.SAT_SOLVER_UNSATISFIABLE_PROBLEM
+
+    def clauses(self, f):
+        cnf = nsbe.Be_ConvertToCnf(self.mgr, f, 1)
+        number = nsbe.Be_Cnf_GetClausesNumber(cnf)
+        nsbe.Be_Cnf_Delete(cnf)
+        return number
+
+    def formulas(self):
+        mgr = self.mgr
+        And = lambda f, g: nsbe.Be_And(mgr, f, g)
+        Or = lambda f, g: nsbe.Be_Or(mgr, f, g)
+        Not = lambda f: nsbe.Be_Not(mgr, f)
+        a, b, c, d, e, g = self.vars
+
+        # Two structurally different exclusive ors of a and b
+        x1 = And(Or(a, b), Not(And(a, b)))
+        x2 = Or(And(a, Not(b)), And(Not(a), b))
+
+        # A linear chain of conjunctions, with a duplicate conjunct
+        chain = a
+        for v in [b, c, d, e, g, c]:
+            chain = And(chain, v)
+
+        return [x1, x2, And(x1, x2), Or(x1, Not(x2)), chain,
+                Or(chain, And(c, a)), Not(And(chain, Not(x1))),
+                nsbe.Be_Ite(mgr, x1, chain, x2),
+                nsbe.Be_Iff(mgr, And(a, And(b, c)), And(And(a, b), c))]
+
+
+    def test_equivalent(self):
+        a, b, c, d, e, g = self.vars
+        self.assertTrue(self.equivalent(nsbe.Be_And(self.mgr, a, b),
+                                        nsbe.Be_And(self.mgr, b, a)))
+        self.assertFalse(self.equivalent(a, b))
+        self.assertFalse(self.equivalent(nsbe.Be_And(self.mgr, a, b),
+                                         nsbe.Be_Or(self.mgr, a, b)))
+
+
+    def test_balancing(self):
+        for f in self.formulas():
+            balanced = nsbe.Be_apply_balancing(self.mgr, f)
+            self.assertTrue(self.equivalent(f, balanced))
+
+
+    def test_sweeping(self):
+        opts = nsopt.OptsHandler_get_instance()
+        # Inlining only preserves satisfiability
+        nsopt.unset_rbc_inlining(opts)
+        nsopt.set_rbc_sweeping(opts)
+
+        for f in self.formulas():
+            swept = nsbmc.Bmc_Utils_apply_inlining(self.mgr, f)
+            self.assertTrue(self.equivalent(f, swept))
+            self.assertTrue(self.clauses(swept) <= self.clauses(f))
+
+        # The two exclusive ors are merged
+        x1, x2, both, valid = self.formulas()[:4]
+        swept = nsbmc.Bmc_Utils_apply_inlining(self.mgr, both)
+        self.assertTrue(self.clauses(swept) < self.clauses(both))
+        swept = nsbmc.Bmc_Utils_apply_inlining(self.mgr, valid)
+        self.assertTrue(nsbe.Be_IsTrue(self.mgr, swept))
+
+
+    def test_balancing_and_sweeping(self):
+        opts = nsopt.OptsHandler_get_instance()
+        nsopt.unset_rbc_inlining(opts)
+        nsopt.set_rbc_balancing(opts)
+        nsopt.set_rbc_sweeping(opts)
+
+        for f in self.formulas():
+            simplified = nsbmc.Bmc_Utils_apply_inlining4inc(self.mgr, f)
+            self.assertTrue(self.equivalent(f, simplified))
@@ -1,10 +1,12 @@
 import unittest
+import os
+import tempfile
 
 from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv.fsm import BddFsm
 from pynusmv.dd import BDD
 from pynusmv.mc import eval_simple_expression as evalSexp
-from pynusmv.exception import NuSMVBddPickingError
+from pynusmv.exception import NuSMVBddPickingError, NuSMVBddSnapshotError
 
 class TestEnc(unittest.TestCase):
     
@@ -141,4 +143,32 @@ class TestEnc(unittest.TestCase):
         self.assertTupleEqual(new_order,
                               fsm.bddEnc.get_variables_ordering()
                               [:len(new_order)])
-        
\ No newline at end of file
+        
+    
+    def test_save_load_bdds(self):
+        fsm = self.counters_model()
+        handle, path = tempfile.mkstemp(suffix=".snap")
+        os.close(handle)
+        try:
+            fsm.bddEnc.save_bdds(path, {"init": fsm.init,
+                                        "reachable": fsm.reachable_states,
+                                        "false": BDD.false(fsm.bddEnc.DDmanager)})
+            
+            # Reload in a fresh session, with another order
+            deinit_nusmv()
+            init_nusmv()
+            fsm = self.counters_model()
+            fsm.bddEnc.force_variables_ordering(("c2.c", "run", "c1.c"))
+            bdds = fsm.bddEnc.load_bdds(path, restore_order=False)
+            self.assertSetEqual({"init", "reachable", "false"}, set(bdds))
+            self.assertEqual(fsm.init, bdds["init"])
+            self.assertEqual(fsm.reachable_states, bdds["reachable"])
+            self.assertTrue(bdds["false"].is_false())
+            
+            bdds = fsm.bddEnc.load_bdds(path)
+            self.assertEqual(fsm.reachable_states, bdds["reachable"])
+        finally:
+            os.remove(path)
+        
+        with self.assertRaises(NuSMVBddSnapshotError):
+            fsm.bddEnc.load_bdds(path)
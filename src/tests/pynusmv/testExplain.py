@@ -118,7 +118,41 @@ class TestExplain(unittest.TestCase):
         for i in range(0,len(path), 2):
             self.assertTrue(path[i] <= adminAlice)
         self.assertTrue(path[-1] <= adminAlice)
-    
+
+
+    def test_explain_rings(self):
+        fsm = self.init_model()
+        fsm.rings_budget = 2 ** 20
+        self.assertEqual(fsm.rings_budget, 2 ** 20)
+
+        initState = fsm.pick_one_state(fsm.init)
+        adminNone = eval_ctl_spec(fsm, atom("admin = none"))
+        adminAlice = eval_ctl_spec(fsm, atom("admin = alice"))
+        euNoneUAlice = eval_ctl_spec(fsm, eu(atom("admin = none"),
+                                             atom("admin = alice")))
+        egAlice = eval_ctl_spec(fsm, eg(atom("admin = alice")))
+        self.assertTrue(initState <= euNoneUAlice)
+
+        # Witnesses from the cached onion rings
+        path = explainEU(fsm, initState, adminNone, adminAlice)
+        self.assertEqual(initState, path[0])
+        for i in range(2,len(path)-2,2):
+            self.assertTrue(path[i] <= adminNone)
+            self.assertTrue(path[i+2] <= fsm.post(path[i]))
+        self.assertTrue(path[-1] <= adminAlice)
+
+        state = fsm.pick_one_state(egAlice)
+        egpath, (inloop, loop) = explainEG(fsm, state, adminAlice)
+        self.assertEqual(state, egpath[0])
+        self.assertIn(loop, egpath)
+        for i in range(0,len(egpath), 2):
+            self.assertTrue(egpath[i] <= adminAlice)
+
+        # Without rings, the search gives a path of the same, minimal, length
+        fsm.rings_budget = 0
+        searched = explainEU(fsm, initState, adminNone, adminAlice)
+        self.assertEqual(len(path), len(searched))
+
     def test_explain(self):
         fsm = self.init_model()
         
@@ -1,4 +1,8 @@
 import unittest
+import os
+import shutil
+import tempfile
+import xml.etree.ElementTree as ET
 
 from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv.fsm import BddFsm
@@ -11,6 +15,9 @@ from pynusmv import node
 from pynusmv.nusmv.compile.symb_table import symb_table as nssymb_table
 from pynusmv.nusmv.utils import utils as nsutils
 from pynusmv.nusmv.node import node as nsnode
+from pynusmv.nusmv.cmd import cmd as nscmd
+from pynusmv.nusmv.opt import opt as nsopt
+from pynusmv.nusmv.prop import prop as nsprop
 
 class TestFsm(unittest.TestCase):
     
@@ -51,6 +58,87 @@ class TestFsm(unittest.TestCase):
         self.assertEqual(p & q, fsm.reachable_states)
     
     
+    def test_guided_reachable_states(self):
+        fsm = BddFsm.from_filename("tests/pynusmv/models/counters.smv")
+        self.assertIsNotNone(fsm)
+        
+        # Exact fixpoint through post
+        reached = fsm.init
+        new = fsm.post(reached) - reached
+        while new.isnot_false():
+            reached = reached | new
+            new = fsm.post(new) - reached
+        
+        # A threshold of one node forces subsetting every frontier
+        self.assertEqual(reached, fsm.compute_reachable_states(threshold=1))
+        self.assertEqual(reached, fsm.reachable_states)
+        
+        with self.assertRaises(ValueError):
+            fsm.compute_reachable_states(threshold=-1)
+    
+    
+    def check_invar(self, invar):
+        """
+        Check invar with check_invar and return its status and the list of
+        states of its counterexample, as dictionaries of values.
+        
+        """
+        ret = nscmd.Cmd_SecureCommandExecute("check_invar -p \"" + invar +
+                                             "\"")
+        self.assertEqual(ret, 0)
+        propDb = nsprop.PropPkg_get_prop_database()
+        p = nsprop.PropDb_get_prop_at_index(propDb,
+                                            nsprop.PropDb_get_size(propDb) - 1)
+        status = nsprop.Prop_get_status(p)
+        if status != nsprop.Prop_False:
+            return status, []
+        
+        tmpdir = tempfile.mkdtemp()
+        try:
+            path = os.path.join(tmpdir, "trace.xml")
+            ret = nscmd.Cmd_SecureCommandExecute("show_traces -p 4 -o %s %d" %
+                                                 (path,
+                                                  nsprop.Prop_get_trace(p)))
+            self.assertEqual(ret, 0)
+            root = ET.parse(path).getroot()
+        finally:
+            shutil.rmtree(tmpdir)
+        
+        # Unchanged values may be omitted, they are carried over
+        states = []
+        values = {}
+        for state in root.iter("state"):
+            values = dict(values)
+            values.update((value.get("variable"), value.text)
+                          for value in state.iter("value"))
+            states.append(values)
+        return status, states
+    
+    
+    def test_guided_check_invar(self):
+        fsm = BddFsm.from_filename("tests/pynusmv/models/counters.smv")
+        self.assertIsNotNone(fsm)
+        opts = nsopt.OptsHandler_get_instance()
+        nsopt.set_guided_reachability_threshold(opts, 1)
+        
+        status, states = self.check_invar("c1.c in 0..2 & c2.c in 0..2")
+        self.assertEqual(status, nsprop.Prop_True)
+        
+        # Both counters must run twice to violate the invariant
+        status, states = self.check_invar("!(c1.c = 2 & c2.c = 2)")
+        self.assertEqual(status, nsprop.Prop_False)
+        self.assertTrue(len(states) >= 5)
+        
+        # The trace is a path from an initial state to a violating state
+        bdds = [evalSexp(fsm, "c1.c = {} & c2.c = {}"
+                              .format(state["c1.c"], state["c2.c"]))
+                for state in states]
+        self.assertTrue(bdds[0] <= fsm.init)
+        for current, following in zip(bdds, bdds[1:]):
+            self.assertTrue((fsm.post(current) & following).isnot_false())
+        self.assertTrue(bdds[-1] <= evalSexp(fsm, "c1.c = 2 & c2.c = 2"))
+    
+    
     def test_deadlock_states_without_deadlock(self):
         fsm = self.model()
         self.assertEqual(fsm.deadlock_states, BDD.false(fsm))
@@ -305,6 +393,31 @@ class TestFsm(unittest.TestCase):
         astates = fsm.pick_all_states(a)
         self.assertEqual(len(astates), 4) # Contains all states
         
+        
+    def test_decode_states(self):
+        fsm = self.model()
+        
+        false = BDD.false(fsm.bddEnc.DDmanager)
+        p = evalSexp(fsm, "p")
+        a = evalSexp(fsm, "a")
+        
+        table = fsm.decode_states(a)
+        rows = set()
+        for i in range(fsm.count_states(a)):
+            rows.add(tuple(sorted((var, values[codes[i]])
+                                  for var, (values, codes) in table.items())))
+        expected = set(tuple(sorted(state.get_str_values().items()))
+                       for state in fsm.pick_all_states(a))
+        self.assertEqual(rows, expected)
+        
+        table = fsm.decode_states(p)
+        values, codes = table["p"]
+        self.assertEqual(len(codes), 2)
+        self.assertEqual(set(values[code] for code in codes), {"TRUE"})
+        
+        table = fsm.decode_states(false)
+        self.assertTrue(all(len(codes) == 0 for _, codes in table.values()))
+        
           
     def test_pick_inputs(self):
         fsm = self.model()
@@ -366,8 +479,47 @@ class TestFsm(unittest.TestCase):
         
         bdd = trans.monolithic
         self.assertIsNotNone(bdd)
-        
-        
+
+
+    def test_monolithic_clusters(self):
+        from pynusmv.nusmv.trans.bdd import bdd as nsbddtrans
+
+        fsm = self.model()
+        dd = fsm.bddEnc.DDmanager
+        false = BDD.false(dd)
+        true = BDD.true(dd)
+        p = evalSexp(fsm, "p")
+        q = evalSexp(fsm, "q")
+        a = evalSexp(fsm, "a")
+        parts = [p | q, q | a, ~p | a, p | ~a, q | ~a, ~q | p, true]
+
+        def monolithic(bdds):
+            clusters = nsbddtrans.ClusterList_create(dd._ptr)
+            for bdd in bdds:
+                cluster = nsbddtrans.Cluster_create(dd._ptr)
+                nsbddtrans.Cluster_set_trans(cluster, dd._ptr, bdd._ptr)
+                nsbddtrans.ClusterList_append_cluster(clusters, cluster)
+            ptr = nsbddtrans.ClusterList_get_monolithic_bdd(clusters)
+            nsbddtrans.ClusterList_destroy(clusters)
+            return BDD(ptr, dd, freeit=True)
+
+        # The clusters are conjoined along a balanced tree
+        for n in range(len(parts) + 1):
+            expected = true
+            for bdd in parts[:n]:
+                expected = expected & bdd
+            self.assertEqual(monolithic(parts[:n]), expected)
+
+            # A false cluster anywhere gives false
+            for k in range(n):
+                self.assertEqual(monolithic(parts[:k] + [false] +
+                                            parts[k + 1:n]),
+                                 false)
+
+        self.assertEqual(monolithic([fsm.trans.monolithic]),
+                         fsm.trans.monolithic)
+
+
     def test_set_trans(self):
         fsm = self.model()
         
@@ -409,6 +561,26 @@ class TestFsm(unittest.TestCase):
             self.assertTrue(fair == rc1 or fair == rc2)
             
     
+    def test_fair_states_inputs_in(self):
+        fsm = BddFsm.from_filename("tests/pynusmv/models/counters-fair.smv")
+        self.assertIsNotNone(fsm)
+        
+        true = BDD.true(fsm.bddEnc.DDmanager)
+        rc1 = evalSexp(fsm, "run = rc1")
+        
+        fair = fsm.fair_states_inputs_in(true)
+        self.assertTrue(fsm.fair_states & fsm.bddEnc.statesMask <=
+                        fair.forsome(fsm.bddEnc.inputsCube))
+        
+        # Never running rc1 violates its fairness constraint
+        self.assertTrue(fsm.fair_states_inputs_in(~rc1).is_false())
+        
+        # Warm-starting from the fair pairs of a larger subspace
+        subspace = fsm.reachable_states
+        self.assertEqual(fsm.fair_states_inputs_in(subspace, over=fair),
+                         fsm.fair_states_inputs_in(subspace))
+    
+    
     def test_no_fairness(self):
         fsm = BddFsm.from_filename("tests/pynusmv/models/counters.smv")
         self.assertIsNotNone(fsm)
@@ -2,6 +2,7 @@ import unittest
 
 from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv.fsm import BddFsm
+from pynusmv.nusmv.dd import dd as nsdd
 
 class TestGC(unittest.TestCase):
     
@@ -17,4 +18,28 @@ class TestGC(unittest.TestCase):
         fsm = BddFsm.from_filename("tests/pynusmv/models/admin.smv")
         init = fsm.init
         
-        deinit_nusmv()
\ No newline at end of file
+        deinit_nusmv()
+    
+    def test_bdd_handles(self):
+        """
+        BDDs are not tracked by the PyNuSMV GC system but by the handles of
+        their manager: a live BDD has one handle, released when the BDD is
+        freed or when deiniting NuSMV.
+        """
+        init_nusmv()
+        
+        fsm = BddFsm.from_filename("tests/pynusmv/models/admin.smv")
+        manager = fsm.bddEnc.DDmanager
+        init = fsm.init
+        count = nsdd.bdd_handle_count(manager._ptr)
+        
+        bdds = [init & fsm.post(init) for i in range(100)]
+        self.assertEqual(count + 100, nsdd.bdd_handle_count(manager._ptr))
+        del bdds
+        self.assertEqual(count, nsdd.bdd_handle_count(manager._ptr))
+        
+        deinit_nusmv()
+        self.assertEqual(0, nsdd.bdd_handle_count(manager._ptr))
+        
+        # Freeing a BDD after deiniting NuSMV must not touch the manager
+        del init
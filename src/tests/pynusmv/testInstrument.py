@@ -0,0 +1,87 @@
+import unittest
+import json
+from io import StringIO
+
+from pynusmv.init import init_nusmv, deinit_nusmv
+from pynusmv.fsm import BddFsm
+from pynusmv.dd import BDD, reorder
+from pynusmv.mc import eval_simple_expression as evalSexp
+from pynusmv.utils import fixpoint as fp
+from pynusmv import instrument
+
+class TestInstrument(unittest.TestCase):
+
+    def setUp(self):
+        init_nusmv()
+        instrument.clear()
+
+    def tearDown(self):
+        instrument.disable()
+        instrument.clear()
+        deinit_nusmv()
+
+    def model(self):
+        fsm = BddFsm.from_filename("tests/pynusmv/models/counters.smv")
+        self.assertIsNotNone(fsm)
+        return fsm
+
+
+    def test_disabled(self):
+        fsm = self.model()
+
+        self.assertFalse(instrument.is_enabled())
+        fsm.post(fsm.init)
+        self.assertEqual(instrument.events(), [])
+        self.assertEqual(instrument.swig_calls(), {})
+        with instrument.span("nothing") as span:
+            self.assertFalse(span)
+
+
+    def test_fixpoint_spans(self):
+        fsm = self.model()
+
+        instrument.enable()
+        self.assertTrue(instrument.is_enabled())
+        false = BDD.false(fsm.bddEnc.DDmanager)
+        reachable = fp(lambda Z: fsm.init | fsm.post(Z), false)
+        with instrument.span("forced reorder", "test") as span:
+            self.assertTrue(span)
+            reorder()
+            span.set(size=reachable.size)
+        instrument.disable()
+
+        self.assertEqual(reachable, fsm.reachable_states)
+
+        events = instrument.events()
+        names = [event["name"] for event in events]
+        self.assertEqual(names.count("fixpoint"), 1)
+        self.assertTrue(names.count("iteration") >= 2)
+        self.assertEqual(names.count("iteration"), names.count("post"))
+        # The reordering is recorded by the DD manager
+        self.assertIn("reorder", [event["name"] for event in events
+                                  if event["cat"] == "dd"])
+
+        fixpoint = events[names.index("fixpoint")]
+        for event in events:
+            if event["name"] == "iteration":
+                self.assertTrue(event["ts"] >= fixpoint["ts"])
+                self.assertTrue(event["ts"] + event["dur"] <=
+                                fixpoint["ts"] + fixpoint["dur"])
+                self.assertIn("size", event["args"])
+
+        calls = instrument.swig_calls()
+        self.assertTrue(calls["fsm.bdd.bdd.BddFsm_get_forward_image"] >=
+                        names.count("post"))
+
+        out = StringIO()
+        instrument.write_chrome_trace(out)
+        trace = json.loads(out.getvalue())
+        self.assertEqual(len(trace["traceEvents"]), len(events))
+        self.assertEqual(trace["otherData"]["swig_calls"], calls)
+
+        # Disabling restores the NuSMV functions
+        fsm.post(fsm.init)
+        self.assertEqual(instrument.swig_calls(), calls)
+
+        instrument.clear()
+        self.assertEqual(instrument.events(), [])
@@ -1,4 +1,5 @@
 import unittest
+import weakref
 
 from pynusmv.nusmv.cmd import cmd
 from pynusmv.nusmv.prop import prop as nsprop
@@ -8,6 +9,8 @@ from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv import mc
 from pynusmv import glob
 from pynusmv import prop
+from pynusmv.dd import BDD
+from pynusmv.utils import fixpoint
 
 
 class TestMC(unittest.TestCase):
@@ -52,4 +55,62 @@ class TestMC(unittest.TestCase):
         for p in propDb:
             if p.type == prop.propTypes["CTL"]:
                 spec = p.expr
-                self.assertEqual(mc.check_ctl_spec(fsm, spec), ret[str(spec)])
\ No newline at end of file
+                self.assertEqual(mc.check_ctl_spec(fsm, spec), ret[str(spec)])
+    
+    def test_mu_evaluator(self):
+        glob.load_from_file("tests/pynusmv/models/admin.smv")
+        glob.compute_model()
+        fsm = glob.prop_database().master.bddFsm
+        
+        alice = mc.eval_simple_expression(fsm, "admin = alice")
+        mu = mc.MuEvaluator(fsm)
+        
+        # EF alice = mu Z. alice | EX Z
+        efalice = mu.lfp(0, mu.const(alice) | mu.pre(mu.var(0)))
+        false = BDD.false(fsm.bddEnc.DDmanager)
+        true = BDD.true(fsm.bddEnc.DDmanager)
+        ef = fixpoint(lambda Z: alice | fsm.pre(Z), false)
+        self.assertEqual(mu.eval(efalice), ef)
+        
+        # EG alice = nu Z. alice & EX Z
+        egalice = mu.gfp(0, mu.const(alice) & mu.pre(mu.var(0)))
+        eg = fixpoint(lambda Z: alice & fsm.pre(Z), true)
+        self.assertEqual(mu.eval(egalice), eg)
+        
+        # Closed subterms are cached between evaluations
+        evaluations = mu.evaluations
+        self.assertEqual(mu.eval(~efalice), ~ef)
+        self.assertEqual(mu.evaluations, evaluations + 1)
+        self.assertTrue(mu.cache_hits > 0)
+        
+        with self.assertRaises(ValueError):
+            mu.var(mc.MuEvaluator.MAX_VARS)
+        
+        # Open formulas cannot be evaluated
+        self.assertFalse(mu.var(0).closed)
+        self.assertTrue(efalice.closed)
+        with self.assertRaises(ValueError):
+            mu.eval(mu.const(alice) | mu.pre(mu.var(0)))
+        
+        # Formulas are hash-consed, building one again reuses its value
+        evaluations = mu.evaluations
+        again = mu.lfp(0, mu.const(alice) | mu.pre(mu.var(0)))
+        self.assertEqual(mu.eval(again), ef)
+        self.assertEqual(mu.evaluations, evaluations)
+    
+    def test_mu_evaluator_lifetime(self):
+        glob.load_from_file("tests/pynusmv/models/admin.smv")
+        glob.compute_model()
+        fsm = glob.prop_database().master.bddFsm
+        
+        alice = mc.eval_simple_expression(fsm, "admin = alice")
+        false = BDD.false(fsm.bddEnc.DDmanager)
+        mu = mc.MuEvaluator(fsm)
+        ef = mu.eval(mu.lfp(0, mu.const(alice) | mu.pre(mu.var(0))))
+        
+        # The formulas and their values are freed with the evaluator,
+        # the results outlive it
+        ref = weakref.ref(mu)
+        del mu
+        self.assertIsNone(ref())
+        self.assertEqual(ef, fixpoint(lambda Z: alice | fsm.pre(Z), false))
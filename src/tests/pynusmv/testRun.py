@@ -18,4 +18,53 @@ class TestRun(unittest.TestCase):
 		ret = cmd.Cmd_SecureCommandExecute("check_ctlspec")
 		self.assertEqual(ret, 0)
 		
-		cinit.NuSMVCore_quit()
\ No newline at end of file
+		cinit.NuSMVCore_quit()
+	
+	
+	def check_invars(self, parallel, options="-k 10 -e -a een-sorensson"):
+		from pynusmv.nusmv.cinit import cinit
+		from pynusmv.nusmv.cmd import cmd
+		from pynusmv.nusmv.prop import prop
+		
+		cinit.NuSMVCore_init_data()
+		cinit.NuSMVCore_init(None, 0)
+		
+		ret = cmd.Cmd_SecureCommandExecute("read_model -i"
+		                                   " tests/pynusmv/models/admin.smv")
+		self.assertEqual(ret, 0)
+		ret = cmd.Cmd_SecureCommandExecute("go_bmc")
+		self.assertEqual(ret, 0)
+		if parallel:
+			ret = cmd.Cmd_SecureCommandExecute("set bmc_parallel_induction 1")
+			self.assertEqual(ret, 0)
+		
+		statuses = []
+		for invar in ["state = starting -> admin = none", "admin != bob"]:
+			ret = cmd.Cmd_SecureCommandExecute("check_invar_bmc " +
+			                                   options +
+			                                   " -p \"" + invar + "\"")
+			self.assertEqual(ret, 0)
+			propDb = prop.PropPkg_get_prop_database()
+			p = prop.PropDb_get_prop_at_index(propDb,
+			                                  prop.PropDb_get_size(propDb) - 1)
+			statuses.append(prop.Prop_get_status(p))
+		
+		cinit.NuSMVCore_quit()
+		return statuses
+	
+	
+	def test_run_parallel_induction(self):
+		from pynusmv.nusmv.prop import prop
+		
+		expected = [prop.Prop_True, prop.Prop_False]
+		self.assertEqual(self.check_invars(False), expected)
+		self.assertEqual(self.check_invars(True), expected)
+		
+		# Without the extra step, and with the lookahead cut at the bound
+		for options in ["-k 10 -a een-sorensson", "-k 1 -a een-sorensson"]:
+			self.assertEqual(self.check_invars(True, options),
+			                 self.check_invars(False, options))
+		
+		# The base and the step of the classic induction
+		self.assertEqual(self.check_invars(True, "-a classic"),
+		                 self.check_invars(False, "-a classic"))
@@ -0,0 +1,96 @@
+import unittest
+
+from pynusmv.init import init_nusmv, deinit_nusmv
+
+from pynusmv.nusmv.be import be as nsbe
+from pynusmv.nusmv.sat import sat as nssat
+from pynusmv.nusmv.opt import opt as nsopt
+
+class TestSat(unittest.TestCase):
+
+    def setUp(self):
+        init_nusmv()
+        self.mgr = nsbe.Be_RbcManager_Create(4)
+        self.a, self.b, self.c = [nsbe.Be_Index2Var(self.mgr, i)
+                                  for i in range(3)]
+
+    def tearDown(self):
+        nsbe.Be_RbcManager_Delete(self.mgr)
+        deinit_nusmv()
+
+    def add(self, solver, formula, group):
+        cnf = nsbe.Be_ConvertToCnf(self.mgr, formula, 1)
+        nssat.SatSolver_add(solver, cnf, group)
+        nssat.SatSolver_set_polarity(solver, cnf, 1, group)
+        nsbe.Be_Cnf_Delete(cnf)
+
+    def solve(self, solver):
+        result = nssat.SatSolver_solve_all_groups(solver)
+        self.assertIn(result, [nssat.SAT_SOLVER_SATISFIABLE_PROBLEM,
+                               nssat.SAT_SOLVER_UNSATISFIABLE_PROBLEM])
+        return result == nssat.SAT_SOLVER_SATISFIABLE_PROBLEM
+
+    def check_groups(self, period):
+        """
+        Create and destroy many groups in an incremental solver simplifying
+        its clause database every period destroyed groups, and check that
+        every answer stays correct.
+
+        """
+        opts = nsopt.OptsHandler_get_instance()
+        nsopt.set_sat_simplify_period(opts, period)
+        self.assertEqual(nsopt.get_sat_simplify_period(opts), period)
+
+        mgr = self.mgr
+        a, b, c = self.a, self.b, self.c
+        incsolver = nssat.Sat_CreateIncSolver(
+                            nsopt.get_sat_solver(opts))
+        self.assertIsNotNone(incsolver)
+        solver = nssat.incsolver2solver(incsolver)
+
+        self.add(solver, nsbe.Be_Or(mgr, a, b),
+                 nssat.SatSolver_get_permanent_group(solver))
+        # A group living across all the destructions
+        kept = nssat.SatIncSolver_create_group(incsolver)
+        self.add(solver, nsbe.Be_Not(mgr, c), kept)
+
+        for i in range(5 * period + 3):
+            group = nssat.SatIncSolver_create_group(incsolver)
+            if i % 3 == 0:
+                # Contradicts the permanent clause
+                self.add(solver, nsbe.Be_And(mgr, nsbe.Be_Not(mgr, a),
+                                             nsbe.Be_Not(mgr, b)), group)
+                self.assertFalse(self.solve(solver))
+            elif i % 3 == 1:
+                # Contradicts the kept group
+                self.add(solver, c, group)
+                self.assertFalse(self.solve(solver))
+            else:
+                self.add(solver, nsbe.Be_And(mgr, a, nsbe.Be_Not(mgr, b)),
+                         group)
+                self.assertTrue(self.solve(solver))
+            nssat.SatIncSolver_destroy_group(incsolver, group)
+
+            # The destroyed group no longer constrains the problem
+            self.assertTrue(self.solve(solver))
+
+        # The clauses of the kept group are still there
+        group = nssat.SatIncSolver_create_group(incsolver)
+        self.add(solver, c, group)
+        self.assertFalse(self.solve(solver))
+        nssat.SatIncSolver_destroy_group(incsolver, group)
+        nssat.SatIncSolver_destroy_group(incsolver, kept)
+
+        group = nssat.SatIncSolver_create_group(incsolver)
+        self.add(solver, c, group)
+        self.assertTrue(self.solve(solver))
+
+        nssat.SatIncSolver_destroy(incsolver)
+
+
+    def test_destroy_groups(self):
+        opts = nsopt.OptsHandler_get_instance()
+        self.assertEqual(nsopt.get_sat_simplify_period(opts),
+                         nsopt.DEFAULT_SAT_SIMPLIFY_PERIOD)
+        for period in [1, 3, nsopt.DEFAULT_SAT_SIMPLIFY_PERIOD]:
+            self.check_groups(period)
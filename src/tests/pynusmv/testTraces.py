@@ -0,0 +1,86 @@
+import unittest
+import os
+import re
+import shutil
+import tempfile
+import xml.etree.ElementTree as ET
+
+from pynusmv.nusmv.cmd import cmd
+from pynusmv.nusmv.utils import utils as nsutils
+
+from pynusmv.init import init_nusmv, deinit_nusmv
+
+class TestTraces(unittest.TestCase):
+
+    def setUp(self):
+        init_nusmv()
+        ret = cmd.Cmd_SecureCommandExecute("read_model -i"
+                                           " tests/pynusmv/models/admin.smv")
+        self.assertEqual(ret, 0)
+        ret = cmd.Cmd_SecureCommandExecute("go")
+        self.assertEqual(ret, 0)
+        # A lasso-shaped counterexample, as trace 1
+        ret = cmd.Cmd_SecureCommandExecute("check_ltlspec"
+                                           " -p \"G admin != alice\"")
+        self.assertEqual(ret, 0)
+        self.tmpdir = tempfile.mkdtemp()
+
+    def tearDown(self):
+        shutil.rmtree(self.tmpdir)
+        deinit_nusmv()
+
+    def show(self, trace, plugin):
+        path = os.path.join(self.tmpdir, "trace%d.%d" % (trace, plugin))
+        ret = cmd.Cmd_SecureCommandExecute("show_traces -p %d -o %s %d" %
+                                           (plugin, path, trace))
+        self.assertEqual(ret, 0)
+        with open(path, "rb") as f:
+            return f.read()
+
+    def steps(self, trace):
+        """
+        Return the text dump of the states and loopbacks of trace, without
+        the trace number.
+
+        """
+        text = self.show(trace, 1).decode()
+        self.assertIn("Loop starts here", text)
+        return [re.sub(r"State: \d+\.", "State: ", line)
+                for line in text.splitlines()
+                if line.strip().startswith("->") or
+                   line.strip().startswith("--") or
+                   "=" in line]
+
+
+    def test_binary_round_trip(self):
+        binary = self.show(1, 6)
+        path = os.path.join(self.tmpdir, "trace1.6")
+        ret = cmd.Cmd_SecureCommandExecute("read_trace -b " + path)
+        self.assertEqual(ret, 0)
+
+        # Same steps, values and loopbacks
+        self.assertEqual(self.steps(2), self.steps(1))
+        self.assertEqual(self.show(2, 6), binary)
+
+
+    def test_binary_truncated(self):
+        binary = self.show(1, 6)
+        path = os.path.join(self.tmpdir, "truncated")
+        with open(path, "wb") as f:
+            f.write(binary[:len(binary) // 2])
+        ret = cmd.Cmd_SecureCommandExecute("read_trace -b " + path)
+        self.assertNotEqual(ret, 0)
+
+
+    def test_xml_escaping(self):
+        self.assertEqual(nsutils.Utils_str_escape_xml_string("a<b&\"c\">'"),
+                         "a&lt;b&amp;&quot;c&quot;&gt;&apos;")
+
+        # The description contains spaces, escaped as character references
+        dump = self.show(1, 4)
+        self.assertNotIn(b"desc=\"LTL Counterexample\"", dump)
+        root = ET.fromstring(dump)
+        self.assertEqual(root.get("desc"), "LTL Counterexample")
+        values = {value.get("variable"): value.text
+                  for value in root.iter("value")}
+        self.assertEqual(values["admin"], "alice")
@@ -26,6 +26,7 @@ class TestCheckPartial(unittest.TestCase):
         #config.garbage.type = "step"
         #config.garbage.step = 4
         config.partial.alternate.type = {"univ", "strat"}
+        config.partial.parallel.workers = 0
     
     def tearDown(self):    
         glob.reset_globals()
@@ -143,6 +144,21 @@ class TestCheckPartial(unittest.TestCase):
         self.assertTrue(check(fsm, parseATLK("<'player'> F <'player'>[~'lose' U 'win']")[0], implem="partial"))
         
 
+    def test_cardgame_post_fair_not_improved_partial_parallel(self):
+        fsm = self.cardgame_post_fair()
+        config.partial.parallel.workers = 2
+        config.partial.parallel.chunk = 1
+        
+        self.assertTrue(check(fsm, parseATLK("['player'] X 'pcard=Ac'")[0], implem="partial"))
+        self.assertTrue(check(fsm, parseATLK("<'dealer'> G ~'win'")[0], implem="partial"))
+        self.assertTrue(check(fsm, parseATLK("<'player'> F 'win'")[0], implem="partial"))
+        self.assertTrue(check(fsm, parseATLK("<'player'> G <'player'> F 'win'")[0], implem="partial"))
+        
+        config.partial.early.type = None
+        self.assertFalse(check(fsm, parseATLK("['dealer'] F 'win'")[0], implem="partial"))
+        self.assertTrue(check(fsm, parseATLK("<'player'> F <'player'>[~'lose' U 'win']")[0], implem="partial"))
+        
+
     def test_transmission_not_improved_partial(self):
         fsm = self.transmission()
         
@@ -10,6 +10,10 @@ from tools.mas import glob
 
 from tools.atlkPO.eval import split, cex_si, nfair_gamma_si, nfair_gamma
 from tools.atlkPO.evalPartial import reach, split_reach, split as psplit
+from tools.atlkPO.evalSymb import (nfair_gamma_si as snfair_gamma_si,
+                                   ceg_si as sceg_si)
+from tools.atlkPO import evalGen, evalPartial, config
+from tools.atlkFO.parsing import parseATLK
 
 from pynusmv.utils import fixpoint as fp
 
@@ -226,6 +230,104 @@ class TestEval(unittest.TestCase):
         self.assertTrue(fsm.protocol({'dealer'}) <= nfd)
         
         
+    def test_warm_nfair_gamma_si(self):
+        fsm = self.cardgame_post_fair()
+        
+        agents = {'dealer'}
+        notwin = ~eval_simple_expression(fsm, "win")
+        
+        # Fixpoints for the whole protocol bound the ones of its strategies
+        bounds = []
+        nfair = snfair_gamma_si(fsm, agents, fsm.protocol(agents), bounds)
+        self.assertEqual(len(bounds), len(fsm.fairness_constraints))
+        self.assertEqual(nfair, snfair_gamma_si(fsm, agents,
+                                                fsm.protocol(agents)))
+        ceg = sceg_si(fsm, agents, notwin, fsm.protocol(agents))
+        
+        for strat in split(fsm, fsm.protocol(agents), agents):
+            self.assertEqual(snfair_gamma_si(fsm, agents, strat, list(bounds)),
+                             snfair_gamma_si(fsm, agents, strat))
+            self.assertEqual(sceg_si(fsm, agents, notwin, strat, over=ceg,
+                                     fair_over=list(bounds)),
+                             sceg_si(fsm, agents, notwin, strat))
+        
+        
+    def test_bounded_filter_strat(self):
+        fsm = self.cardgame_post_fair()
+        
+        agents = {'dealer'}
+        protocol = fsm.protocol(agents) & fsm.reachable_states
+        strats = list(evalGen.split(fsm, protocol, agents))
+        
+        for spec in ["<'dealer'> G ~'win'", "<'dealer'> F 'win'",
+                     "<'dealer'> X 'pcard=Ac'",
+                     "<'dealer'> ['step = 0' W 'win']"]:
+            spec = parseATLK(spec)[0]
+            
+            # The fixpoints for the whole protocol bound the ones of the
+            # strategies
+            bounds = []
+            over = evalGen.filter_strat(fsm, spec, protocol,
+                                        fair_over=bounds)
+            self.assertEqual(len(bounds), len(fsm.fairness_constraints))
+            
+            sat = BDD.false(fsm.bddEnc.DDmanager)
+            for strat in strats:
+                winning = evalGen.filter_strat(fsm, spec, strat)
+                self.assertEqual(evalGen.filter_strat(fsm, spec, strat,
+                                                      over=over,
+                                                      fair_over=list(bounds)),
+                                 winning)
+                sat |= evalGen.all_equiv_sat(fsm,
+                                    winning.forsome(fsm.bddEnc.inputsCube),
+                                    agents)
+            
+            self.assertEqual(evalGen.eval_strat(fsm, spec), sat)
+            self.assertEqual(evalGen.eval_strat_FSF(fsm, spec), sat)
+            
+            # Same for the partial strategies, with the bounds of the
+            # pre-filtering
+            states = fsm.reachable_states
+            bounds = []
+            evalPartial.filter_strat(fsm, spec, states, fair_over=bounds)
+            for strat in strats:
+                bounded = evalPartial.filter_strat(fsm, spec, states, strat,
+                                                   fair_over=list(bounds))
+                self.assertEqual(bounded,
+                                 evalPartial.filter_strat(fsm, spec, states,
+                                                          strat))
+            
+            # The workers receive the bounds of the pre-filtering too
+            filtering = config.partial.filtering
+            workers = config.partial.parallel.workers
+            chunk = config.partial.parallel.chunk
+            try:
+                config.partial.filtering = True
+                config.partial.parallel.workers = 0
+                expected = evalPartial.eval_strat(fsm, spec, states)
+                config.partial.parallel.workers = 2
+                config.partial.parallel.chunk = 1
+                self.assertEqual(evalPartial.eval_strat(fsm, spec, states),
+                                 expected)
+            finally:
+                config.partial.filtering = filtering
+                config.partial.parallel.workers = workers
+                config.partial.parallel.chunk = chunk
+        
+        
+    def test_fair_states_sub(self):
+        fsm = self.cardgame_post_fair()
+        
+        true = BDD.true(fsm.bddEnc.DDmanager)
+        agents = {'dealer'}
+        for subsystem in ([true, fsm.protocol(agents)] +
+                          list(evalGen.split(fsm, fsm.protocol(agents) &
+                                                  fsm.reachable_states,
+                                             agents))):
+            self.assertEqual(evalPartial.fair_states_sub(fsm, subsystem),
+                             evalPartial.eg_sub(fsm, true, subsystem))
+        
+        
     def test_nfair_gamma_si_trans2_fair(self):
         fsm = self.trans2_fair()
         
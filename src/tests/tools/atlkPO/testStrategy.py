@@ -0,0 +1,92 @@
+import unittest
+
+from pynusmv.dd import BDD
+from pynusmv.init import init_nusmv, deinit_nusmv
+from pynusmv.mc import eval_simple_expression
+from pynusmv.exception import PyNuSMVError
+
+from tools.mas import glob
+
+from tools.atlkPO.evalSymb import ceu_si, ceg_si
+from tools.atlkPO.strategy import ceu_strategy, ceg_strategy
+
+from pynusmv.utils import fixpoint as fp
+
+
+class TestStrategy(unittest.TestCase):
+
+    def setUp(self):
+        init_nusmv()
+
+    def tearDown(self):
+        glob.reset_globals()
+        deinit_nusmv()
+
+
+    def cardgame(self):
+        glob.load_from_file("tests/tools/atlkPO/models/cardgame.smv")
+        fsm = glob.mas()
+        self.assertIsNotNone(fsm)
+        return fsm
+
+    def cardgame_fair(self):
+        glob.load_from_file("tests/tools/atlkPO/models/cardgame-fair.smv")
+        fsm = glob.mas()
+        self.assertIsNotNone(fsm)
+        return fsm
+
+
+    def test_ceu_strategy(self):
+        fsm = self.cardgame()
+
+        true = BDD.true(fsm.bddEnc.DDmanager)
+        false = BDD.false(fsm.bddEnc.DDmanager)
+        win = eval_simple_expression(fsm, "step = 2 & pcard = Ac")
+
+        winning = ceu_si(fsm, {"player"}, true, win).forsome(
+                                                    fsm.bddEnc.inputsCube)
+
+        strat = ceu_strategy(fsm, {"player"}, true, win)
+        self.assertTrue(strat.memoryless)
+        self.assertEqual(strat.domain(), winning)
+
+        # Following the strategy, all paths reach win
+        enforced = fp(lambda Y: win | strat.pre(Y), false)
+        self.assertTrue(winning <= enforced)
+
+        # The restricted relation keeps some transitions only
+        state = fsm.pick_one_state(winning & fsm.reachable_states)
+        self.assertTrue(strat.post(state) <= fsm.post(state))
+        self.assertTrue(strat.outcome(state) <= fsm.reachable_states)
+
+        # The bounded-memory strategy counts down the iterations
+        bounded = ceu_strategy(fsm, {"player"}, true, win, memoryless=False)
+        self.assertFalse(bounded.memoryless)
+        self.assertEqual(bounded.domain(), winning)
+        self.assertEqual(bounded.domain(bounded.memory),
+                         win & fsm.bddEnc.statesMask)
+        reached = winning
+        for step in range(bounded.memory - 1):
+            reached = bounded.post(reached & bounded.domain(step), step)
+        self.assertTrue(reached <= win)
+
+
+    def test_ceg_strategy(self):
+        fsm = self.cardgame()
+
+        notq = eval_simple_expression(fsm, "pcard != Q")
+
+        winning = ceg_si(fsm, {"player"}, notq).forsome(fsm.bddEnc.inputsCube)
+
+        strat = ceg_strategy(fsm, {"player"}, notq)
+        self.assertEqual(strat.domain(), winning)
+        self.assertTrue(strat.domain() <= notq)
+        self.assertTrue(strat.domain() <= strat.pre(strat.domain()))
+
+
+    def test_strategy_fairness(self):
+        fsm = self.cardgame_fair()
+
+        true = BDD.true(fsm.bddEnc.DDmanager)
+        with self.assertRaises(PyNuSMVError):
+            ceu_strategy(fsm, {"player"}, true, true)
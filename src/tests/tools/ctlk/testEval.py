@@ -4,7 +4,7 @@ from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv.mc import eval_simple_expression
 
 from tools.mas import glob
-from tools.ctlk.eval import evalCTLK
+from tools.ctlk.eval import evalCTLK, set_cache_budget
 from tools.ctlk.parsing import parseCTLK
 
 from tools.ctlk.eval import nd
@@ -490,4 +490,63 @@ class TestEval(unittest.TestCase):
         self.assertEqual(len(specs), 1)
         spec = specs[0]
         ec123 = evalCTLK(fsm, spec)        
-        self.assertTrue(fsm.reachable_states <= ec123)
\ No newline at end of file
+        self.assertTrue(fsm.reachable_states <= ec123)
+        
+        
+    def test_cached_subformulas(self):
+        fsm = self.model()
+        
+        spec1 = parseCTLK("nK<'c1'> 'c2.payer' & 'countsay = odd'")[0]
+        spec2 = parseCTLK("nK<'c1'> 'c2.payer' | 'countsay = even'")[0]
+        
+        # Equal subformulas of different specifications are evaluated once
+        nk1 = evalCTLK(fsm, spec1.left)
+        self.assertIs(nk1, evalCTLK(fsm, spec2.left))
+        self.assertIs(evalCTLK(fsm, spec1),
+                      evalCTLK(fsm, parseCTLK("nK<'c1'> 'c2.payer' & "
+                                              "'countsay = odd'")[0]))
+        
+        # Without cache, the results are the same
+        set_cache_budget(0)
+        try:
+            self.assertEqual(nk1, evalCTLK(fsm, spec2.left))
+            self.assertIsNot(evalCTLK(fsm, spec2), evalCTLK(fsm, spec2))
+            self.assertEqual(evalCTLK(fsm, spec2),
+                             nk1 | eval_simple_expression(fsm,
+                                                          "countsay = even"))
+        finally:
+            set_cache_budget(2 ** 20)
+
+        
+        
+    def test_no_evaluator_kept(self):
+        import gc
+        from pynusmv.mc import MuEvaluator
+        fsm = self.model()
+        
+        # EG is evaluated by a mu-calculus evaluator, freed afterwards
+        spec = parseCTLK("EG 'countsay = odd'")[0]
+        evalCTLK(fsm, spec)
+        gc.collect()
+        self.assertEqual([obj for obj in gc.get_objects()
+                          if isinstance(obj, MuEvaluator)], [])
+        
+        
+    def test_cache_dropped_on_deinit(self):
+        from tools.ctlk import eval as ctlkeval
+        from tools.utils import evalcache
+        fsm = self.model()
+        
+        spec = parseCTLK("nK<'c1'> 'c2.payer' & 'countsay = odd'")[0]
+        evalCTLK(fsm, spec)
+        self.assertIsNotNone(ctlkeval._cache.get(fsm, evalcache.cons(spec)))
+        self.assertTrue(len(evalcache._consed) > 0)
+        
+        # Representatives and results do not outlive NuSMV
+        del fsm
+        glob.reset_globals()
+        deinit_nusmv()
+        self.assertEqual(len(ctlkeval._cache._results), 0)
+        self.assertEqual(len(evalcache._consed), 0)
+        self.assertEqual(len(evalcache._representatives), 0)
+        init_nusmv()
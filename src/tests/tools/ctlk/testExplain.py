@@ -4,7 +4,8 @@ from pynusmv.init import init_nusmv, deinit_nusmv
 from pynusmv.mc import eval_simple_expression
 
 from tools.mas import glob
-from tools.ctlk.eval import evalCTLK, ex, eu, eg, nk, nd, ne, nc
+from tools.ctlk.eval import (evalCTLK, ex, eu, eg, nk, nd, ne, nc, eu_rings,
+                             set_rings_budget)
 from tools.ctlk.parsing import parseCTLK
 
 from tools.ctlk.explain import (explain_ex, explain_eg, explain_eu,
@@ -155,7 +156,57 @@ class TestExplain(unittest.TestCase):
         self.assertTrue(witness[-2] <=
                         fsm.get_inputs_between_states(witness[-3], witness[-1]))
         self.assertTrue(witness[-1] <= odd)
-        
+
+    def test_eu_rings_dincry(self):
+        fsm = self.model()
+
+        c1p = eval_simple_expression(fsm, "c1.payer")
+        odd = eval_simple_expression(fsm, "countsay = odd")
+
+        # Without kept rings
+        set_rings_budget(0)
+        try:
+            eus = eu(fsm, c1p, odd)
+            state = fsm.pick_one_state(eus & fsm.init)
+            searched = explain_eu(fsm, state, c1p, odd)
+        finally:
+            set_rings_budget(2 ** 20)
+
+        # With kept rings
+        self.assertEqual(eu(fsm, c1p, odd), eus)
+        rings = eu_rings(fsm, c1p, odd)
+        self.assertIs(eu_rings(fsm, c1p, odd), rings)
+        union = rings[0]
+        for layer in rings[1:]:
+            self.assertTrue((layer & union).is_false())
+            self.assertTrue(layer <= c1p)
+            union = union | layer
+        self.assertEqual(union, eus)
+
+        witness = explain_eu(fsm, state, c1p, odd)
+        self.assertEqual(witness[0], state)
+        self.assertEqual(len(witness), len(searched))
+        for (s, i, sp) in zip(witness[:-2:2], witness[1:-2:2], witness[2::2]):
+            self.assertTrue(i <= fsm.get_inputs_between_states(s, sp))
+        self.assertTrue(witness[-1] <= odd)
+
+    def test_rings_dropped_on_deinit(self):
+        from tools.ctlk import eval as ctlkeval
+        fsm = self.model()
+
+        c1p = eval_simple_expression(fsm, "c1.payer")
+        odd = eval_simple_expression(fsm, "countsay = odd")
+        eu(fsm, c1p, odd)
+        self.assertTrue(len(ctlkeval._rings) > 0)
+
+        # The kept rings do not outlive NuSMV
+        del fsm, c1p, odd
+        glob.reset_globals()
+        deinit_nusmv()
+        self.assertEqual(len(ctlkeval._rings), 0)
+        self.assertEqual(ctlkeval._rings_size, 0)
+        init_nusmv()
+
     def test_eg_simple(self):
         fsm = self.simplemodel()
         
@@ -154,6 +154,18 @@ class TestMAS(unittest.TestCase):
         self.assertEqual(fsm.equivalent_states(c1p, {"c1"}), c1p)
         self.assertEqual(fsm.equivalent_states(c1p, {"c2"}), true)
         
+    def test_equivalent_states_projection_vs_relation(self):
+        fsm = self.cardgame()
+        
+        states = fsm.reachable_states
+        for agents in ({"player"}, {"dealer"}, {"player", "dealer"}):
+            for s in fsm.pick_all_states(states):
+                projected = fsm.equivalent_states(s, agents)
+                fsm._compute_epistemic_trans(agents)
+                related = (fsm._epistemic_trans[frozenset(agents)].pre(
+                           s & fsm.state_constraints) & fsm.state_constraints)
+                self.assertEqual(projected, related)
+        
         
     def test_reachable_states_for_simple_model(self):
         glob.load_from_file("tests/tools/ctlk/agents.smv")
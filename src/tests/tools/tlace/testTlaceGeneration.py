@@ -7,6 +7,8 @@ from pynusmv.prop import PropDb
 from pynusmv import glob
 
 from tools.tlace.check import check
+from tools.tlace.explain import Budget
+from tools.tlace.xml import xml_representation
 
 from pynusmv.init import init_nusmv, deinit_nusmv
 
@@ -99,4 +101,63 @@ class TestTlaceGeneration(unittest.TestCase):
         
         res = check(fsm, spec)
         self.assertFalse(res[0], "spec should be violated")
-        self.assertIsNotNone(res[1], "TLACE should be given")
\ No newline at end of file
+        self.assertIsNotNone(res[1], "TLACE should be given")
+        
+    
+    def test_check_lazy_spec(self):
+        # Initialize the model
+        ret = cmd.Cmd_SecureCommandExecute("read_model -i"
+                                     "tests/tools/tlace/admin.smv")
+        self.assertEqual(ret, 0, "cannot read the model")
+        ret = cmd.Cmd_SecureCommandExecute("go")
+        self.assertEqual(ret, 0, "cannot build the model")
+        
+        propDb = glob.prop_database()
+        fsm = propDb.master.bddFsm
+        self.assertTrue(propDb.get_size() >= 2, "propDb misses some props")
+        # AF AG(state = processing) is explained by an EG branch
+        # with nested EF branches
+        spec = propDb.get_prop_at_index(1).exprcore
+        
+        res = check(fsm, spec, Budget(lazy=True))
+        self.assertFalse(res[0], "spec should be violated")
+        branch = res[1].branches[0]
+        self.assertFalse(branch.expanded)
+        self.assertIn('explained="false"',
+                      xml_representation(fsm, res[1], spec))
+        
+        path, loop = branch.path
+        self.assertTrue(branch.expanded)
+        self.assertTrue(branch.explained)
+        self.assertIsNotNone(loop)
+        self.assertEqual(path[0].state, res[1].state)
+        for node in path[::2]:
+            for nested in node.branches:
+                self.assertFalse(nested.expanded)
+        
+        
+    def test_check_budget_spec(self):
+        # Initialize the model
+        ret = cmd.Cmd_SecureCommandExecute("read_model -i"
+                                     "tests/tools/tlace/admin.smv")
+        self.assertEqual(ret, 0, "cannot read the model")
+        ret = cmd.Cmd_SecureCommandExecute("go")
+        self.assertEqual(ret, 0, "cannot build the model")
+        
+        propDb = glob.prop_database()
+        fsm = propDb.master.bddFsm
+        spec = propDb.get_prop_at_index(1).exprcore
+        
+        # Only the top branch is explained
+        res = check(fsm, spec, Budget(depth=1))
+        self.assertFalse(res[0], "spec should be violated")
+        branch = res[1].branches[0]
+        self.assertTrue(branch.explained)
+        for node in branch.path[0][::2]:
+            for nested in node.branches:
+                self.assertFalse(nested.explained)
+        
+        # No branch is explained
+        res = check(fsm, spec, Budget(size=0))
+        self.assertFalse(res[1].branches[0].explained)
+
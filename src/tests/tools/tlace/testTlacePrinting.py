@@ -9,7 +9,10 @@ from pynusmv.prop import PropDb
 from pynusmv import glob
 
 from tools.tlace.check import check
-from tools.tlace.xml import xml_representation
+from io import StringIO
+from xml.dom.minidom import parseString
+
+from tools.tlace.xml import xml_representation, write_xml
 
 from pynusmv.init import init_nusmv, deinit_nusmv
 
@@ -129,4 +132,35 @@ class TestTlacePrinting(unittest.TestCase):
         self.assertFalse(res[0], "spec should be violated")
         self.assertIsNotNone(res[1], "TLACE should be given")
 
-        print(xml_representation(fsm, res[1], spec))
\ No newline at end of file
+        print(xml_representation(fsm, res[1], spec))
+        
+        
+    def test_write_xml_admin_af(self):
+        # Initialize the model
+        ret = cmd.Cmd_SecureCommandExecute("read_model -i " 
+                                     "tests/tools/tlace/admin.smv")
+        self.assertEqual(ret, 0, "cannot read the model")
+        ret = cmd.Cmd_SecureCommandExecute("go")
+        self.assertEqual(ret, 0, "cannot build the model")
+        
+        propDb = glob.prop_database()
+        fsm = propDb.master.bddFsm
+        self.assertTrue(propDb.get_size() >= 5, "propDb has no properties")
+        spec = propDb.get_prop_at_index(4).exprcore
+        
+        res = check(fsm, spec)
+        self.assertFalse(res[0], "spec should be violated")
+        self.assertIsNotNone(res[1], "TLACE should be given")
+        
+        out = StringIO()
+        write_xml(fsm, res[1], spec, out)
+        self.assertEqual(out.getvalue(), xml_representation(fsm, res[1], spec))
+        
+        document = parseString(out.getvalue())
+        root = document.documentElement
+        self.assertEqual(root.tagName, "counterexample")
+        ids = [int(node.getAttribute("id"))
+               for node in document.getElementsByTagName("node")]
+        self.assertEqual(ids, list(range(len(ids))))
+        for loop in document.getElementsByTagName("loop"):
+            self.assertIn(int(loop.getAttribute("to")), ids)
@@ -1,11 +1,16 @@
 """
 ARCTL evaluation functions.
+
+Specifications are hash-consed and the states satisfying each subformula are
+kept, within a budget of BDD nodes (see set_cache_budget), so that
+subformulas shared by several specifications are evaluated once.
 """
 
 from pyparsing import ParseException
 
 from pynusmv.dd import BDD
 from pynusmv.mc import eval_simple_expression
+from ..utils.evalcache import cons, EvalCache
 
 from .parsing import parseArctl
 
@@ -28,8 +33,36 @@ def evalArctl_from_string(fsm, spec):
     return evalArctl(fsm, specs[0])
     
 
+# The results of evalArctl, shared by all the specifications of a run
+_cache = EvalCache()
+
+
+def set_cache_budget(budget):
+    """
+    Set the number of BDD nodes the kept results of evalArctl can use, and
+    drop the least recently used ones until they fit in it. A budget of 0
+    keeps nothing.
+    
+    budget -- a number of BDD nodes
+    """
+    _cache.budget = budget
+
+
 def evalArctl(fsm, spec):
     """Return a BDD representing the set of states of fsm satisfying spec."""
+    spec = cons(spec)
+    result = _cache.get(fsm, spec)
+    if result is None:
+        result = _evalArctl(fsm, spec)
+        if result is not None:
+            _cache.put(fsm, spec, result)
+    return result
+
+
+def _evalArctl(fsm, spec):
+    """
+    Evaluate spec, a representative, without looking up the kept results.
+    """
     
     if type(spec) is TrueExp:
         return BDD.true(fsm.bddEnc.DDmanager)
@@ -1,16 +1,35 @@
 """
 ATL evaluation functions.
+
+Specifications are hash-consed and the states satisfying each subformula are
+kept, within a budget of BDD nodes (see set_cache_budget), so that
+subformulas shared by several specifications are evaluated once.
 """
 
 from pynusmv.dd import BDD
-from pynusmv.mc import eval_simple_expression
-from pynusmv.utils import fixpoint as fp
+from pynusmv.mc import eval_simple_expression, MuEvaluator
+from ..utils.evalcache import cons, EvalCache
 
 from .ast import (TrueExp, FalseExp,
                   Atom, Not, And, Or, Implies, Iff,
                   CEF, CEG, CEX, CEU, CEW, CAF, CAG, CAX, CAU, CAW)
 
 
+# The results of evalATL, shared by all the specifications of a run
+_cache = EvalCache()
+
+
+def set_cache_budget(budget):
+    """
+    Set the number of BDD nodes the kept results of evalATL can use, and
+    drop the least recently used ones until they fit in it. A budget of 0
+    keeps nothing.
+    
+    budget -- a number of BDD nodes
+    """
+    _cache.budget = budget
+
+
 def evalATL(fsm, spec):
     """
     Return the BDD representing the set of states of fsm satisfying spec.
@@ -18,6 +37,19 @@ def evalATL(fsm, spec):
     fsm -- a MAS representing the system
     spec -- an AST-based ATL specification
     """
+    spec = cons(spec)
+    result = _cache.get(fsm, spec)
+    if result is None:
+        result = _evalATL(fsm, spec)
+        if result is not None:
+            _cache.put(fsm, spec, result)
+    return result
+
+
+def _evalATL(fsm, spec):
+    """
+    Evaluate spec, a representative, without looking up the kept results.
+    """
     
     if type(spec) is TrueExp:
         return BDD.true(fsm.bddEnc.DDmanager)
@@ -125,8 +157,11 @@ def ceu(fsm, agents, phi, psi):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     """
-    return fp(lambda Y : psi | (phi & fsm.pre_strat(Y, agents)),
-              BDD.false(fsm.bddEnc.DDmanager))
+    mu = MuEvaluator(fsm)
+    gamma = fsm.inputs_cube_for_agents(agents)
+    Y = mu.var(0)
+    return mu.eval(mu.lfp(0, mu.const(psi) |
+                             (mu.const(phi) & mu.pre_strat(Y, gamma))))
     
 
 def cew(fsm, agents, phi, psi):
@@ -138,8 +173,11 @@ def cew(fsm, agents, phi, psi):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     """
-    return fp(lambda Z : psi | (phi & fsm.pre_strat(Z, agents)),
-              BDD.true(fsm.bddEnc.DDmanager))
+    mu = MuEvaluator(fsm)
+    gamma = fsm.inputs_cube_for_agents(agents)
+    Z = mu.var(0)
+    return mu.eval(mu.gfp(0, mu.const(psi) |
+                             (mu.const(phi) & mu.pre_strat(Z, gamma))))
     
     
 def ceg(fsm, agents, phi):
@@ -150,5 +188,7 @@ def ceg(fsm, agents, phi):
     agents -- a list of agents names
     phi -- a BDD representing the set of states of fsm satisfying phi
     """
-    return fp(lambda Z : phi & fsm.pre_strat(Z, agents),
-              BDD.true(fsm.bddEnc.DDmanager))
\ No newline at end of file
+    mu = MuEvaluator(fsm)
+    gamma = fsm.inputs_cube_for_agents(agents)
+    Z = mu.var(0)
+    return mu.eval(mu.gfp(0, mu.const(phi) & mu.pre_strat(Z, gamma)))
\ No newline at end of file
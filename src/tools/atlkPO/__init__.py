@@ -20,6 +20,12 @@ Top-level parameters are sub-parameters of config.
             - threshold: when remaining states decrease of threshold,
                          recompute the strategies
         threshold (int): the threshold for early termination with threshold
+    parallel: set of parameters for checking strategies in parallel
+        workers (int): number of worker processes checking strategies;
+                       0 or 1 to check them in the current process
+        chunk (int): number of strategies sent at once to a worker
+        model (string): path to the SMV model, loaded by the workers when
+                        they cannot be forked from the current process
     caching (boolean): whether or not caching states satisfying or not
                        sub-formulas
     filtering (boolean): activate filtering
@@ -93,6 +99,19 @@ config.partial.early.type = None
 config.partial.early.threshold = 0.75
 
 
+# Parallel exploration of partial strategies
+# ------------------------------------------
+config.partial.parallel = AttrDict()
+# Number of worker processes checking strategies
+#   0 or 1: strategies are checked one after the other by the current process
+config.partial.parallel.workers = 0
+# Number of strategies sent at once to a worker
+config.partial.parallel.chunk = 16
+# Path to the SMV model, needed only when workers cannot be forked from
+# the current process
+config.partial.parallel.model = None
+
+
 # Caching subformulas in partial strategies
 # -----------------------------------------
 
@@ -111,6 +111,9 @@ def process(allargs):
                         help='activate separation of states for partial '
                              'strategies: random, reach (default: None)',
                         default=None)
+    parser.add_argument('-pp', dest='workers', type=int,
+                        help='number of worker processes checking partial '
+                             'strategies (default: 0)', default=0)
     parser.add_argument('-g', dest='garbage',
                         help='activate explicit garbage collection: '
                         'each or step (int) (default: None)', default=None)
@@ -137,6 +140,8 @@ def process(allargs):
     config.partial.caching = args.caching
     config.partial.filtering = args.filtering
     config.partial.separation.type = args.separation
+    config.partial.parallel.workers = args.workers
+    config.partial.parallel.model = args.model
     
     # Warnings for FS variant with partial implementation
     if args.variant == "FS" and args.implementation == "partial":
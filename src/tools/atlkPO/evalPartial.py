@@ -7,7 +7,7 @@ from functools import reduce
 
 from pynusmv.dd import BDD
 from pynusmv.mc import eval_simple_expression
-from pynusmv.utils import fixpoint as fp
+from pynusmv.utils import fixpoint as fp, greatest_fixpoint as gfp
 from pynusmv.exception import PyNuSMVError
 
 from ..atlkFO.ast import (TrueExp, FalseExp, Init, Reachable,
@@ -19,6 +19,7 @@ from ..atlkFO.ast import (TrueExp, FalseExp, Init, Reachable,
 from ..atlkFO.eval import (fair_states, ex, eg, eu, nk, ne, nd, nc)
 
 from . import config
+from .parallel import check_strategies
 
 import gc
 
@@ -318,7 +319,10 @@ def fair_states_sub(fsm, subsystem=None):
     if len(fsm.fairness_constraints) == 0:
         return BDD.true(fsm.bddEnc.DDmanager)
     else:
-        return eg_sub(fsm, BDD.true(fsm.bddEnc.DDmanager), subsystem=subsystem)
+        if subsystem is None:
+            subsystem = BDD.true(fsm.bddEnc.DDmanager)
+        return (fsm.fair_states_inputs_in(subsystem)
+                .forsome(fsm.bddEnc.inputsCube) & fsm.bddEnc.statesMask)
 
 def reachable_sub(fsm, init=None, subsystem=None):
     """
@@ -344,7 +348,7 @@ def reachable_sub(fsm, init=None, subsystem=None):
                fsm.bddEnc.statesMask)
     return new
     
-def ex_sub(fsm, phi, subsystem=None):
+def ex_sub(fsm, phi, subsystem=None, fair=None):
     """
     Return the set of states of fsm satisfying EX phi in subsystem.
     
@@ -352,14 +356,16 @@ def ex_sub(fsm, phi, subsystem=None):
     phi -- a BDD representing the set of states of fsm satisfying phi
     subsystem -- if not None, the subsystem defined as a set of state/inputs
                  pairs.
+    fair -- if not None, the fair states of subsystem.
     """
     
     if subsystem is None:
         subsystem = BDD.true(fsm.bddEnc.DDmanager)
+    if fair is None:
+        fair = fair_states_sub(fsm, subsystem=subsystem)
     phi = phi.forsome(fsm.bddEnc.inputsCube) & fsm.bddEnc.statesMask
     
-    return fsm.pre(phi & fair_states_sub(fsm, subsystem=subsystem),
-                   subsystem=subsystem)
+    return fsm.pre(phi & fair, subsystem=subsystem)
     
     
 def eg_sub(fsm, phi, subsystem=None):
@@ -407,13 +413,14 @@ def eu_sub(fsm, phi, psi, subsystem=None):
     
     phi = phi.forsome(fsm.bddEnc.inputsCube) & fsm.bddEnc.statesMask
     psi = psi.forsome(fsm.bddEnc.inputsCube) & fsm.bddEnc.statesMask
-    return fp(lambda X : (psi & fair_states_sub(fsm, subsystem=subsystem) &
-                          fsm.reachable_states) |
-                               (phi & ex_sub(fsm, X, subsystem=subsystem)),
+    fair = fair_states_sub(fsm, subsystem=subsystem)
+    return fp(lambda X : (psi & fair & fsm.reachable_states) |
+                               (phi & ex_sub(fsm, X, subsystem=subsystem,
+                                             fair=fair)),
                     BDD.false(fsm.bddEnc.DDmanager))
 
 
-def cex_si(fsm, agents, phi, strat=None):
+def cex_si(fsm, agents, phi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying <agents> X phi
     under full observability in strat.
@@ -423,17 +430,19 @@ def cex_si(fsm, agents, phi, strat=None):
     agents -- a list of agents names
     phi -- a BDD representing the set of states of fsm satisfying phi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
     
     phi = phi & fsm.bddEnc.statesInputsMask
     
-    return fsm.pre_strat_si(phi | nfair_gamma_si(fsm, agents, strat),
+    return fsm.pre_strat_si(phi | nfair_gamma_si(fsm, agents, strat,
+                                                 fair_over),
                             agents, strat)
     
 
-def ceu_si(fsm, agents, phi, psi, strat=None):
+def ceu_si(fsm, agents, phi, psi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying
     <agents>[phi U psi] under full observability in strat.
@@ -444,6 +453,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
@@ -456,7 +466,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
         return fp(lambda Z : psi | (phi & fsm.pre_strat_si(Z, agents, strat)),
                   BDD.false(fsm.bddEnc.DDmanager))
     else:
-        nfair = nfair_gamma_si(fsm, agents, strat)
+        nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
         def inner(Z):
             res = psi
             for f in fsm.fairness_constraints:
@@ -474,7 +484,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
         return fp(inner, BDD.false(fsm.bddEnc.DDmanager))
     
 
-def cew_si(fsm, agents, phi, psi, strat=None):
+def cew_si(fsm, agents, phi, psi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying
     <agents>[phi W psi] under full observability in strat.
@@ -485,6 +495,7 @@ def cew_si(fsm, agents, phi, psi, strat=None):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
@@ -493,14 +504,14 @@ def cew_si(fsm, agents, phi, psi, strat=None):
     phi = phi & fsm.bddEnc.statesInputsMask & strat
     psi = psi & fsm.bddEnc.statesInputsMask & strat
     
-    nfair = nfair_gamma_si(fsm, agents, strat)
+    nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
     
     return fp(lambda Y : (psi | phi | nfair) &
                          (psi | fsm.pre_strat_si(Y, agents, strat)),
               BDD.true(fsm.bddEnc.DDmanager))
     
     
-def ceg_si(fsm, agents, phi, strat=None):
+def ceg_si(fsm, agents, phi, strat=None, over=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying <agents> G phi
     under full observability in strat.
@@ -510,20 +521,26 @@ def ceg_si(fsm, agents, phi, strat=None):
     agents -- a list of agents names
     phi -- a BDD representing the set of states of fsm satisfying phi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    over -- a BDD containing the result, or None; for instance, the result
+            for a larger strat and a weaker phi. The fixpoint is started from
+            over instead of true.
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
+    if over is None:
+        over = BDD.true(fsm.bddEnc.DDmanager)
     
     phi = phi & fsm.bddEnc.statesInputsMask & strat
     
-    nfair = nfair_gamma_si(fsm, agents, strat)
+    nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
     
-    return fp(lambda Y : (phi | nfair) & fsm.pre_strat_si(Y, agents, strat),
-              BDD.true(fsm.bddEnc.DDmanager))
+    return gfp(lambda Y : (phi | nfair) & fsm.pre_strat_si(Y, agents, strat),
+               over)
 
 
-def nfair_gamma_si(fsm, agents, strat=None):
+def nfair_gamma_si(fsm, agents, strat=None, over=None):
     """
     Return the set of state/inputs pairs of strat
     in which agents can avoid a fair path in strat.
@@ -532,26 +549,37 @@ def nfair_gamma_si(fsm, agents, strat=None):
     fsm -- the model
     agents -- a list of agents names
     strat -- a BDD representing allowed state/inputs pairs, or None
+    over -- a list of BDDs, or None; if not empty, its i-th element must
+            contain the inner fixpoints for the i-th fairness constraint of
+            fsm, such as the ones left by a call for a larger strat; the
+            inner fixpoints are started from them instead of true. The list
+            is then filled with the inner fixpoints of the last iteration.
     
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
+    if over is None:
+        over = []
     
     if len(fsm.fairness_constraints) == 0:
         return BDD.false(fsm.bddEnc.DDmanager)
     else:
+        starts = (list(over) or
+                  [BDD.true(fsm.bddEnc.DDmanager)] *
+                  len(fsm.fairness_constraints))
+        inners = list(starts)
         def inner(Z):
             res = BDD.false(fsm.bddEnc.DDmanager)
-            for f in fsm.fairness_constraints:
+            for i, f in enumerate(fsm.fairness_constraints):
                 nf = ~f & fsm.bddEnc.statesMask & strat
-                res = res | fsm.pre_strat_si(fp(lambda Y :
-                                                 (Z | nf) &
-                                                 fsm.pre_strat_si(Y, agents,
-                                                                  strat),
-                                             BDD.true(fsm.bddEnc.DDmanager)),
-                                             agents, strat)
+                inners[i] = gfp(lambda Y : (Z | nf) &
+                                           fsm.pre_strat_si(Y, agents, strat),
+                                starts[i])
+                res = res | fsm.pre_strat_si(inners[i], agents, strat)
             return res
-        return fp(inner, BDD.false(fsm.bddEnc.DDmanager))
+        res = fp(inner, BDD.false(fsm.bddEnc.DDmanager))
+        over[:] = inners
+        return res
         
         
 def split_reach(fsm, agents, pustrat, subsystem=None, semantics="group"):
@@ -899,7 +927,7 @@ def all_equiv_sat(fsm, winning, agents, semantics="group"):
              
              
 def filter_strat(fsm, spec, states, strat=None, variant="SF",
-                 semantics="group"):
+                 semantics="group", fair_over=None):
     """
     Returns the subset SA of strat (or the whole system if strat is None),
     state/action pairs of fsm, such that there is a strategy to satisfy spec
@@ -926,6 +954,9 @@ def filter_strat(fsm, spec, states, strat=None, variant="SF",
                  * "individual" for the original ATL_ir semantics considering
                    the group as individual agents (individual knowledge is
                    used)
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None; for
+                 instance, a copy of the list filled by filter_strat for the
+                 same spec and a strat containing this one.
                  
     If variant is not in {"SF", "FS", "FSF"}, the standard "SF" way is used.
     """
@@ -939,33 +970,35 @@ def filter_strat(fsm, spec, states, strat=None, variant="SF",
     if type(spec) is CEX:
         phi = evalATLK(fsm, spec.child, fsm.post(states & strat),
                        variant=variant, semantics=semantics)
-        winning = cex_si(fsm, agents, phi, strat)
+        winning = cex_si(fsm, agents, phi, strat, fair_over=fair_over)
 
     elif type(spec) is CEG:
         phi = evalATLK(fsm, spec.child, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
-        winning = ceg_si(fsm, agents, phi, strat)
+        winning = ceg_si(fsm, agents, phi, strat, fair_over=fair_over)
 
     elif type(spec) is CEU:
         phi1 = evalATLK(fsm, spec.left, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
         phi2 = evalATLK(fsm, spec.right, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
-        winning = ceu_si(fsm, agents, phi1, phi2, strat)
+        winning = ceu_si(fsm, agents, phi1, phi2, strat,
+                         fair_over=fair_over)
 
     elif type(spec) is CEF:
         # <g> F p = <g>[true U p]
         phi = evalATLK(fsm, spec.child, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
         winning = ceu_si(fsm, agents, BDD.true(fsm.bddEnc.DDmanager),
-                         phi, strat)
+                         phi, strat, fair_over=fair_over)
 
     elif type(spec) is CEW:
         phi1 = evalATLK(fsm, spec.left, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
         phi2 = evalATLK(fsm, spec.right, strat.forsome(fsm.bddEnc.inputsCube), 
                        variant=variant, semantics=semantics)
-        winning = cew_si(fsm, agents, phi1, phi2, strat)
+        winning = cew_si(fsm, agents, phi1, phi2, strat,
+                         fair_over=fair_over)
     
     return winning & fsm.bddEnc.statesInputsMask & fsm.protocol(agents)
 
@@ -1031,13 +1064,16 @@ def eval_strat(fsm, spec, states, semantics="group"):
         states = get_equiv_class(fsm, agents, states, semantics=semantics)
     
     # Pre-filtering out losing states and actions
+    # The fixpoints of the pre-filtering, for the whole system, bound the ones
+    # of each strategy
+    fair_over = []
     if config.partial.filtering:
         # FIXME This triggers full partial strategies exploration when
         # a sub-formula is a strategic one. Should perform only full obs
         # approximation for strategic sub-formulas as well.
         # Can be done with semantics="full obs"
         subsystem = filter_strat(fsm, spec, states, variant="SF",
-                                 semantics=semantics)
+                                 semantics=semantics, fair_over=fair_over)
     else:
         subsystem = fsm.protocol(agents)
     # if filtering is enabled, subsystem is the part of the system in which
@@ -1106,17 +1142,29 @@ def eval_strat(fsm, spec, states, semantics="group"):
         
             remaining_size = fsm.count_states(remaining)
             
+            strats = (strat
+                      for pustrat in split(fsm, states & subsystem, agents,
+                                           semantics=semantics)
+                      for strat
+                      in split_reach(fsm, agents, pustrat, subsystem,
+                                     semantics=semantics))
+            
+            # Check strategies in worker processes
+            if config.partial.parallel.workers > 1:
+                sat, remaining, remaining_size, checked = check_strategies(
+                    fsm, spec, strats, agents, states, orig_states, sat,
+                    remaining, remaining_size, semantics=semantics,
+                    fair_over=fair_over)
+                nbstrats += checked
+                continue
+            
             # Go through all strategies
-            for strat in (strat
-                          for pustrat in split(fsm, states & subsystem, agents,
-                                               semantics=semantics)
-                          for strat
-                          in split_reach(fsm, agents, pustrat, subsystem,
-                                         semantics=semantics)):
+            for strat in strats:
                 # Check the strategy
                 nbstrats += 1
                 winning = (filter_strat(fsm, spec, states, strat,
-                                        variant="SF", semantics=semantics).
+                                        variant="SF", semantics=semantics,
+                                        fair_over=list(fair_over)).
                            forsome(fsm.bddEnc.inputsCube))
                 old_sat = sat
                 sat = sat | (all_equiv_sat(fsm, winning, agents,
@@ -12,7 +12,7 @@ from collections import OrderedDict
 from pynusmv.dd import BDD, dynamic_reordering_enabled, reorder
 from pynusmv.fsm import BddTrans
 from pynusmv.mc import eval_simple_expression
-from pynusmv.utils import fixpoint as fp
+from pynusmv.utils import fixpoint as fp, greatest_fixpoint as gfp
 from pynusmv import node, glob
 from pynusmv.exception import PyNuSMVError
 
@@ -267,7 +267,7 @@ def ew(fsm, phi, psi):
         return fp(inner, BDD.true(fsm.bddEnc.DDmanager))
 
 
-def cex_si(fsm, agents, phi, strat=None):
+def cex_si(fsm, agents, phi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying <agents> X phi
     under full observability in strat.
@@ -277,17 +277,19 @@ def cex_si(fsm, agents, phi, strat=None):
     agents -- a list of agents names
     phi -- a BDD representing the set of states of fsm satisfying phi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
     
     phi = phi & fsm.bddEnc.statesInputsMask
     
-    return fsm.pre_strat_si(phi | nfair_gamma_si(fsm, agents, strat),
+    return fsm.pre_strat_si(phi | nfair_gamma_si(fsm, agents, strat,
+                                                 fair_over),
                             agents, strat)
     
 
-def ceu_si(fsm, agents, phi, psi, strat=None):
+def ceu_si(fsm, agents, phi, psi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying
     <agents>[phi U psi]
@@ -299,6 +301,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
@@ -311,7 +314,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
         return fp(lambda Z : psi | (phi & fsm.pre_strat_si(Z, agents, strat)),
                   BDD.false(fsm.bddEnc.DDmanager))
     else:
-        nfair = nfair_gamma_si(fsm, agents, strat)
+        nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
         def inner(Z):
             res = psi
             for f in fsm.fairness_constraints:
@@ -329,7 +332,7 @@ def ceu_si(fsm, agents, phi, psi, strat=None):
         return fp(inner, BDD.false(fsm.bddEnc.DDmanager))
     
 
-def cew_si(fsm, agents, phi, psi, strat=None):
+def cew_si(fsm, agents, phi, psi, strat=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying <agents>[phi W psi]
     under full observability in strat.
@@ -340,6 +343,7 @@ def cew_si(fsm, agents, phi, psi, strat=None):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
@@ -348,14 +352,14 @@ def cew_si(fsm, agents, phi, psi, strat=None):
     phi = phi & fsm.bddEnc.statesInputsMask & strat
     psi = psi & fsm.bddEnc.statesInputsMask & strat
     
-    nfair = nfair_gamma_si(fsm, agents, strat)
+    nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
     
     return fp(lambda Y : (psi | phi | nfair) &
                          (psi | fsm.pre_strat_si(Y, agents, strat)),
               BDD.true(fsm.bddEnc.DDmanager))
     
     
-def ceg_si(fsm, agents, phi, strat=None):
+def ceg_si(fsm, agents, phi, strat=None, over=None, fair_over=None):
     """
     Return the set of state/inputs pairs of strat satisfying <agents> G phi
     under full observability in strat.
@@ -365,20 +369,26 @@ def ceg_si(fsm, agents, phi, strat=None):
     agents -- a list of agents names
     phi -- a BDD representing the set of states of fsm satisfying phi
     strat -- a BDD representing allowed state/inputs pairs, or None
+    over -- a BDD containing the result, or None; for instance, the result
+            for a larger strat and a weaker phi. The fixpoint is started from
+            over instead of true.
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None
     
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
+    if over is None:
+        over = BDD.true(fsm.bddEnc.DDmanager)
     
     phi = phi & fsm.bddEnc.statesInputsMask & strat
     
-    nfair = nfair_gamma_si(fsm, agents, strat)
+    nfair = nfair_gamma_si(fsm, agents, strat, fair_over)
     
-    return fp(lambda Y : (phi | nfair) & fsm.pre_strat_si(Y, agents, strat),
-              BDD.true(fsm.bddEnc.DDmanager))
+    return gfp(lambda Y : (phi | nfair) & fsm.pre_strat_si(Y, agents, strat),
+               over)
 
 
-def nfair_gamma_si(fsm, agents, strat=None):
+def nfair_gamma_si(fsm, agents, strat=None, over=None):
     """
     Return the set of state/inputs pairs of strat
     in which agents can avoid a fair path in strat.
@@ -387,26 +397,37 @@ def nfair_gamma_si(fsm, agents, strat=None):
     fsm -- the model
     agents -- a list of agents names
     strat -- a BDD representing allowed state/inputs pairs, or None
+    over -- a list of BDDs, or None; if not empty, its i-th element must
+            contain the inner fixpoints for the i-th fairness constraint of
+            fsm, such as the ones left by a call for a larger strat; the
+            inner fixpoints are started from them instead of true. The list
+            is then filled with the inner fixpoints of the last iteration.
     
     """
     if not strat:
         strat = BDD.true(fsm.bddEnc.DDmanager)
+    if over is None:
+        over = []
     
     if len(fsm.fairness_constraints) == 0:
         return BDD.false(fsm.bddEnc.DDmanager)
     else:
+        starts = (list(over) or
+                  [BDD.true(fsm.bddEnc.DDmanager)] *
+                  len(fsm.fairness_constraints))
+        inners = list(starts)
         def inner(Z):
             res = BDD.false(fsm.bddEnc.DDmanager)
-            for f in fsm.fairness_constraints:
+            for i, f in enumerate(fsm.fairness_constraints):
                 nf = ~f & fsm.bddEnc.statesMask & strat
-                res = res | fsm.pre_strat_si(fp(lambda Y :
-                                                 (Z | nf) &
-                                                 fsm.pre_strat_si(Y, agents,
-                                                                  strat),
-                                             BDD.true(fsm.bddEnc.DDmanager)),
-                                             agents, strat)
+                inners[i] = gfp(lambda Y : (Z | nf) &
+                                           fsm.pre_strat_si(Y, agents, strat),
+                                starts[i])
+                res = res | fsm.pre_strat_si(inners[i], agents, strat)
             return res
-        return fp(inner, BDD.false(fsm.bddEnc.DDmanager))
+        res = fp(inner, BDD.false(fsm.bddEnc.DDmanager))
+        over[:] = inners
+        return res
 
 
 def _ifair(fsm, name):
@@ -761,7 +782,8 @@ def split(fsm, strats, gamma, semantics="group"):
                 yield (common | strat | splitted)
 
 
-def filter_strat(fsm, spec, strat=None, variant="SF", semantics="group"):
+def filter_strat(fsm, spec, strat=None, variant="SF", semantics="group",
+                 over=None, fair_over=None):
     """
     Returns the subset SA of strat (or the whole system if strat is None),
     state/action pairs of fsm, such that there is a strategy to satisfy spec
@@ -787,6 +809,12 @@ def filter_strat(fsm, spec, strat=None, variant="SF", semantics="group"):
                  * "individual" for the original ATL_ir semantics considering
                    the group as individual agents (individual knowledge is
                    used)
+    over -- the result of filter_strat for the same spec and a strat
+            containing this one, or None; it bounds the greatest fixpoint
+            of CEG.
+    fair_over -- a list of BDDs passed to nfair_gamma_si, or None; for
+                 instance, a copy of the list filled by filter_strat for the
+                 same spec and a strat containing this one.
                  
     If variant is not in {"SF", "FS", "FSF"}, the standard "SF" way is used.
     """
@@ -802,31 +830,36 @@ def filter_strat(fsm, spec, strat=None, variant="SF", semantics="group"):
     if type(spec) is CEX:
         winning = cex_si(fsm, agents,
                          evalATLK(fsm, spec.child, variant=variant,
-                                  semantics=semantics), strat)
+                                  semantics=semantics), strat,
+                         fair_over=fair_over)
 
     elif type(spec) is CEG:
         winning = ceg_si(fsm, agents, evalATLK(fsm, spec.child,
                                                variant=variant,
-                                               semantics=semantics), strat)
+                                               semantics=semantics), strat,
+                         over=over, fair_over=fair_over)
 
     elif type(spec) is CEU:
         winning = ceu_si(fsm, agents, evalATLK(fsm, spec.left,
                                                variant=variant,
                                                semantics=semantics),
                          evalATLK(fsm, spec.right, variant=variant,
-                                  semantics=semantics), strat)
+                                  semantics=semantics), strat,
+                         fair_over=fair_over)
 
     elif type(spec) is CEF:
         # <g> F p = <g>[true U p]
         winning = ceu_si(fsm, agents, BDD.true(fsm.bddEnc.DDmanager),
                          evalATLK(fsm, spec.child, variant=variant,
-                                  semantics=semantics), strat)
+                                  semantics=semantics), strat,
+                         fair_over=fair_over)
 
     elif type(spec) is CEW:
        winning = cew_si(fsm, agents, evalATLK(fsm, spec.left, variant=variant,
                                               semantics=semantics),
                         evalATLK(fsm, spec.right, variant=variant,
-                                 semantics=semantics), strat)
+                                 semantics=semantics), strat,
+                        fair_over=fair_over)
     
     
     return winning & fsm.bddEnc.statesInputsMask & fsm.protocol(agents)
@@ -0,0 +1,274 @@
+"""
+Parallel exploration of uniform partial strategies.
+
+Once split, partial strategies can be checked independently. The main process
+keeps splitting them and sends them by chunks to worker processes, each
+holding its own copy of the model. Strategies and results are exchanged as
+BDD snapshot files (see pynusmv.fsm.BddEnc.save_bdds), since BDDs cannot be
+shared between managers.
+
+Where processes can be forked, workers inherit the model from the main
+process. Otherwise, they load config.partial.parallel.model.
+"""
+
+import os
+import gc
+import shutil
+import tempfile
+import multiprocessing
+from collections import deque
+from itertools import islice
+
+from pynusmv.dd import BDD
+
+from . import config
+
+# The model checked by the worker processes
+_fsm = None
+
+
+def _config_items(attrs, prefix=()):
+    """
+    Return the list of (path, value) pairs of the given configuration,
+    where path is the tuple of attribute names leading to value.
+
+    attrs -- an AttrDict of configuration variables.
+    """
+    items = []
+    for key, value in attrs.items():
+        if isinstance(value, dict):
+            items.extend(_config_items(value, prefix + (key,)))
+        else:
+            items.append((prefix + (key,), value))
+    return items
+
+
+def _init_worker(model, items):
+    """
+    Initialize a worker process: restore the configuration of the main
+    process and load the model if it was not inherited.
+
+    model -- the path to the SMV model, or None;
+    items -- the configuration, as returned by _config_items.
+    """
+    global _fsm
+    for path, value in items:
+        attrs = config
+        for key in path[:-1]:
+            attrs = attrs[key]
+        attrs[path[-1]] = value
+    # Workers check their strategies sequentially
+    config.partial.parallel.workers = 0
+
+    if _fsm is None:
+        from pynusmv.init import init_nusmv
+        from ..mas import glob
+        init_nusmv()
+        glob.load_from_file(model)
+        _fsm = glob.mas()
+
+
+def early_termination(fsm, orig_states, old_sat, sat, remaining,
+                      remaining_size):
+    """
+    Return whether the early termination policy of config.partial.early
+    stops the exploration of strategies, sat having grown from old_sat.
+
+    fsm -- the model;
+    orig_states -- the states the strategies are explored for;
+    old_sat -- the states satisfying the property before the last check;
+    sat -- the states satisfying the property after the last check;
+    remaining -- the states still to be decided;
+    remaining_size -- the number of states in remaining when the exploration
+                      started.
+    """
+    if config.partial.early.type == "full":
+        return orig_states <= sat
+    if config.partial.early.type == "partial":
+        return old_sat < sat
+    if config.partial.early.type == "threshold":
+        return (fsm.count_states(remaining - sat) <=
+                remaining_size * config.partial.early.threshold)
+    return False
+
+
+def _check_chunk(path, spec, agents, semantics, remaining_size):
+    """
+    Check the strategies of the snapshot at path, one after the other,
+    until the early termination policy stops the exploration.
+
+    Return the number of checked strategies and the path of a snapshot
+    containing the updated set of satisfying states.
+
+    path -- the path of a snapshot containing the strategies to check,
+            named strat0, strat1, ..., the states, orig_states, sat and
+            remaining sets of eval_strat, and its fair_over list, named
+            fair0, fair1, ...;
+    spec -- the strategic specification;
+    agents -- the set of agents of the strategies;
+    semantics -- the semantics to use for equivalence;
+    remaining_size -- the number of remaining states when the exploration
+                      started.
+    """
+    from .evalPartial import filter_strat, all_equiv_sat
+
+    fsm = _fsm
+    bdds = fsm.bddEnc.load_bdds(path)
+    states = bdds.pop("states")
+    orig_states = bdds.pop("orig_states")
+    sat = bdds.pop("sat")
+    remaining = bdds.pop("remaining")
+    fair_over = []
+    while "fair" + str(len(fair_over)) in bdds:
+        fair_over.append(bdds.pop("fair" + str(len(fair_over))))
+
+    nbstrats = 0
+    for i in range(len(bdds)):
+        strat = bdds.pop("strat" + str(i))
+        nbstrats += 1
+        winning = (filter_strat(fsm, spec, states, strat,
+                                variant="SF", semantics=semantics,
+                                fair_over=list(fair_over)).
+                   forsome(fsm.bddEnc.inputsCube))
+        old_sat = sat
+        sat = sat | (all_equiv_sat(fsm, winning, agents,
+                                   semantics=semantics) & orig_states)
+        if early_termination(fsm, orig_states, old_sat, sat, remaining,
+                             remaining_size):
+            break
+
+        if (config.garbage.type == "each" or
+            (config.garbage.type == "step"
+                and nbstrats % config.garbage.step == 0)):
+            gc.collect()
+
+    result = path + ".sat"
+    fsm.bddEnc.save_bdds(result, {"sat": sat})
+    return nbstrats, result
+
+
+def _context():
+    """
+    Return the multiprocessing context used to start workers.
+    """
+    if "fork" in multiprocessing.get_all_start_methods():
+        return multiprocessing.get_context("fork")
+    if config.partial.parallel.model is None:
+        raise ValueError("config.partial.parallel.model must be set when "
+                         "worker processes cannot be forked")
+    return multiprocessing.get_context("spawn")
+
+
+def check_strategies(fsm, spec, strats, agents, states, orig_states, sat,
+                     remaining, remaining_size, semantics="group",
+                     fair_over=None):
+    """
+    Check the given strategies with config.partial.parallel.workers worker
+    processes, and apply the early termination policy of config.partial.early
+    as eval_strat does.
+
+    Return a tuple (sat, remaining, remaining_size, nbstrats) where sat is
+    the updated set of satisfying states, remaining and remaining_size the
+    states still to decide and the number of states to use for the next
+    threshold, and nbstrats the number of checked strategies.
+
+    fsm -- the model;
+    spec -- the strategic specification;
+    strats -- an iterable of uniform partial strategies;
+    agents -- the set of agents of the strategies;
+    states -- the states the strategies are split for;
+    orig_states -- the states to decide;
+    sat -- the states already known to satisfy spec;
+    remaining -- the states still to decide;
+    remaining_size -- the number of states in remaining;
+    semantics -- the semantics to use for equivalence;
+    fair_over -- the list of BDDs given to filter_strat for each strategy,
+                 or None.
+
+    Early termination is decided after each chunk of
+    config.partial.parallel.chunk strategies, in the order the chunks were
+    sent. Chunks still being checked when the exploration stops are
+    discarded.
+    """
+    global _fsm
+    _fsm = fsm
+    workers = config.partial.parallel.workers
+    strats = iter(strats)
+
+    tmpdir = tempfile.mkdtemp(prefix="atlkPO-")
+    pool = _context().Pool(workers, _init_worker,
+                           (config.partial.parallel.model,
+                            _config_items(config)))
+    pending = deque()
+    nbchunks = 0
+    nbstrats = 0
+    exhausted = False
+    stopped = False
+    try:
+        while not stopped:
+            # Keep every worker busy, with one chunk ahead
+            while not exhausted and len(pending) < 2 * workers:
+                chunk = list(islice(strats, config.partial.parallel.chunk))
+                if not chunk:
+                    exhausted = True
+                    break
+                path = os.path.join(tmpdir, "chunk{}.snap".format(nbchunks))
+                nbchunks += 1
+                bdds = {"strat" + str(i): strat
+                        for i, strat in enumerate(chunk)}
+                bdds["states"] = states
+                bdds["orig_states"] = orig_states
+                bdds["sat"] = sat
+                bdds["remaining"] = remaining
+                for i, fair in enumerate(fair_over or []):
+                    bdds["fair" + str(i)] = fair
+                fsm.bddEnc.save_bdds(path, bdds)
+                pending.append(pool.apply_async(_check_chunk,
+                                                (path, spec, agents,
+                                                 semantics, remaining_size)))
+            if not pending:
+                break
+
+            checked, result = pending.popleft().get()
+            nbstrats += checked
+            old_sat = sat
+            sat = sat | fsm.bddEnc.load_bdds(result,
+                                             restore_order=False)["sat"]
+            os.remove(result)
+
+            # ----- EARLY TERMINATION -----------------------------------------
+            if early_termination(fsm, orig_states, old_sat, sat, remaining,
+                                 remaining_size):
+                stopped = True
+                if config.partial.early.type == "full":
+                    remaining = BDD.false(fsm.bddEnc.DDmanager)
+                else:
+                    remaining = remaining - sat
+                    if config.partial.early.type == "threshold":
+                        remaining_size = fsm.count_states(remaining)
+                if config.debug:
+                    print("Partial strategies: early termination "
+                          "({} strateg{})".format(nbstrats,
+                                                  "ies" if nbstrats > 1
+                                                  else "y"))
+            elif config.partial.early.type == "threshold":
+                remaining = remaining - sat
+            # -----------------------------------------------------------------
+
+            if config.debug and nbstrats // 1000 > (nbstrats - checked) // 1000:
+                print("Partial strategies: {} strateg{} checked so far"
+                      .format(nbstrats, "ies" if nbstrats > 1 else "y"))
+
+            if config.garbage.type is not None:
+                gc.collect()
+
+        if not stopped:
+            # All strategies have been checked, the remaining states do not
+            # satisfy the specification
+            remaining = BDD.false(fsm.bddEnc.DDmanager)
+    finally:
+        pool.terminate()
+        pool.join()
+        shutil.rmtree(tmpdir, ignore_errors=True)
+
+    return sat, remaining, remaining_size, nbstrats
@@ -0,0 +1,186 @@
+"""
+Symbolic strategies extracted from the fixpoints of the fully symbolic
+approach, under full observability.
+
+A Strategy is a set of state/inputs pairs (moves) of a group of agents, as a
+BDD over the state variables and the input variables of the agents. It is
+applied by restricting the transition relation of the model to its moves,
+without declaring any new variable nor encoding any new layer; unlike
+evalSymb.encode_strat, the symbol table of the model is left untouched.
+
+A memoryless strategy has a single BDD of moves. A bounded-memory strategy
+has a sequence of BDDs of moves: the i-th one is played at the i-th step,
+and the last one is played from then on.
+"""
+
+from pynusmv.dd import BDD
+from pynusmv.exception import PyNuSMVError
+
+
+class Strategy:
+    """
+    A memoryless or bounded-memory symbolic strategy of a group of agents.
+    """
+
+    def __init__(self, fsm, agents, moves):
+        """
+        Create a new strategy.
+
+        fsm -- the MAS the strategy is played in;
+        agents -- the names of the agents playing the strategy;
+        moves -- a BDD of state/inputs pairs of fsm for a memoryless strategy,
+                 or a non-empty sequence of such BDDs for a bounded-memory
+                 one; the input variables of the other agents are abstracted
+                 away.
+        """
+        self.fsm = fsm
+        self.agents = frozenset(agents)
+        if isinstance(moves, BDD):
+            moves = (moves,)
+        ngamma_cube = (fsm.bddEnc.inputsCube -
+                       fsm.inputs_cube_for_agents(self.agents))
+        self._moves = tuple(m.forsome(ngamma_cube) &
+                            fsm.bddEnc.statesInputsMask
+                            for m in moves)
+        self._trans = [None] * len(self._moves)
+
+    @property
+    def memory(self):
+        """The number of memory states of this strategy."""
+        return len(self._moves)
+
+    @property
+    def memoryless(self):
+        """Whether this strategy has no memory."""
+        return len(self._moves) == 1
+
+    def moves(self, step=0):
+        """Return the BDD of the moves played at the given step."""
+        return self._moves[min(step, len(self._moves) - 1)]
+
+    def domain(self, step=0):
+        """Return the states in which this strategy plays at the given step."""
+        return self.moves(step).forsome(self.fsm.bddEnc.inputsCube)
+
+    def trans(self, step=0):
+        """
+        Return the transition relation of fsm restricted to the moves played
+        at the given step, as a pynusmv.fsm.BddTrans.
+        """
+        index = min(step, len(self._moves) - 1)
+        if self._trans[index] is None:
+            self._trans[index] = self.fsm.trans.restrict(self._moves[index])
+        return self._trans[index]
+
+    def post(self, states, step=0):
+        """
+        Return the successors of states when the agents play the moves of the
+        given step, whatever the other agents do.
+        """
+        return self.trans(step).post(states) & self.fsm.bddEnc.statesMask
+
+    def pre(self, states, step=0):
+        """
+        Return the states of the domain of this strategy at the given step
+        whose successors all belong to states, whatever the other agents do.
+        """
+        nstates = ~states & self.fsm.bddEnc.statesMask
+        return self.domain(step) & ~self.trans(step).pre(nstates)
+
+    def outcome(self, states):
+        """
+        Return the states reachable from states by following this strategy.
+        """
+        reached = states & self.fsm.bddEnc.statesMask
+        frontier = reached
+        step = 0
+        while frontier.isnot_false():
+            successors = self.post(frontier, step)
+            if step < self.memory - 1:
+                # The memory differs, the same states can be reached again
+                frontier = successors
+                reached = reached | successors
+            else:
+                frontier = successors - reached
+                reached = reached | frontier
+            step += 1
+        return reached
+
+
+def _check_fairness(fsm):
+    """Raise a PyNuSMVError if fsm has fairness constraints."""
+    if len(fsm.fairness_constraints) > 0:
+        raise PyNuSMVError("Symbolic strategies cannot be extracted from "
+                           "models with fairness constraints.")
+
+
+def ceu_strategy(fsm, agents, phi, psi, strat=None, memoryless=True):
+    """
+    Return a strategy for agents to enforce [phi U psi], extracted from the
+    iterations of the evalSymb.ceu_si fixpoint, under full observability in
+    strat.
+
+    The memoryless strategy plays, in each state, the moves of the first
+    iteration the state belongs to, and thus gets one step closer to psi at
+    each step. The bounded-memory strategy counts down the iterations: its
+    i-th moves are the moves of the n-i-th iteration, where n is the number
+    of iterations; it needs no difference between iterations.
+
+    fsm -- a MAS representing the system, without fairness constraints;
+    agents -- a list of agents names;
+    phi -- a BDD representing the set of states of fsm satisfying phi;
+    psi -- a BDD representing the set of states of fsm satisfying psi;
+    strat -- a BDD representing allowed state/inputs pairs, or None;
+    memoryless -- whether the returned strategy is memoryless.
+    """
+    _check_fairness(fsm)
+    if not strat:
+        strat = BDD.true(fsm.bddEnc.DDmanager)
+
+    phi = phi & fsm.bddEnc.statesInputsMask & strat
+    psi = psi & fsm.bddEnc.statesInputsMask & strat
+
+    iterations = [psi]
+    moves = psi
+    while True:
+        last = iterations[-1]
+        current = psi | (phi & fsm.pre_strat_si(last, agents, strat))
+        if current == last:
+            break
+        iterations.append(current)
+        # The moves of the states that first appear in current
+        moves = moves | (current - last.forsome(fsm.bddEnc.inputsCube))
+
+    if memoryless:
+        return Strategy(fsm, agents, moves)
+    else:
+        return Strategy(fsm, agents, list(reversed(iterations)))
+
+
+def ceg_strategy(fsm, agents, phi, strat=None):
+    """
+    Return a memoryless strategy for agents to enforce G phi, extracted from
+    the evalSymb.ceg_si fixpoint, under full observability in strat.
+
+    The moves of the strategy are the moves of the fixpoint: they all lead to
+    states where the fixpoint plays.
+
+    fsm -- a MAS representing the system, without fairness constraints;
+    agents -- a list of agents names;
+    phi -- a BDD representing the set of states of fsm satisfying phi;
+    strat -- a BDD representing allowed state/inputs pairs, or None.
+    """
+    _check_fairness(fsm)
+    if not strat:
+        strat = BDD.true(fsm.bddEnc.DDmanager)
+
+    phi = phi & fsm.bddEnc.statesInputsMask & strat
+
+    moves = phi
+    while True:
+        current = phi & fsm.pre_strat_si(moves, agents, strat)
+        if current == moves:
+            break
+        moves = current
+
+    return Strategy(fsm, agents, moves)
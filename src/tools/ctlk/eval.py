@@ -1,10 +1,20 @@
 """
 CTLK evaluation functions.
+
+The onion rings of E[ phi U psi ] and the result of EG phi are kept, within
+a budget of BDD nodes (see set_rings_budget), for explanations to reuse them
+instead of computing the fixpoints again. Specifications are hash-consed and
+the states satisfying each subformula are kept as well (see set_cache_budget),
+so that subformulas shared by several specifications are evaluated once.
 """
 
+from collections import OrderedDict
+
 from pynusmv.dd import BDD
-from pynusmv.mc import eval_simple_expression
+from pynusmv.mc import eval_simple_expression, MuEvaluator
 from pynusmv.utils import fixpoint as fp
+from pynusmv.init import _register_deinit_hook
+from ..utils.evalcache import cons, EvalCache
 
 from .ast import (TrueExp, FalseExp, Init, Reachable,
                   Atom, Not, And, Or, Implies, Iff, 
@@ -12,6 +22,21 @@ from .ast import (TrueExp, FalseExp, Init, Reachable,
                   nK, nE, nD, nC, K, E, D, C)
 
 
+# The results of evalCTLK, shared by all the specifications of a run
+_cache = EvalCache()
+
+
+def set_cache_budget(budget):
+    """
+    Set the number of BDD nodes the kept results of evalCTLK can use, and
+    drop the least recently used ones until they fit in it. A budget of 0
+    keeps nothing.
+    
+    budget -- a number of BDD nodes
+    """
+    _cache.budget = budget
+
+
 def evalCTLK(fsm, spec):
     """
     Return the BDD representing the set of states of fsm satisfying spec.
@@ -19,6 +44,19 @@ def evalCTLK(fsm, spec):
     fsm -- a MAS representing the system
     spec -- an AST-based CTLK specification
     """
+    spec = cons(spec)
+    result = _cache.get(fsm, spec)
+    if result is None:
+        result = _evalCTLK(fsm, spec)
+        if result is not None:
+            _cache.put(fsm, spec, result)
+    return result
+
+
+def _evalCTLK(fsm, spec):
+    """
+    Evaluate spec, a representative, without looking up the kept results.
+    """
     
     if type(spec) is TrueExp:
         return BDD.true(fsm.bddEnc.DDmanager)
@@ -158,6 +196,77 @@ def ex(fsm, phi):
     return fsm.pre(phi)
     
     
+# The kept fixpoints, most recently used last. Keys are (id(fsm), kind, phi,
+# psi) tuples, values are (fsm, layers, size) tuples; fsm is kept in the value
+# so that its id cannot be reused while the entry exists.
+_rings = OrderedDict()
+_rings_size = 0
+_rings_budget = 2 ** 20
+
+
+def set_rings_budget(budget):
+    """
+    Set the number of BDD nodes the kept fixpoints can use, and drop the
+    least recently used ones until they fit in it. A budget of 0 keeps
+    nothing.
+    
+    budget -- a number of BDD nodes
+    """
+    global _rings_budget
+    _rings_budget = max(budget, 0)
+    _fit_rings(_rings_budget)
+
+
+def _clear_rings():
+    """
+    Drop all the kept fixpoints. Called when deiniting NuSMV, since the kept
+    BDDs and FSMs cannot be used afterwards.
+    """
+    global _rings_size
+    _rings.clear()
+    _rings_size = 0
+
+_register_deinit_hook(_clear_rings)
+
+
+def _fit_rings(size):
+    """
+    Drop the least recently used fixpoints until the kept ones use at most
+    size BDD nodes.
+    """
+    global _rings_size
+    while _rings_size > size:
+        _, (_, _, lsize) = _rings.popitem(last=False)
+        _rings_size -= lsize
+
+
+def _get_rings(fsm, kind, phi, psi=None):
+    """
+    Return the kept layers of the given fixpoint, or None.
+    """
+    key = (id(fsm), kind, phi, psi)
+    if key not in _rings:
+        return None
+    _rings.move_to_end(key)
+    return _rings[key][1]
+
+
+def _keep_rings(fsm, kind, phi, psi, layers):
+    """
+    Keep the layers of the given fixpoint if they fit in the budget.
+    """
+    global _rings_size
+    key = (id(fsm), kind, phi, psi)
+    if key in _rings:
+        _rings_size -= _rings.pop(key)[2]
+    size = sum(layer.size for layer in layers)
+    if size > _rings_budget:
+        return
+    _fit_rings(_rings_budget - size)
+    _rings[key] = (fsm, layers, size)
+    _rings_size += size
+
+
 def eg(fsm, phi):
     """
     Return the set of states of fsm satisfying EG phi.
@@ -165,8 +274,16 @@ def eg(fsm, phi):
     fsm -- a MAS representing the system
     phi -- a BDD representing the set of states of fsm satisfying phi
     """
-    return fp(lambda Z: (phi & fsm.pre(Z)),
-               BDD.true(fsm.bddEnc.DDmanager))
+    layers = _get_rings(fsm, "EG", phi)
+    if layers is not None:
+        return layers[0]
+    # EG phi = nu Z. phi & EX Z, evaluated by NuSMV
+    mu = MuEvaluator(fsm)
+    Z = mu.var(0)
+    result = mu.eval(mu.gfp(0, mu.const(phi & fsm.bddEnc.statesMask) &
+                               mu.pre(Z)))
+    _keep_rings(fsm, "EG", phi, None, [result])
+    return result
     
     
 def eu(fsm, phi, psi):
@@ -177,8 +294,37 @@ def eu(fsm, phi, psi):
     phi -- a BDD representing the set of states of fsm satisfying phi
     psi -- a BDD representing the set of states of fsm satisfying psi
     """
-    return fp(lambda Z: (psi | (phi & fsm.pre(Z))),
-               BDD.false(fsm.bddEnc.DDmanager))
+    layers = eu_rings(fsm, phi, psi)
+    result = BDD.false(fsm.bddEnc.DDmanager)
+    for layer in layers:
+        result = result | layer
+    return result
+
+
+def eu_rings(fsm, phi, psi):
+    """
+    Return the onion rings of E[ phi U psi ], that is, a list of BDDs such
+    that the i-th one is the set of states of fsm that reach a state of psi
+    in i steps, and not less, through states of phi.
+    
+    fsm -- a MAS representing the system
+    phi -- a BDD representing the set of states of fsm satisfying phi
+    psi -- a BDD representing the set of states of fsm satisfying psi
+    """
+    layers = _get_rings(fsm, "EU", phi, psi)
+    if layers is not None:
+        return layers
+    
+    # E[ phi U psi ] = mu Z. psi | (phi & EX Z), computed by frontiers
+    reached = psi
+    layers = [psi]
+    while layers[-1].isnot_false():
+        layers.append(phi & fsm.pre(layers[-1]) & ~reached)
+        reached = reached | layers[-1]
+    # The last layer is empty
+    layers = layers[:-1]
+    _keep_rings(fsm, "EU", phi, psi, layers)
+    return layers
     
     
 def nk(fsm, agent, phi):
@@ -4,7 +4,7 @@ Extract simple path from a model to explain particular CTLK operators.
 
 from pynusmv.dd import BDD
 
-from .eval import eg, ex, eu, nk, ne, nc, nd
+from .eval import eg, ex, eu, eu_rings, nk, ne, nc, nd
 
 def explain_ex(fsm, state, p):
     """
@@ -93,25 +93,19 @@ def explain_eu(fsm, state, p, q):
     with intermediate states of p and starting at state.
     """
     
-    # Compute fixpoint and store intermediate BDDs
-    funct = lambda Z: (q | (p & fsm.pre(Z)))
-    old = BDD.false(fsm.bddEnc.DDmanager)
-    new = funct(old)
-    paths = [new]
-    # Stop when reaching state
-    # This is ensured since state satisfies E[ phi U psi ]
-    while (state & new).is_false():
-        old = new
-        new = funct(old)
-        paths.append(new - old)
-        
-    # paths contains intermediate BDDs
+    # The onion rings of the fixpoint, usually kept by its evaluation
     # paths[i] contains the BDD of all states of phi
     # that can reach a state of psi
     # through states of phi, in i steps
+    paths = eu_rings(fsm, p, q)
+    # Stop at the ring containing state
+    # This is ensured since state satisfies E[ phi U psi ]
+    index = 0
+    while (state & paths[index]).is_false():
+        index += 1
     
-    # paths[-1] contains state, skip it
-    paths = paths[:-1]
+    # paths[index] contains state, skip it
+    paths = paths[:index]
     s = state
     path = [s]
     for states in paths[::-1]:
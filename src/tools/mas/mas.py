@@ -1,8 +1,10 @@
-from pynusmv.dd import BDD
+from pynusmv.dd import BDD, Cube
 from pynusmv.fsm import BddFsm, BddTrans
+from pynusmv.nusmv.enc.bdd import bdd as nsbddEnc
 from pynusmv.nusmv.node import node as nsnode
 from pynusmv.nusmv.parser import parser as nsparser
 from pynusmv.nusmv.dd import dd as nsdd
+from pynusmv import instrument
 from .exception import UnknownAgentError
 
 class MAS(BddFsm):
@@ -35,6 +37,7 @@ class MAS(BddFsm):
         super(MAS, self).__init__(ptr, freeit=freeit)
         self._epistemic = epistemic and epistemic or {}
         self._epistemic_trans = {}
+        self._unobserved_cubes = {}
         self._agents_observed_variables = observed
         self._agents_inputvars = inputvars
         self._groups = groups if groups is not None else {}
@@ -78,12 +81,48 @@ class MAS(BddFsm):
                                                             symb_table(),
                                                             trans)
     
+    def _unobserved_cube(self, agents):
+        """
+        Return the cube of the state variables observed by none of agents,
+        together with input variables, or None if the observed variables of
+        some agent are unknown.
+        
+        agents -- a set of agents names.
+        """
+        agents = frozenset(agents)
+        if agents not in self._unobserved_cubes:
+            observed = set()
+            for agent in agents:
+                if agent not in self._epistemic:
+                    raise UnknownAgentError(str(agents) +
+                                            " are an unknown agents names.")
+                if agent not in self._agents_observed_variables:
+                    self._unobserved_cubes[agents] = None
+                    return None
+                observed |= set(self._agents_observed_variables[agent])
+            # Frozen variables are not part of the cube: they never change,
+            # so equivalent states always agree on them
+            state_cube = Cube(nsbddEnc.BddEnc_get_state_vars_cube(
+                                                        self.bddEnc._ptr),
+                              self.bddEnc.DDmanager, freeit=True)
+            self._unobserved_cubes[agents] = (
+                (state_cube - self.bddEnc.cube_for_state_vars(observed)) +
+                self.bddEnc.inputsCube)
+        return self._unobserved_cubes[agents]
+    
     def equivalent_states(self, states, agents):
         """
         Return the BDD representing the set of states epistemically equivalent
         to states through the epistemic relation of agents. agents is a set of
         agents name.
         
+        Since the epistemic relation of agents is the equality of the
+        variables they observe, the result is the projection of states on
+        these variables: non-observed variables are abstracted away. The
+        relational product with the epistemic relation, built over current
+        and next state variables, is only used for agents whose observed
+        variables are unknown.
+        
         states -- a BDD of states of self
         agents -- a set of agents names.
                   These agents must be ones of this MAS agents.
@@ -92,6 +131,10 @@ class MAS(BddFsm):
         # Apply FSM constraints
         states = states & self.state_constraints
         
+        cube = self._unobserved_cube(agents)
+        if cube is not None:
+            return states.forsome(cube) & self.state_constraints
+        
         # Compute the post-image
         if frozenset(agents) not in self._epistemic_trans:
             # Compute the BddTrans
@@ -178,6 +221,7 @@ class MAS(BddFsm):
         return super(MAS, self).post(states, inputs)
         
         
+    @instrument.traced(category="mas")
     def pre_strat(self, states, agents, strat=None):
         """
         Return the set of states s of this MAS such that there exists values
@@ -233,6 +277,7 @@ class MAS(BddFsm):
         return ~self.pre_strat(~states, agents)
         
     
+    @instrument.traced(category="mas")
     def pre_strat_si(self, states, agents, strat=None):
         """
         Return the set of state/inputs pairs <s,i_agents> of this MAS such that
@@ -1,27 +1,46 @@
 from pynusmv.mc import eval_ctl_spec
 from .explain import explain
 
-def check(fsm, spec):
+# The number of BDD nodes fsm can use to keep onion rings for the explanation,
+# if it keeps none already
+RINGS_BUDGET = 2 ** 20
+
+def check(fsm, spec, budget=None):
     """
     Check whether fsm satisfies spec or not.
     
     Return (True, None) if spec is satisfied,
     and (False, cntex) otherwise,
     where cntex is TLACE node explaining the violation.
-    """
     
-    initbdd = fsm.init
-    specbdd = eval_ctl_spec(fsm, spec)
+    budget -- an explain.Budget limiting the explanation, or None for a
+              complete one.
     
-    # Get violating states
-    violating = initbdd & ~specbdd
+    The onion rings of the fixpoints computed while checking spec are kept
+    in fsm (see pynusmv.fsm.BddFsm.rings_budget) until the explanation is
+    built, so that it does not compute them again. The branches of a lazy
+    explanation are computed later, with the rings fsm keeps at that time.
+    """
     
-    # If some initial states are not in specbdd, the spec if violated
-    if violating.isnot_false():
-        # Compute a counter-example
-        state = fsm.pick_one_state(violating)
-        return (False, explain(fsm, state, spec))
+    rings = fsm.rings_budget
+    if rings <= 0:
+        fsm.rings_budget = RINGS_BUDGET
+    try:
+        initbdd = fsm.init
+        specbdd = eval_ctl_spec(fsm, spec)
+        
+        # Get violating states
+        violating = initbdd & ~specbdd
         
-    # Otherwise, it is satisfied
-    else:
-        return (True, None)
+        # If some initial states are not in specbdd, the spec if violated
+        if violating.isnot_false():
+            # Compute a counter-example
+            state = fsm.pick_one_state(violating)
+            return (False, explain(fsm, state, spec, budget))
+            
+        # Otherwise, it is satisfied
+        else:
+            return (True, None)
+    finally:
+        # Dropping the budget drops the kept rings
+        fsm.rings_budget = rings
@@ -1,5 +1,5 @@
 from .tlacenode import Tlacenode
-from .tlacebranch import Tlacebranch
+from .tlacebranch import Tlacebranch, LazyTlacebranch
 
 from pynusmv.nusmv.parser import parser
 
@@ -7,20 +7,78 @@ from pynusmv.prop import (true as sptrue, false as spfalse, imply, iff,
                                ex, eg, ef, eu, ew, ax, ag, af, au, aw)
 from pynusmv.mc import eval_ctl_spec, explainEX, explainEG, explainEU
 
-def explain(fsm, state, spec):
+
+class Budget:
+    """
+    The limits of a TLACE explanation.
+    
+    Branches nested deeper than depth, or built once size TLACE nodes are
+    built, are not explained: their path is None. A lazy budget computes the
+    path of a branch the first time it is accessed, so explanations can be
+    explored without building them entirely.
+    """
+    
+    def __init__(self, depth=None, size=None, lazy=False):
+        """
+        depth -- the number of nested branches to explain, or None;
+        size -- the number of TLACE nodes to build, or None;
+        lazy -- whether branches are computed when first accessed.
+        """
+        self.depth = depth
+        self.size = size
+        self.lazy = lazy
+        # The states satisfying the (spec, context) pairs evaluated so far,
+        # shared by the branches of the explanation
+        self.__evaluated = {}
+        
+        
+    def allows(self, depth):
+        """Whether a branch nested at depth can be explained."""
+        return ((self.depth is None or depth < self.depth) and
+                (self.size is None or self.size > 0))
+        
+    def spend(self, nodes):
+        """Record that nodes TLACE nodes are built."""
+        if self.size is not None:
+            self.size -= nodes
+            
+    def evaluate(self, fsm, spec, context):
+        """
+        Return the set of states of fsm satisfying spec in context,
+        evaluating it only once for the explanation.
+        """
+        key = (spec, context)
+        if key not in self.__evaluated:
+            self.__evaluated[key] = eval_ctl_spec(fsm, spec, context)
+        return self.__evaluated[key]
+
+
+def _evaluate(fsm, spec, context, budget):
+    """
+    Return the set of states of fsm satisfying spec in context, through
+    budget if not None.
+    """
+    if budget is None:
+        return eval_ctl_spec(fsm, spec, context)
+    else:
+        return budget.evaluate(fsm, spec, context)
+
+
+def explain(fsm, state, spec, budget=None):
     """
     Return a TLACE node explaining why state of fsm violates spec.
     
     fsm -- a pynusmv.fsm.BddFsm representing the system.
     state -- a pynusmv.dd.BDD representing a state of fsm.
     spec -- a pynusmv.spec.spec.Spec node representing the specification.
+    budget -- a Budget limiting the explanation, or None for a complete one.
     
     Return a tlacenode.Tlacenode explaining why state of fsm violates spec.
     """
-    return countex(fsm, state, spec, None)
+    return countex(fsm, state, spec, None, budget)
     
     
-def countex(fsm, state, spec, context):
+def countex(fsm, state, spec, context, budget=None, depth=0):
     """
     Return a TLACE node explaining why state of fsm violates spec.
     
@@ -28,12 +86,14 @@ def countex(fsm, state, spec, context):
     state -- a pynusmv.dd.BDD representing a state of fsm.
     spec -- a pynusmv.spec.spec.Spec node representing the specification.
     context -- a pynusmv.spec.spec.Spec representing the context of spec in fsm.
+    budget -- a Budget limiting the explanation, or None.
+    depth -- the number of branches the returned node is nested in.
     
     Return a tlacenode.Tlacenode explaining why state of fsm violates spec.
     """
     
     if spec.type == parser.CONTEXT:
-        return countex(fsm, state, spec.cdr, spec.car)
+        return countex(fsm, state, spec.cdr, spec.car, budget, depth)
         
     elif spec.type == parser.FALSEEXP:
         newspec = sptrue()
@@ -90,10 +150,10 @@ def countex(fsm, state, spec, context):
             newspec = ~spec
         return Tlacenode(state, (newspec,), None, None)
         
-    return witness(fsm, state, newspec, context)
+    return witness(fsm, state, newspec, context, budget, depth)
     
     
-def witness(fsm, state, spec, context):
+def witness(fsm, state, spec, context, budget=None, depth=0):
     """
     Return a TLACE node explaining why state of fsm satisfies spec.
     
@@ -101,28 +161,30 @@ def witness(fsm, state, spec, context):
     state -- a pynusmv.dd.BDD representing a state of fsm.
     spec -- a pynusmv.spec.spec.Spec node representing the specification.
     context -- a pynusmv.spec.spec.Spec representing the context of spec in fsm.
+    budget -- a Budget limiting the explanation, or None.
+    depth -- the number of branches the returned node is nested in.
     
     Return a tlacenode.Tlacenode explaining why state of fsm satisfies spec.
     """
 
     if spec.type == parser.CONTEXT:
-        return witness(fsm, state, spec.cdr, spec.car)
+        return witness(fsm, state, spec.cdr, spec.car, budget, depth)
         
     elif spec.type == parser.TRUEEXP:
         return Tlacenode(state, None, None, None)
         
     elif spec.type == parser.NOT:
-        return countex(fsm, state, spec.car, context)
+        return countex(fsm, state, spec.car, context, budget, depth)
         
     elif spec.type == parser.OR:
-        if state.entailed(eval_ctl_spec(fsm, spec.car, context)):
-            return witness(fsm, state, spec.car, context)
+        if state.entailed(_evaluate(fsm, spec.car, context, budget)):
+            return witness(fsm, state, spec.car, context, budget, depth)
         else:
-            return witness(fsm, state, spec.cdr, context)
+            return witness(fsm, state, spec.cdr, context, budget, depth)
     
     elif spec.type == parser.AND:
-        n1 = witness(fsm, state, spec.car, context)
-        n2 = witness(fsm, state, spec.cdr, context)
+        n1 = witness(fsm, state, spec.car, context, budget, depth)
+        n2 = witness(fsm, state, spec.cdr, context, budget, depth)
         return Tlacenode(state,
                          n1.atomics + n2.atomics,
                          n1.branches + n2.branches,
@@ -130,20 +192,33 @@ def witness(fsm, state, spec, context):
     
     elif spec.type == parser.IMPLIES:
         newspec = (~spec.car) | spec.cdr
-        return witness(fsm, state, newspec, context)
+        return witness(fsm, state, newspec, context, budget, depth)
                             
     elif spec.type == parser.IFF:
         newspec = (spec.car & spec.cdr) | ((~spec.car) & (~spec.cdr))
-        return witness(fsm, state, newspec, context)
+        return witness(fsm, state, newspec, context, budget, depth)
                     
     elif (spec.type == parser.EX or
           spec.type == parser.EF or
           spec.type == parser.EG or
           spec.type == parser.EU or
           spec.type == parser.EW):
-        return Tlacenode(state, None,
-                         (witness_branch(fsm, state, spec, context, spec),),
-                         None)
+        if budget is None:
+            branch = witness_branch(fsm, state, spec, context, spec)
+        elif not budget.allows(depth):
+            branch = Tlacebranch(spec, None)
+        elif budget.lazy:
+            def expand():
+                # Other branches may have used the budget in the meantime
+                if not budget.allows(depth):
+                    return (None, None)
+                return witness_branch(fsm, state, spec, context, spec,
+                                      budget, depth).path
+            branch = LazyTlacebranch(spec, expand)
+        else:
+            branch = witness_branch(fsm, state, spec, context, spec,
+                                    budget, depth)
+        return Tlacenode(state, None, (branch,), None)
                     
     elif (spec.type == parser.AX or
           spec.type == parser.AF or
@@ -159,7 +234,8 @@ def witness(fsm, state, spec, context):
         return Tlacenode(state, (spec,), None, None)
         
         
-def witness_branch(fsm, state, spec, context, originalspec):
+def witness_branch(fsm, state, spec, context, originalspec,
+                   budget=None, depth=0):
     """
     Return a TLACE branch explaining why state of fsm satisfies spec.
 
@@ -170,64 +246,78 @@ def witness_branch(fsm, state, spec, context, originalspec):
     originalspec -- a pynusmv.spec.spec.Spec representing the original spec;
                     used to annotate the produced branch, despite updated
                     specs.
+    budget -- a Budget limiting the explanation, or None.
+    depth -- the number of branches the node of the branch is nested in.
 
     Return a tlacebranch.Tlacebranch explaining why state of fsm satisfies spec.
     
     Throw a NonExistentialSpecError if spec is not existential.
     """
     
+    # The nodes of the branch are nested one level deeper
+    inner = depth + 1
+    
     if spec.type == parser.EX:
-        f = eval_ctl_spec(fsm, spec.car, context)
+        f = _evaluate(fsm, spec.car, context, budget)
         path = explainEX(fsm, state, f)
+        if budget is not None:
+            budget.spend(2)
         branch = (Tlacenode(path[0]),
                   path[1],
-                  witness(fsm, path[2], spec.car, context))
+                  witness(fsm, path[2], spec.car, context, budget, inner))
         return Tlacebranch(originalspec, branch)
         
     elif spec.type == parser.EF:
         newspec = eu(sptrue(), spec.car)
-        return witness_branch(fsm, state, newspec, context, originalspec)
+        return witness_branch(fsm, state, newspec, context, originalspec,
+                              budget, depth)
         
     elif spec.type == parser.EG:
-        f = eval_ctl_spec(fsm, spec.car, context)
+        f = _evaluate(fsm, spec.car, context, budget)
         (path, (inloop, loopstate)) = explainEG(fsm, state, f)
+        if budget is not None:
+            budget.spend(len(path) // 2 + 1)
         
         branch = []
         # intermediate states
         for s, i in zip(path[::2], path[1::2]):
-            wit = witness(fsm, s, spec.car, context)
+            wit = witness(fsm, s, spec.car, context, budget, inner)
             branch.append(wit)
             branch.append(i)
             # manage the loop
             if s == loopstate:
                 loop = wit
         # last state
-        branch.append(witness(fsm, path[-1], spec.car, context))
+        branch.append(witness(fsm, path[-1], spec.car, context, budget, inner))
         
         return Tlacebranch(originalspec, tuple(branch), (inloop, loop))
         
     elif spec.type == parser.EU:
-        f = eval_ctl_spec(fsm, spec.car, context)
-        g = eval_ctl_spec(fsm, spec.cdr, context)
+        f = _evaluate(fsm, spec.car, context, budget)
+        g = _evaluate(fsm, spec.cdr, context, budget)
         path = explainEU(fsm, state, f, g)
+        if budget is not None:
+            budget.spend(len(path) // 2 + 1)
         
         branch = []
         # intermediate states
         for s, i in zip(path[::2], path[1::2]):
-            branch.append(witness(fsm, s, spec.car, context))
+            branch.append(witness(fsm, s, spec.car, context, budget, inner))
             branch.append(i)
         # last state
-        branch.append(witness(fsm, path[-1], spec.cdr, context))
+        branch.append(witness(fsm, path[-1], spec.cdr, context, budget, inner))
         
         return Tlacebranch(originalspec, tuple(branch))
         
     elif spec.type == parser.EW:
         euspec = eu(spec.car, spec.cdr)
         egspec = eg(spec.car)
-        if state.entailed(eval_ctl_spec(fsm, euspec, context)):
-            return witness_branch(fsm, state, euspec, context, originalspec)
+        if state.entailed(_evaluate(fsm, euspec, context, budget)):
+            return witness_branch(fsm, state, euspec, context, originalspec,
+                                  budget, depth)
         else:
-            return witness_branch(fsm, state, egspec, context, originalspec)
+            return witness_branch(fsm, state, egspec, context, originalspec,
+                                  budget, depth)
         
     else:
         # Default case, throw an exception because spec is not existential
@@ -8,7 +8,7 @@ from pynusmv import glob
 from pynusmv.fsm import BddFsm
 
 from tools.tlace.check import check as check_ctl_spec
-from tools.tlace.xml import xml_representation
+from tools.tlace.xml import write_xml
     
     
 def check_and_explain(allargs):
@@ -44,7 +44,8 @@ def check_and_explain(allargs):
                   file=sys.stderr)
         
             if not satisfied:
-                print(xml_representation(fsm, cntex, spec))
+                write_xml(fsm, cntex, spec, sys.stdout)
+                print()
             
             print()
 
@@ -31,4 +31,45 @@ class Tlacebranch:
     @property
     def path(self):
         """The path of this branch. A (path, (inputs, loop)) tuple, or None."""
-        return self.__path
\ No newline at end of file
+        return self.__path
+        
+    @property
+    def explained(self):
+        """Whether the path of this branch is given."""
+        return self.path[0] is not None
+        
+        
+class LazyTlacebranch(Tlacebranch):
+    """
+    A LazyTlacebranch is a TLACE branch whose path is computed when it is
+    first accessed.
+    """
+    
+    def __init__(self, formula, expand):
+        """
+        Create a new lazy TLACE branch.
+        
+        formula -- an existential temporal formula;
+        expand -- a function with no argument, returning the (path, loop) pair
+                  of the branch, as given to Tlacebranch.
+        """
+        super().__init__(formula, None)
+        self.__expand = expand
+        self.__path = None
+        
+        
+    @property
+    def expanded(self):
+        """Whether the path of this branch is already computed."""
+        return self.__expand is None
+        
+    @property
+    def path(self):
+        """
+        The path of this branch. A (path, (inputs, loop)) tuple, or None.
+        The path is computed the first time it is accessed.
+        """
+        if self.__expand is not None:
+            self.__path = self.__expand()
+            self.__expand = None
+        return self.__path
@@ -1,200 +1,169 @@
-import sys
+"""
+XML representation of TLACEs.
+
+TLACEs are written while they are traversed, to a file object and without
+recursion: branching explanations can be deeper than the recursion limit and
+too large to be kept in a single string.
+
+Branches that are not explained, or lazy branches that are not expanded yet,
+are written as unexplained existential elements, without path.
+"""
+
+from io import StringIO
 from xml.sax.saxutils import escape
 
-from ..utils import indent
+_INDENT = "   "
+
+# Number of lines kept in memory before being written
+BUFFER_LINES = 4096
+
+# Kinds of traversal tasks
+_TEXT = 0
+_NODE = 1
+_BRANCH = 2
+_INPUTS = 3
+_COMBINATORIAL = 4
+_LOOP = 5
+
+
+class _Writer:
+    """
+    A buffered writer of indented lines.
+    """
+
+    def __init__(self, out):
+        """
+        out -- the file object to write to.
+        """
+        self.out = out
+        self.lines = []
+
+    def write(self, depth, line):
+        """Write line, indented depth times."""
+        self.lines.append(_INDENT * depth + line)
+        if len(self.lines) >= BUFFER_LINES:
+            self.flush()
+
+    def values(self, depth, tag, values):
+        """
+        Write the values element tag at depth, containing the given
+        (variable, value) pairs.
+        """
+        inner = _INDENT * (depth + 1)
+        self.lines.append(_INDENT * depth + "<" + tag + ">\n")
+        self.lines.extend(inner + '<value variable="' + escape(var) + '">' +
+                          escape(val) + "</value>\n"
+                          for var, val in values.items())
+        self.lines.append(_INDENT * depth + "</" + tag + ">\n")
+        if len(self.lines) >= BUFFER_LINES:
+            self.flush()
+
+    def flush(self):
+        """Write the buffered lines."""
+        self.out.write("".join(self.lines))
+        self.lines = []
+
+
+def write_xml(fsm, tlacenode, spec, out):
+    """
+    Write to out the XML representation of tlacenode explaining spec
+    violation by fsm.
+
+    fsm -- the FSM violating spec.
+    tlacenode -- the TLACE node explaining the violation of spec by fsm.
+    spec -- the violated specification.
+    out -- a text file object.
+    """
+    writer = _Writer(out)
+    writer.write(0, '<?xml version="1.0" encoding="UTF-8"?>\n')
+    writer.write(0, '<counterexample specification="{spec}">\n'
+                    .format(spec=escape(str(spec))))
+
+    # The next node id
+    nextid = 0
+
+    # Tasks are (kind, depth, object, loop) tuples, where loop is the
+    # dictionary recording the id of the loop node of the current branch
+    tasks = [(_NODE, 1, tlacenode, None)]
+    while tasks:
+        kind, depth, obj, loop = tasks.pop()
+
+        if kind == _TEXT:
+            writer.write(depth, obj)
+
+        elif kind == _NODE:
+            if loop is not None:
+                loop["id"] = nextid
+            writer.write(depth, '<node id="{0}">\n'.format(nextid))
+            nextid += 1
+
+            writer.values(depth + 1, "state", obj.state.get_str_values())
+            for atomic in obj.atomics:
+                writer.write(depth + 1, '<atomic specification="{0}" />\n'
+                                        .format(escape(str(atomic))))
+
+            # Then branches, universals and the closing tag, in this order
+            tasks.append((_TEXT, depth, "</node>\n", None))
+            for universal in reversed(obj.universals):
+                tasks.append((_TEXT, depth + 1,
+                              '<universal specification="{0}" />\n'
+                              .format(escape(str(universal))), None))
+            for branch in reversed(obj.branches):
+                tasks.append((_BRANCH, depth + 1, branch, None))
+
+        elif kind == _BRANCH:
+            if not getattr(obj, "expanded", True) or not obj.explained:
+                writer.write(depth, '<existential specification="{0}" '
+                                    'explained="false" />\n'
+                                    .format(escape(str(obj.specification))))
+                continue
+            writer.write(depth, '<existential specification="{0}" '
+                                'explained="true">\n'
+                                .format(escape(str(obj.specification))))
+            path, looping = obj.path
+            loop = {"id": -1}
+
+            branch = []
+            for n, i in zip(path[::2], path[1::2]):
+                branch.append((_NODE, depth + 1, n,
+                               loop if looping is not None and n == looping[1]
+                               else None))
+                branch.append((_INPUTS, depth + 1, i, None))
+                branch.append((_COMBINATORIAL, depth + 1, i, None))
+            branch.append((_NODE, depth + 1, path[-1], None))
+            if looping is not None:
+                branch.append((_INPUTS, depth + 1, looping[0], None))
+                branch.append((_LOOP, depth + 1, None, loop))
+            branch.append((_TEXT, depth, "</existential>\n", None))
+            tasks.extend(reversed(branch))
+
+        elif kind == _INPUTS:
+            writer.values(depth, "input", obj.get_str_values())
+
+        elif kind == _COMBINATORIAL:
+            # TODO Find a way to get combinatorial
+            writer.write(depth, "<combinatorial>\n")
+            writer.write(depth, "</combinatorial>\n")
+
+        elif kind == _LOOP:
+            writer.write(depth, '<loop to="{0}" />\n'.format(loop["id"]))
+
+    writer.write(0, "</counterexample>")
+    writer.flush()
+
 
-__id_node = 0
 def xml_representation(fsm, tlacenode, spec):
     """
     Return the XML representation of tlacenode explaining spec violation by fsm.
-    
+
     Return the XML representation of a TLACE
     starting at tlacenode, explaining why the state of tlacenode,
     belonging to fsm, violates spec.
-    
+
     fsm -- the FSM violating spec.
     tlacenode -- the TLACE node explaining the violation of spec by fsm.
     spec -- the violated specification.
     """
-    
-    indent.reset()
-    
-    global __id_node
-    __id_node = 0
-    
-    # Open counterexample
-    xmlrepr = (
-    """<?xml version="1.0" encoding="UTF-8"?>
-<counterexample specification="{spec}">
-""".format(spec=escape(str(spec))))
-    
-    indent.inc()
-    
-    xmlrepr += xml_node(fsm, tlacenode)
-    
-    indent.dec()
-    
-    xmlrepr += """</counterexample>"""
-    
-    return xmlrepr
-    
-    
-def xml_node(fsm, node):
-    """
-    Return the XML representation of the given TLACE node.
-    
-    fsm -- the FSM of the node.
-    node -- the TLACE node to represent.
-    """
-    
-    # node tag
-    global __id_node
-    
-    xmlrepr = indent.indent(
-    """<node id="{0}">
-""".format(__id_node))
-    
-    __id_node += 1
-    
-    indent.inc()
-    # state node
-    xmlrepr += xml_state(fsm, node.state)
-    
-    # atomics
-    for atomic in node.atomics:
-        xmlrepr += indent.indent(
-        """<atomic specification="{0}" />
-""".format(escape(str(atomic))))
-    
-    # branches
-    for branch in node.branches:
-        xmlrepr += xml_branch(fsm, branch)
-    
-    # universals
-    for universal in node.universals:
-        xmlrepr += indent.indent(
-        """<universal specification="{0}" />
-""".format(escape(str(universal))))
-    
-    indent.dec()
-    
-    xmlrepr += indent.indent("""</node>
-""")
-    
-    return xmlrepr
-    
-    
-def xml_branch(fsm, branch):
-    """
-    Return the XML representation of the given TLACE branch.
-    
-    fsm -- the FSM of the node.
-    branch -- the TLACE branch to represent.
-    """
-    
-    loop_id = -1
-    
-    xmlrepr = indent.indent(
-    """<existential specification="{0}" explained="true">
-""".format(escape(str(branch.specification))))
-    
-    indent.inc()
-    
-    for n, i in zip(branch.path[0][::2], branch.path[0][1::2]):
-        xmlrepr += xml_node(fsm, n)
-        xmlrepr += xml_inputs(fsm, i)
-        xmlrepr += xml_combinatorial(fsm, i)
-        if branch.path[1] is not None and n == branch.path[1][1]:
-            loop_id = __id_node - 1
-        
-    xmlrepr += xml_node(fsm, branch.path[0][-1])
-    
-    if branch.path[1] is not None:
-        xmlrepr += xml_inputs(fsm, branch.path[1][0])
-        xmlrepr += indent.indent(
-        """<loop to="{0}" />
-""".format(loop_id))
-    
-    indent.dec()
-    xmlrepr += indent.indent(
-    """</existential>
-""")
-    
-    return xmlrepr
-    
-    
-def xml_state(fsm, state):
-    """
-    Return the XML representation of the given state.
-    
-    fsm -- the FSM of the state.
-    state -- a BDD representing a state of fsm.
-    """
-    
-    xmlrepr = indent.indent(
-    """<state>
-""")
-    
-    indent.inc()
-    
-    values = state.get_str_values()
-    for var in values:
-        xmlrepr += indent.indent(
-        """<value variable="{0}">{1}</value>
-""".format(escape(var), escape(values[var])))
-    
-    indent.dec()
-    xmlrepr += indent.indent("""</state>
-""")
-    
-    return xmlrepr
-    
-
-def xml_inputs(fsm, inputs):
-    """
-    Return the XML representation of the given inputs.
-    
-    fsm -- the FSM.
-    state -- a BDD representing inputs in fsm.
-    """
-        
-    xmlrepr = indent.indent(
-    """<input>
-""")
-    
-    indent.inc()
-    
-    values = inputs.get_str_values()
-    for var in values:
-        xmlrepr += indent.indent(
-        """<value variable="{0}">{1}</value>
-""".format(escape(var), escape(values[var])))
-    
-    indent.dec()
-    xmlrepr += indent.indent("""</input>
-""")
-    
-    return xmlrepr
-    
-    
-def xml_combinatorial(fsm, combinatorial):
-    """
-    Return the XML representation of the given combinatorial.
-    
-    fsm -- the FSM.
-    state -- a BDD representing inputs in fsm.
-    """
-        
-    xmlrepr = indent.indent(
-    """<combinatorial>
-""")
-    
-    indent.inc()
-    
-    # TODO Find a way to get combinatorial
-    
-    indent.dec()
-    xmlrepr += indent.indent("""</combinatorial>
-""")
-    
-    return xmlrepr
\ No newline at end of file
+    out = StringIO()
+    write_xml(fsm, tlacenode, spec, out)
+    return out.getvalue()
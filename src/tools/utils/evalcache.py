@@ -0,0 +1,153 @@
+"""
+Hash-consing of AST-based specifications and caching of their evaluation.
+
+The ASTs of the checkers are trees of namedtuples. cons returns the unique
+representative of a tree, sharing equal subformulas within and across
+specifications; representatives can then be hashed and compared by identity.
+An EvalCache keeps the BDDs of the evaluated representatives of each model,
+within a budget of BDD nodes, dropping the least recently used ones first.
+
+The representatives and all the EvalCaches are dropped together by clear,
+called when deiniting NuSMV.
+"""
+
+from collections import OrderedDict
+from weakref import WeakSet
+
+from pynusmv.init import _register_deinit_hook
+
+# The representatives, by (type, fields) keys where subformulas are given by
+# the id of their representative. Representatives are only dropped by clear,
+# with the results keyed by their ids, so ids cannot be reused meanwhile.
+_consed = {}
+# The representatives, by id
+_representatives = {}
+# The existing EvalCaches
+_caches = WeakSet()
+
+
+def clear():
+    """
+    Drop all the representatives and the results of all the EvalCaches.
+
+    Specifications consed before are not representatives anymore; consing
+    them again returns new representatives.
+    """
+    for cache in list(_caches):
+        cache.clear()
+    _consed.clear()
+    _representatives.clear()
+
+_register_deinit_hook(clear)
+
+
+def cons(spec):
+    """
+    Return the representative of spec.
+
+    Sequences in the fields of spec, such as groups of agents, are tuples in
+    the representative.
+
+    spec -- an AST-based specification.
+    """
+    if _representatives.get(id(spec)) is spec:
+        return spec
+
+    fields = []
+    keys = []
+    for field in spec:
+        if hasattr(field, "_fields"):
+            field = cons(field)
+            keys.append(id(field))
+        elif not isinstance(field, str) and hasattr(field, "__iter__"):
+            field = tuple(cons(element) if hasattr(element, "_fields")
+                          else element
+                          for element in field)
+            keys.append(tuple(id(element) for element in field))
+        else:
+            keys.append(field)
+        fields.append(field)
+
+    key = (type(spec), tuple(keys))
+    representative = _consed.get(key)
+    if representative is None:
+        representative = type(spec)(*fields)
+        _consed[key] = representative
+        _representatives[id(representative)] = representative
+    return representative
+
+
+class EvalCache:
+    """
+    A bounded cache of the BDDs satisfying specification representatives.
+
+    Entries are keyed by model and representative, and are kept within a
+    budget of BDD nodes. Models are kept alive by their entries, so that
+    their ids cannot be reused.
+    """
+
+    def __init__(self, budget=2 ** 20):
+        """
+        budget -- the number of BDD nodes the kept results can use.
+        """
+        self._results = OrderedDict()
+        self._size = 0
+        self._budget = max(budget, 0)
+        _caches.add(self)
+
+    @property
+    def budget(self):
+        """The number of BDD nodes the kept results can use."""
+        return self._budget
+
+    @budget.setter
+    def budget(self, budget):
+        self._budget = max(budget, 0)
+        self._fit(self._budget)
+
+    def clear(self):
+        """Drop all the kept results."""
+        self._results.clear()
+        self._size = 0
+
+    def _fit(self, size):
+        """
+        Drop the least recently used results until the kept ones use at most
+        size BDD nodes.
+        """
+        while self._size > size:
+            _, (_, _, rsize) = self._results.popitem(last=False)
+            self._size -= rsize
+
+    def get(self, fsm, spec):
+        """
+        Return the kept set of states of fsm satisfying spec, or None.
+
+        fsm -- the model;
+        spec -- a specification representative, as returned by cons.
+        """
+        key = (id(fsm), id(spec))
+        entry = self._results.get(key)
+        if entry is None:
+            return None
+        self._results.move_to_end(key)
+        return entry[1]
+
+    def put(self, fsm, spec, result):
+        """
+        Keep result as the set of states of fsm satisfying spec, if it fits in
+        the budget.
+
+        fsm -- the model;
+        spec -- a specification representative, as returned by cons;
+        result -- a BDD.
+        """
+        key = (id(fsm), id(spec))
+        if key in self._results:
+            self._size -= self._results.pop(key)[2]
+        size = result.size
+        if size > self._budget:
+            return
+        self._fit(self._budget - size)
+        self._results[key] = (fsm, result, size)
+        self._size += size